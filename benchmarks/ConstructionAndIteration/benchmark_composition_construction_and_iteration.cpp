@@ -7,7 +7,7 @@
 #include <random>
 #include <ranges>
 
-std::chrono::duration<double, std::nano> benchmark_construction(const size_t iterations, const size_t nSpecies) {
+std::chrono::duration<double, std::nano> benchmark_construction(const size_t iterations, const size_t nSpecies, PerfCounts& counts) {
     using namespace fourdst::composition;
     using namespace fourdst::atomic;
 
@@ -29,16 +29,17 @@ std::chrono::duration<double, std::nano> benchmark_construction(const size_t ite
         count++;
     }
 
-    const auto duration = fdst_benchmark_function([&]() {
+    const auto [duration, callCounts] = fdst_benchmark_function_counted([&]() {
         for (size_t i = 0; i < iterations; ++i) {
             fourdst::composition::Composition comp(species_to_register, molarAbundances);
         }
     });
 
+    counts += callCounts;
     return duration / static_cast<double>(iterations);
 }
 
-std::chrono::duration<double, std::nano> benchmark_access(const size_t iterations, const size_t nSpecies) {
+std::chrono::duration<double, std::nano> benchmark_access(const size_t iterations, const size_t nSpecies, PerfCounts& counts) {
     using namespace fourdst::composition;
     using namespace fourdst::atomic;
 
@@ -68,7 +69,7 @@ std::chrono::duration<double, std::nano> benchmark_access(const size_t iteration
         random_lookup_species.push_back(species_to_register[sIDDis(gen)]);
     }
 
-    const auto duration = fdst_benchmark_function([&]() {
+    const auto [duration, callCounts] = fdst_benchmark_function_counted([&]() {
         for (size_t i = 0; i < iterations; ++i) {
             volatile double y = comp.getMolarAbundance(random_lookup_species[i]);
             do_not_optimize(y);
@@ -76,6 +77,7 @@ std::chrono::duration<double, std::nano> benchmark_access(const size_t iteration
     });
 
 
+    counts += callCounts;
     return duration / static_cast<double>(iterations);
 }
 
@@ -85,10 +87,11 @@ int main () {
 
     std::vector<double> durations;
     durations.resize(nIterations);
+    PerfCounts counts;
 
     for (size_t i = 0; i < nIterations; ++i) {
         std::print("Iteration {}/{}\r", i + 1, nIterations);
-        auto duration = benchmark_construction(10, nSpecies);
+        auto duration = benchmark_construction(10, nSpecies, counts);
         durations[i] = duration.count();
     }
     std::println("");
@@ -102,13 +105,15 @@ int main () {
 
 
     std::println("{}", plot_ascii_histogram(durations, "Composition Construction Time Histogram"));
+    std::println("{}", format_perf_counts(counts, nIterations * 10.0, "Composition Construction Counters"));
 
 
     durations.clear();
     durations.resize(nIterations);
+    counts = {};
     for (size_t i = 0; i < nIterations; ++i) {
         std::print("Iteration {}/{}\r", i + 1, nIterations);
-        auto duration = benchmark_access(1000, nSpecies);
+        auto duration = benchmark_access(1000, nSpecies, counts);
         durations[i] = duration.count();
     }
     std::println("");
@@ -120,4 +125,5 @@ int main () {
                  *std::ranges::min_element(durations));
 
     std::println("{}", plot_ascii_histogram(durations, "Composition Access Time Histogram"));
+    std::println("{}", format_perf_counts(counts, nIterations * 1000.0, "Composition Access Counters"));
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+#define FDST_DEFINE_COUNTING_OPERATOR_NEW
+#include "allocation_counter.h"
+#include "allocation_budgets.h"
+
+#include <cstddef>
+#include <print>
+
+/*
+ * Allocations and bytes per call of every budgeted Composition operation (allocation_budgets.h)
+ * at several composition sizes, next to the budget. Exits with 1 if a budget is exceeded; the
+ * allocationTest target enforces the same budgets in the test suite.
+ */
+int main() {
+    constexpr std::size_t calls = 64;
+    bool withinBudget = true;
+    for (const std::size_t n : {8, 128, 1024, 3500}) {
+        AllocationFixture fixture(n);
+        std::println("{} species", n);
+        std::println("{:>48} {:>14} {:>14} {:>10}", "operation", "allocs/call", "bytes/call", "budget");
+        for (const AllocationBudget& budget : composition_allocation_budgets()) {
+            const AllocationCounts counts = count_allocations([&] { budget.call(fixture); }, calls);
+            const bool over = counts.allocations > budget.allowed(n) * calls;
+            withinBudget = withinBudget && !over;
+            std::println("{:>48} {:>14.2f} {:>14.1f} {:>10}{}", budget.operation,
+                static_cast<double>(counts.allocations) / calls, static_cast<double>(counts.bytes) / calls,
+                budget.allowed(n), over ? "  OVER BUDGET" : "");
+        }
+        std::println("");
+    }
+    return withinBudget ? 0 : 1;
+}
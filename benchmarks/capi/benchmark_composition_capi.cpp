@@ -0,0 +1,123 @@
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/c/composition_c.h"
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <print>
+#include <vector>
+#include <ranges>
+#include <chrono>
+
+#include "benchmark_utils.h"
+
+namespace {
+    fourdst::composition::Composition build_composition(const size_t nSpecies) {
+        using namespace fourdst::composition;
+        using namespace fourdst::atomic;
+
+        Composition comp;
+        size_t count = 0;
+        for (const auto& sp : species | std::views::values) {
+            if (count >= nSpecies) {
+                break;
+            }
+            comp.registerSpecies(sp);
+            comp.setMolarAbundance(sp, 0.1 / static_cast<double>(count + 1));
+            count++;
+        }
+        return comp;
+    }
+
+    double ns_per_call(const std::chrono::nanoseconds duration, const size_t calls) {
+        return static_cast<double>(duration.count()) / static_cast<double>(calls);
+    }
+}
+
+int main() {
+    using namespace fourdst::composition;
+
+    const size_t nIterations = 10000;
+    const size_t nZones = 64;
+    std::println("Per call cost of the C ABI against the C++ getters (ns)");
+    std::println("{:>8} {:>14} {:>14} {:>14} {:>14} {:>16}",
+                 "species", "C++ moments", "C moments", "C++ X vector", "C X", "C batch X/zone");
+    for (const size_t nSpecies : {8, 32, 128, 512, 2048, 3500}) {
+        const Composition comp = build_composition(nSpecies);
+
+        std::vector<int32_t> z;
+        std::vector<int32_t> a;
+        for (const auto& sp : comp.getRegisteredSpecies()) {
+            z.push_back(static_cast<int32_t>(sp.z()));
+            a.push_back(static_cast<int32_t>(sp.a()));
+        }
+        std::vector<double> y = comp.getMolarAbundanceVector();
+        std::vector<double> x(y.size());
+
+        fdst_composition* handle = nullptr;
+        if (fdst_composition_create(z.data(), a.data(), z.size(), &handle) != FDST_COMPOSITION_OK) {
+            std::println("fdst_composition_create failed: {}", fdst_composition_last_error());
+            return 1;
+        }
+        fdst_composition_bind(handle, y.data());
+
+        const auto cppMomentsDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                double mu = comp.getMeanParticleMass();
+                double ye = comp.getElectronAbundance();
+                do_not_optimize(mu);
+                do_not_optimize(ye);
+            }
+        });
+
+        const auto cMomentsDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                fdst_composition_moments moments;
+                int status = fdst_composition_get_moments(handle, &moments);
+                do_not_optimize(status);
+                do_not_optimize(moments.ye);
+            }
+        });
+
+        const auto cppMassFractionDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                std::vector<double> massFractions = comp.getMassFractionVector();
+                double first = massFractions.front();
+                do_not_optimize(first);
+            }
+        });
+
+        const auto cMassFractionDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                int status = fdst_composition_get_mass_fractions(handle, x.data());
+                do_not_optimize(status);
+                do_not_optimize(x.front());
+            }
+        });
+
+        std::vector<double> zones(nZones * y.size());
+        for (size_t k = 0; k < nZones; ++k) {
+            std::ranges::copy(y, zones.begin() + static_cast<std::ptrdiff_t>(k * y.size()));
+        }
+        std::vector<double> zoneMassFractions(zones.size());
+        const size_t nBatches = std::max<size_t>(1, nIterations / nZones);
+        const auto cBatchDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nBatches; ++i) {
+                int status = fdst_composition_mass_fractions_batch(handle, zones.data(), nZones, y.size(), zoneMassFractions.data());
+                do_not_optimize(status);
+                do_not_optimize(zoneMassFractions.front());
+            }
+        });
+
+        std::println("{:>8} {:>14.1f} {:>14.1f} {:>14.1f} {:>14.1f} {:>16.1f}",
+                     comp.size(),
+                     ns_per_call(cppMomentsDuration, nIterations),
+                     ns_per_call(cMomentsDuration, nIterations),
+                     ns_per_call(cppMassFractionDuration, nIterations),
+                     ns_per_call(cMassFractionDuration, nIterations),
+                     ns_per_call(cBatchDuration, nBatches * nZones));
+
+        fdst_composition_destroy(handle);
+    }
+}
@@ -0,0 +1,89 @@
+!> Per call cost of the Fortran bindings (module fourdst_composition), zones laid out as y(n_species, n_zones).
+program benchmark_composition_capi
+    use fourdst_composition
+    use, intrinsic :: iso_fortran_env, only: error_unit
+    implicit none
+
+    integer, parameter :: n_iterations = 10000
+    integer, parameter :: n_zones = 64
+    integer, parameter :: sizes(*) = [8, 32, 128, 512, 2048, 3500]
+
+    type(c_ptr) :: comp
+    type(fdst_composition_moments) :: moments
+    real(c_double), allocatable, target :: y(:)
+    real(c_double), allocatable :: x(:), zones(:, :), zone_x(:, :)
+    integer(c_int32_t) :: known_z(4000), known_a(4000)
+    integer :: n_known, s, i, n, n_batch_calls
+    integer(c_int) :: ierr
+    integer(8) :: t0, t1, rate
+    real(8) :: moments_ns, x_ns, batch_ns
+
+    call find_known_species(known_z, known_a, n_known)
+
+    write(*, '(a8, 3a16)') 'species', 'moments ns', 'X ns', 'batch X/zone ns'
+    do s = 1, size(sizes)
+        n = min(sizes(s), n_known)
+        ierr = fdst_composition_create(known_z, known_a, int(n, c_size_t), comp)
+        if (ierr /= FDST_COMPOSITION_OK) then
+            write(error_unit, '(a)') fdst_composition_error_message()
+            error stop 1
+        end if
+
+        allocate(y(n), x(n), zones(n, n_zones), zone_x(n, n_zones))
+        y = 1.0d-3
+        zones = 1.0d-3
+        ierr = fdst_composition_bind(comp, y)
+
+        call system_clock(t0, rate)
+        do i = 1, n_iterations
+            ierr = fdst_composition_get_moments(comp, moments)
+        end do
+        call system_clock(t1)
+        moments_ns = real(t1 - t0, 8) * 1.0d9 / real(rate, 8) / real(n_iterations, 8)
+
+        call system_clock(t0)
+        do i = 1, n_iterations
+            ierr = fdst_composition_get_mass_fractions(comp, x)
+        end do
+        call system_clock(t1)
+        x_ns = real(t1 - t0, 8) * 1.0d9 / real(rate, 8) / real(n_iterations, 8)
+
+        ! As many zones as single calls above
+        n_batch_calls = ceiling(real(n_iterations, 8) / real(n_zones, 8))
+        call system_clock(t0)
+        do i = 1, n_batch_calls
+            ierr = fdst_composition_mass_fractions_batch(comp, zones, int(n_zones, c_size_t), int(n, c_size_t), zone_x)
+        end do
+        call system_clock(t1)
+        batch_ns = real(t1 - t0, 8) * 1.0d9 / real(rate, 8) / real(n_batch_calls * n_zones, 8)
+
+        write(*, '(i8, 3f16.1)') n, moments_ns, x_ns, batch_ns
+
+        call fdst_composition_destroy(comp)
+        deallocate(y, x, zones, zone_x)
+    end do
+
+contains
+
+    !> Collects the (Z, A) pairs known to the species database, lightest elements first.
+    subroutine find_known_species(z, a, n_found)
+        integer(c_int32_t), intent(out) :: z(:), a(:)
+        integer, intent(out) :: n_found
+        type(c_ptr) :: probe
+        integer(c_int32_t) :: zi, ai
+
+        n_found = 0
+        do zi = 0, 118
+            do ai = max(1, zi), 3 * zi + 10
+                if (n_found == size(z)) return
+                if (fdst_composition_create([zi], [ai], 1_c_size_t, probe) == FDST_COMPOSITION_OK) then
+                    n_found = n_found + 1
+                    z(n_found) = zi
+                    a(n_found) = ai
+                    call fdst_composition_destroy(probe)
+                end if
+            end do
+        end do
+    end subroutine find_known_species
+
+end program benchmark_composition_capi
@@ -12,7 +12,7 @@
 #include "benchmark_utils.h"
 
 
-std::chrono::duration<double, std::nano> build_and_hash_compositions(const size_t iter, const size_t nSpecies = 8) {
+std::chrono::duration<double, std::nano> build_and_hash_compositions(const size_t iter, PerfCounts& counts, const size_t nSpecies = 8) {
     using namespace fourdst::composition;
     using namespace fourdst::atomic;
 
@@ -27,13 +27,14 @@ std::chrono::duration<double, std::nano> build_and_hash_compositions(const size_
         count++;
     }
 
-    const auto duration = fdst_benchmark_function([&]() {
+    const auto [duration, callCounts] = fdst_benchmark_function_counted([&]() {
         for (size_t i = 0; i < iter; ++i) {
             uint64_t hashValue = utils::CompositionHash::hash_exact(comp);
             do_not_optimize(hashValue);
         }
     });
 
+    counts += callCounts;
     return duration / static_cast<double>(iter);
 }
 
@@ -45,9 +46,10 @@ int main() {
     const size_t nIterations = 1000;
     std::vector<double> durations;
     durations.resize(nIterations);
+    PerfCounts counts;
     for (size_t i = 0; i < nIterations; ++i) {
         std::print("Iteration {}/{}\r", i + 1, nIterations);
-        auto duration = build_and_hash_compositions(1000, 100);
+        auto duration = build_and_hash_compositions(1000, counts, 100);
         durations[i] = duration.count();
     }
     std::println("");
@@ -93,4 +95,5 @@ int main() {
         }
     }
     std::println("{}", plot_ascii_histogram(filtered_durations, "Build and Hash Composition Times (ns)"));
+    std::println("{}", format_perf_counts(counts, nIterations * 1000.0, "Hash Composition Counters"));
 }
\ No newline at end of file
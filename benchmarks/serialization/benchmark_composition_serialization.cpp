@@ -0,0 +1,174 @@
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/io/composition_text.h"
+#include "fourdst/composition/io/shared_composition_segment.h"
+#include "fourdst/composition/io/composition_pack.h"
+#include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species.h"
+
+#include <cstddef>
+#include <print>
+#include <vector>
+#include <ranges>
+#include <chrono>
+#include <string>
+
+#include <unistd.h>
+
+#include "benchmark_utils.h"
+
+namespace {
+    fourdst::composition::Composition build_composition(const size_t nSpecies) {
+        using namespace fourdst::composition;
+        using namespace fourdst::atomic;
+
+        Composition comp;
+        size_t count = 0;
+        for (const auto& sp : species | std::views::values) {
+            if (count >= nSpecies) {
+                break;
+            }
+            comp.registerSpecies(sp);
+            comp.setMolarAbundance(sp, 0.1 / static_cast<double>(count + 1));
+            count++;
+        }
+        return comp;
+    }
+
+    double megabytes_per_second(const size_t bytes, const std::chrono::nanoseconds duration) {
+        return static_cast<double>(bytes) * 1.0e3 / static_cast<double>(duration.count());
+    }
+
+    double gigabytes_per_second(const size_t bytes, const size_t iter, const std::chrono::nanoseconds duration) {
+        return static_cast<double>(bytes * iter) / static_cast<double>(duration.count()); // bytes per ns == GB/s
+    }
+}
+
+int main() {
+    using namespace fourdst::composition;
+
+    const size_t nIterations = 10000;
+    std::println("{:>8} {:>12} {:>16} {:>16} {:>16}", "species", "bytes", "serialize GB/s", "deserialize GB/s", "view GB/s");
+    for (const size_t nSpecies : {8, 32, 128, 512, 2048, 3500}) {
+        const Composition comp = build_composition(nSpecies);
+        std::vector<std::byte> buffer(io::serialized_size(comp));
+
+        const auto serializeDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                size_t written = io::serialize(comp, buffer);
+                do_not_optimize(written);
+            }
+        });
+
+        const auto deserializeDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                Composition restored = io::deserialize(buffer);
+                size_t n = restored.size();
+                do_not_optimize(n);
+            }
+        });
+
+        const auto viewDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                CompositionView view = io::deserialize_view(buffer);
+                size_t n = view.size();
+                do_not_optimize(n);
+            }
+        });
+
+        std::println("{:>8} {:>12} {:>16.3f} {:>16.3f} {:>16.3f}",
+                     comp.size(), buffer.size(),
+                     gigabytes_per_second(buffer.size(), nIterations, serializeDuration),
+                     gigabytes_per_second(buffer.size(), nIterations, deserializeDuration),
+                     gigabytes_per_second(buffer.size(), nIterations, viewDuration));
+    }
+
+    const size_t nZones = 1000;
+    std::println("");
+    std::println("{:>8} {:>8} {:>12} {:>16} {:>16} {:>10}", "zones", "species", "text bytes", "write MB/s", "parse MB/s", "bit-exact");
+    for (const size_t nSpecies : {8, 128, 512, 3500}) {
+        const std::vector<Composition> zones(nZones, build_composition(nSpecies));
+
+        std::string text;
+        const auto writeDuration = fdst_benchmark_function([&]() {
+            text = io::to_composition_text(zones);
+        });
+
+        std::vector<Composition> parsed;
+        const auto parseDuration = fdst_benchmark_function([&]() {
+            parsed = io::parse_composition_text(text);
+        });
+
+        const bool exact = parsed.size() == zones.size() &&
+            utils::CompositionHash::hash_exact(parsed.back()) == utils::CompositionHash::hash_exact(zones.back());
+        std::println("{:>8} {:>8} {:>12} {:>16.1f} {:>16.1f} {:>10}",
+                     nZones, zones.front().size(), text.size(),
+                     megabytes_per_second(text.size(), writeDuration),
+                     megabytes_per_second(text.size(), parseDuration),
+                     exact);
+    }
+
+    // Halo exchange loopback: pack a range of zones, unpack into existing ghost zones
+    const size_t nHaloZones = 16;
+    std::println("");
+    std::println("{:>8} {:>8} {:>14} {:>16} {:>16}", "zones", "species", "message bytes", "pack GB/s", "unpack GB/s");
+    for (const size_t nSpecies : {8, 128, 512, 3500}) {
+        const std::vector<Composition> halo(nHaloZones, build_composition(nSpecies));
+        std::vector<Composition> ghosts = halo;
+        std::vector<std::byte> message(io::packed_size(halo));
+        io::register_species_schema(halo.front().getRegisteredSpecies());
+
+        const auto packDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations / 10; ++i) {
+                size_t written = io::pack_into(halo, message);
+                do_not_optimize(written);
+            }
+        });
+
+        const auto unpackDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations / 10; ++i) {
+                io::unpack_into(message, ghosts);
+                double y = ghosts.back().getMolarAbundance(ghosts.back().getRegisteredSpecies().front());
+                do_not_optimize(y);
+            }
+        });
+
+        std::println("{:>8} {:>8} {:>14} {:>16.3f} {:>16.3f}",
+                     nHaloZones, nSpecies, message.size(),
+                     gigabytes_per_second(message.size(), nIterations / 10, packDuration),
+                     gigabytes_per_second(message.size(), nIterations / 10, unpackDuration));
+    }
+
+    // Worker startup: attach to a shared segment against rebuilding the zones from the text
+    std::println("");
+    std::println("{:>8} {:>8} {:>14} {:>16} {:>18}", "zones", "species", "segment bytes", "attach us", "attach+scan us");
+    for (const size_t nSpecies : {8, 128, 512, 3500}) {
+        const std::vector<Composition> zones(nZones, build_composition(nSpecies));
+        const std::string name = "/fdst_bench_" + std::to_string(::getpid());
+        const auto segment = io::SharedCompositionSegment::create(name, zones);
+
+        const auto attachDuration = fdst_benchmark_function([&]() {
+            const auto attached = io::SharedCompositionSegment::attach(name);
+            size_t n = attached.zone_count();
+            do_not_optimize(n);
+        });
+
+        const auto scanDuration = fdst_benchmark_function([&]() {
+            const auto attached = io::SharedCompositionSegment::attach(name);
+            double sum = 0.0;
+            for (size_t i = 0; i < attached.zone_count(); ++i) {
+                sum += attached.zone(i).getMeanParticleMass();
+            }
+            do_not_optimize(sum);
+        });
+
+        std::println("{:>8} {:>8} {:>14} {:>16.1f} {:>18.1f}",
+                     nZones, nSpecies, segment.size(),
+                     static_cast<double>(attachDuration.count()) / 1.0e3,
+                     static_cast<double>(scanDuration.count()) / 1.0e3);
+    }
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species.h"
+#include "fourdst/atomic/species_table.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <print>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.h"
+
+namespace {
+    using namespace fourdst::atomic;
+
+    struct Query {
+        std::string name;
+        std::vector<SpeciesPredicate> predicates;
+        std::function<bool(const Species&)> rowPredicate; ///< The same query, written against the species map
+    };
+
+    std::vector<Query> queries() {
+        constexpr double year = 3.15576e7;
+        return {
+            {"stable, Z <= 30", {atMost(SpeciesColumn::Z, 30), isStable()},
+                [](const Species& sp) { return sp.z() <= 30 && sp.halfLife() == std::numeric_limits<double>::infinity(); }},
+            {"t1/2 > 1 yr", {atLeast(SpeciesColumn::HALF_LIFE, year)},
+                [=](const Species& sp) { return sp.halfLife() >= year; }},
+            {"neutron rich Fe", {equalTo(SpeciesColumn::Z, 26), atLeast(SpeciesColumn::N, 31)},
+                [](const Species& sp) { return sp.z() == 26 && sp.n() >= 31; }},
+            {"50 < A < 100, Qb > 0", {between(SpeciesColumn::A, 51, 99), atLeast(SpeciesColumn::BETA_DECAY_ENERGY, 0.0)},
+                [](const Species& sp) { return sp.a() > 50 && sp.a() < 100 && sp.betaDecayEnergy() >= 0.0; }},
+        };
+    }
+}
+
+int main(const int argc, char** argv) {
+    const SpeciesTable& table = SpeciesTable::builtin();
+    const size_t nIterations = 2000;
+
+    std::println("{} species", table.size());
+    std::println("{:>24} {:>8} {:>16} {:>16} {:>10}", "query", "matches", "map scan (ns)", "table (ns)", "speedup");
+    for (const auto& [name, predicates, rowPredicate] : queries()) {
+        size_t matches = 0;
+        const auto scanDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                std::vector<const Species*> found;
+                for (const auto& sp : species | std::views::values) {
+                    if (rowPredicate(sp)) {
+                        found.push_back(&sp);
+                    }
+                }
+                matches = found.size();
+                do_not_optimize(matches);
+            }
+        });
+
+        const auto tableDuration = fdst_benchmark_function([&]() {
+            for (size_t i = 0; i < nIterations; ++i) {
+                std::vector<SpeciesId> ids = table.select(predicates);
+                size_t n = ids.size();
+                do_not_optimize(n);
+            }
+        });
+
+        const double scanNs = static_cast<double>(scanDuration.count()) / nIterations;
+        const double tableNs = static_cast<double>(tableDuration.count()) / nIterations;
+        std::println("{:>24} {:>8} {:>16.0f} {:>16.0f} {:>9.1f}x", name, matches, scanNs, tableNs, scanNs / tableNs);
+    }
+
+    // Runtime loading: species_table_bench <mass_1.mas20.txt> <nubase2020.asc>
+    if (argc == 3) {
+        const std::filesystem::path cachePath = std::filesystem::temp_directory_path() / "species_table_bench.fdsc";
+        size_t rows = 0;
+        const auto parseDuration = fdst_benchmark_function([&]() {
+            const SpeciesTable loaded = SpeciesTable::load(argv[1], argv[2]);
+            rows = loaded.size();
+            loaded.writeCache(cachePath);
+        });
+        const auto cacheDuration = fdst_benchmark_function([&]() {
+            const SpeciesTable cached = SpeciesTable::loadCache(cachePath);
+            size_t n = cached.size();
+            do_not_optimize(n);
+        });
+        std::filesystem::remove(cachePath);
+        std::println("\nloaded {} species: parse + write cache {:.2f} ms, load cache {:.2f} ms",
+            rows, static_cast<double>(parseDuration.count()) / 1e6, static_cast<double>(cacheDuration.count()) / 1e6);
+    }
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <elf.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+ * Startup cost of executables built from 1, 10 and 50 translation units which include the
+ * species headers (see meson.build). For each executable this reports
+ *  - time to main: from spawning the process to main being entered, i.e. exec, dynamic loading
+ *    and every static initialiser, as the median and minimum over several runs;
+ *  - the operator new bytes and calls made before main;
+ *  - the sizes of the sections holding code and static data.
+ *
+ * Heap bytes before main and the loaded size (.text + .rodata + .data + .init_array) are
+ * checked against per translation unit budgets, so a change to the representation of the
+ * species data which makes startup worse fails `meson benchmark`. So does an executable whose
+ * ELF section headers cannot be read, rather than passing with sizes of zero. The file size is
+ * reported only, since it includes debug information and so depends on the build type. Times
+ * vary with the machine and are reported only.
+ *
+ * Usage: startup_bench [--runs=N] [--heap-budget-per-tu=BYTES] [--size-budget-per-tu=BYTES] --tus=N PATH...
+ */
+
+extern char** environ;
+
+namespace {
+    struct StartupSample {
+        std::int64_t timeToMainNs;
+        std::size_t heapBytes;
+        std::size_t allocations;
+    };
+
+    std::int64_t monotonic_ns() {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<std::int64_t>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+    }
+
+    // Runs the executable once; it prints the monotonic time at which its main was entered
+    StartupSample run_once(const std::string& path) {
+        int fds[2];
+        if (pipe(fds) != 0) {
+            throw std::runtime_error("pipe() failed");
+        }
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+        posix_spawn_file_actions_addclose(&actions, fds[0]);
+
+        char* argv[] = {const_cast<char*>(path.c_str()), nullptr};
+        pid_t pid = 0;
+        const std::int64_t spawned = monotonic_ns();
+        const int error = posix_spawn(&pid, path.c_str(), &actions, nullptr, argv, environ);
+        posix_spawn_file_actions_destroy(&actions);
+        close(fds[1]);
+        if (error != 0) {
+            close(fds[0]);
+            throw std::runtime_error("Cannot run " + path + ": " + std::strerror(error));
+        }
+
+        std::string output;
+        char buffer[256];
+        for (ssize_t n; (n = read(fds[0], buffer, sizeof(buffer))) > 0;) {
+            output.append(buffer, static_cast<std::size_t>(n));
+        }
+        close(fds[0]);
+        int status = 0;
+        waitpid(pid, &status, 0);
+
+        long long atMain = 0;
+        StartupSample sample{};
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0
+            || std::sscanf(output.c_str(), "%lld %zu %zu", &atMain, &sample.heapBytes, &sample.allocations) != 3) {
+            throw std::runtime_error(path + " did not report its startup");
+        }
+        sample.timeToMainNs = atMain - spawned;
+        return sample;
+    }
+
+    struct SectionSizes {
+        std::size_t text = 0;
+        std::size_t rodata = 0;
+        std::size_t data = 0; ///< .data and .data.rel.ro
+        std::size_t bss = 0;
+        std::size_t initArray = 0;
+        std::size_t file = 0;
+
+        // Sections mapped from the file at startup; .bss takes no space in the file
+        [[nodiscard]] std::size_t loaded() const noexcept { return text + rodata + data + initArray; }
+    };
+
+    // std::nullopt unless the file is a 64-bit ELF image whose section headers lie within it
+    std::optional<SectionSizes> section_sizes(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        const std::vector<char> image{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        SectionSizes sizes;
+        sizes.file = image.size();
+
+        Elf64_Ehdr header{};
+        if (image.size() < sizeof(header) || std::memcmp(image.data(), ELFMAG, SELFMAG) != 0 || image[EI_CLASS] != ELFCLASS64) {
+            return std::nullopt;
+        }
+        std::memcpy(&header, image.data(), sizeof(header));
+        if (header.e_shoff + header.e_shnum * sizeof(Elf64_Shdr) > image.size() || header.e_shstrndx >= header.e_shnum) {
+            return std::nullopt;
+        }
+        const auto section = [&](const std::size_t i) {
+            Elf64_Shdr s{};
+            std::memcpy(&s, image.data() + header.e_shoff + i * sizeof(Elf64_Shdr), sizeof(s));
+            return s;
+        };
+        const Elf64_Shdr names = section(header.e_shstrndx);
+        for (std::size_t i = 0; i < header.e_shnum; ++i) {
+            const Elf64_Shdr s = section(i);
+            if (names.sh_offset + s.sh_name >= image.size()) {
+                continue;
+            }
+            const std::string_view name(image.data() + names.sh_offset + s.sh_name);
+            if (name == ".text") sizes.text += s.sh_size;
+            else if (name == ".rodata") sizes.rodata += s.sh_size;
+            else if (name == ".data" || name == ".data.rel.ro") sizes.data += s.sh_size;
+            else if (name == ".bss") sizes.bss += s.sh_size;
+            else if (name == ".init_array") sizes.initArray += s.sh_size;
+        }
+        return sizes;
+    }
+
+    std::size_t parse_size(const std::string_view text) {
+        std::size_t value = 0;
+        const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            throw std::invalid_argument("Not a number: " + std::string(text));
+        }
+        return value;
+    }
+}
+
+int main(const int argc, char** argv) {
+    std::size_t runs = 20;
+    std::size_t heapBudgetPerTu = 0; // 0 disables the budget
+    std::size_t sizeBudgetPerTu = 0;
+    std::size_t nextTus = 1;
+    std::vector<std::pair<std::size_t, std::string>> executables;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg.starts_with("--runs=")) {
+            runs = std::max<std::size_t>(1, parse_size(arg.substr(7)));
+        } else if (arg.starts_with("--heap-budget-per-tu=")) {
+            heapBudgetPerTu = parse_size(arg.substr(21));
+        } else if (arg.starts_with("--size-budget-per-tu=")) {
+            sizeBudgetPerTu = parse_size(arg.substr(21));
+        } else if (arg.starts_with("--tus=")) {
+            nextTus = std::max<std::size_t>(1, parse_size(arg.substr(6)));
+        } else if (!arg.starts_with("--")) {
+            executables.emplace_back(nextTus, std::string(arg));
+        } else {
+            std::println(stderr, "Usage: {} [--runs=N] [--heap-budget-per-tu=BYTES] [--size-budget-per-tu=BYTES] --tus=N PATH...", argv[0]);
+            return 2;
+        }
+    }
+
+    bool withinBudget = true;
+    std::println("{:>4} {:>14} {:>14} {:>14} {:>10} {:>12} {:>12} {:>12} {:>10} {:>12} {:>12}",
+        "TUs", "median (us)", "min (us)", "heap (bytes)", "allocs", "file", ".text", ".rodata", ".data", ".bss", ".init_array");
+    for (const auto& [tus, path] : executables) {
+        std::vector<StartupSample> samples;
+        samples.reserve(runs);
+        for (std::size_t r = 0; r < runs; ++r) {
+            samples.push_back(run_once(path));
+        }
+        std::ranges::sort(samples, {}, &StartupSample::timeToMainNs);
+        const StartupSample& median = samples[samples.size() / 2];
+        const std::optional<SectionSizes> read = section_sizes(path);
+        if (!read) {
+            std::println(stderr, "{}: not a readable 64-bit ELF executable; cannot check its size", path);
+            withinBudget = false;
+        }
+        const SectionSizes sizes = read.value_or(SectionSizes{});
+        std::println("{:>4} {:>14.1f} {:>14.1f} {:>14} {:>10} {:>12} {:>12} {:>12} {:>10} {:>12} {:>12}",
+            tus, median.timeToMainNs / 1.0e3, samples.front().timeToMainNs / 1.0e3, median.heapBytes, median.allocations,
+            sizes.file, sizes.text, sizes.rodata, sizes.data, sizes.bss, sizes.initArray);
+
+        if (heapBudgetPerTu != 0 && median.heapBytes > heapBudgetPerTu * tus) {
+            std::println(stderr, "{} TUs: {} heap bytes before main exceed the budget of {}", tus, median.heapBytes, heapBudgetPerTu * tus);
+            withinBudget = false;
+        }
+        if (read && sizeBudgetPerTu != 0 && sizes.loaded() > sizeBudgetPerTu * tus) {
+            std::println(stderr, "{} TUs: loaded size {} exceeds the budget of {}", tus, sizes.loaded(), sizeBudgetPerTu * tus);
+            withinBudget = false;
+        }
+    }
+    return withinBudget ? 0 : 1;
+}
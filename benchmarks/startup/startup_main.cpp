@@ -0,0 +1,43 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+/*
+ * Entry point of the startup benchmark executables. The translation units linked alongside it
+ * include the species headers, whose static objects are built before main. This file counts
+ * every operator new allocation made until main is entered and reports, on one stdout line,
+ * the CLOCK_MONOTONIC time at which main was reached and the heap use up to that point.
+ */
+
+namespace {
+    // Zero-initialised, so they are ready before any dynamic initialiser allocates
+    std::size_t g_allocatedBytes;
+    std::size_t g_allocations;
+
+    void* counted_allocate(const std::size_t size) {
+        g_allocatedBytes += size;
+        ++g_allocations;
+        if (void* p = std::malloc(size == 0 ? 1 : size)) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(const std::size_t size) { return counted_allocate(size); }
+void* operator new[](const std::size_t size) { return counted_allocate(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+int main() {
+    timespec now{};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    const std::size_t bytes = g_allocatedBytes;
+    const std::size_t allocations = g_allocations;
+    std::printf("%lld %zu %zu\n", static_cast<long long>(now.tv_sec) * 1000000000LL + now.tv_nsec, bytes, allocations);
+    return 0;
+}
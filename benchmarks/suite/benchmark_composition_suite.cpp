@@ -0,0 +1,392 @@
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/decorators/composition_masked.h"
+#include "fourdst/composition/io/standard_compositions.h"
+#include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/utils/utils.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/*
+ * Parametrised benchmarks of the public Composition API. Every benchmark taking a species count
+ * runs over the first N species of the builtin table, in (Z, A) order, so runs are comparable
+ * between builds. Items processed are species touched, so the reported rate is per species.
+ *
+ * Run with --benchmark_format=json (or `meson benchmark`, which writes composition_suite.json)
+ * and compare two runs with Google Benchmark's tools/compare.py.
+ */
+
+namespace {
+    using fourdst::atomic::Species;
+    using fourdst::atomic::SpeciesId;
+    using fourdst::atomic::SpeciesTable;
+    using fourdst::composition::Composition;
+    using fourdst::composition::MaskedComposition;
+
+    void species_sweep(benchmark::internal::Benchmark* b) {
+        for (const std::int64_t n : {8, 32, 128, 512, 2048, 3500}) {
+            b->Arg(n);
+        }
+    }
+
+    std::vector<Species> first_species(const std::int64_t n) {
+        std::vector<SpeciesId> ids(static_cast<std::size_t>(n));
+        std::iota(ids.begin(), ids.end(), SpeciesId{0});
+        return SpeciesTable::builtin().species(ids);
+    }
+
+    std::vector<std::string> symbols_of(const std::vector<Species>& species) {
+        std::vector<std::string> symbols;
+        symbols.reserve(species.size());
+        for (const auto& sp : species) {
+            symbols.emplace_back(sp.name());
+        }
+        return symbols;
+    }
+
+    std::vector<double> abundances(const std::size_t n) {
+        std::vector<double> y(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = 1.0e-3 / static_cast<double>(i + 1);
+        }
+        return y;
+    }
+
+    Composition populated(const std::int64_t n) {
+        const std::vector<Species> species = first_species(n);
+        return {species, abundances(species.size())};
+    }
+
+    template <typename Container>
+    Container make_input(const std::vector<Species>& species) {
+        const std::vector<std::string> symbols = symbols_of(species);
+        const std::vector<double> y = abundances(species.size());
+        Container input;
+        for (std::size_t i = 0; i < species.size(); ++i) {
+            if constexpr (requires { typename Container::mapped_type; }) {
+                if constexpr (std::is_same_v<typename Container::key_type, Species>) {
+                    input.emplace(species[i], y[i]);
+                } else {
+                    input.emplace(symbols[i], y[i]);
+                }
+            } else if constexpr (std::is_same_v<typename Container::value_type, Species>) {
+                input.insert(input.end(), species[i]);
+            } else {
+                input.insert(input.end(), symbols[i]);
+            }
+        }
+        return input;
+    }
+
+    // Construction from every container type Composition accepts
+
+    template <typename Container>
+    void BM_Construct(benchmark::State& state) {
+        const Container input = make_input<Container>(first_species(state.range(0)));
+        for (auto _ : state) {
+            Composition comp(input);
+            benchmark::DoNotOptimize(comp);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_TEMPLATE(BM_Construct, std::vector<Species>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::vector<std::string>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::set<Species>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::set<std::string>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::unordered_set<Species>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::unordered_set<std::string>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::map<Species, double>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::map<std::string, double>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::unordered_map<Species, double>)->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_Construct, std::unordered_map<std::string, double>)->Apply(species_sweep);
+
+    void BM_ConstructWithAbundances(benchmark::State& state) {
+        const std::vector<Species> species = first_species(state.range(0));
+        const std::vector<double> y = abundances(species.size());
+        for (auto _ : state) {
+            Composition comp(species, y);
+            benchmark::DoNotOptimize(comp);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_ConstructWithAbundances)->Apply(species_sweep);
+
+    void BM_Copy(benchmark::State& state) {
+        const Composition comp = populated(state.range(0));
+        for (auto _ : state) {
+            Composition copy(comp);
+            benchmark::DoNotOptimize(copy);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Copy)->Apply(species_sweep);
+
+    // Single species access; every iteration touches every registered species once
+
+    void BM_SetMolarAbundanceSpecies(benchmark::State& state) {
+        Composition comp = populated(state.range(0));
+        const std::vector<Species> species = first_species(state.range(0));
+        double y = 1.0e-4;
+        for (auto _ : state) {
+            for (const auto& sp : species) {
+                comp.setMolarAbundance(sp, y);
+            }
+            y *= 1.0000001;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SetMolarAbundanceSpecies)->Apply(species_sweep);
+
+    void BM_SetMolarAbundanceSymbol(benchmark::State& state) {
+        Composition comp = populated(state.range(0));
+        const std::vector<std::string> symbols = symbols_of(first_species(state.range(0)));
+        double y = 1.0e-4;
+        for (auto _ : state) {
+            for (const std::string_view symbol : symbols) {
+                comp.setMolarAbundance(symbol, y);
+            }
+            y *= 1.0000001;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SetMolarAbundanceSymbol)->Apply(species_sweep);
+
+    template <auto Getter>
+    void BM_GetBySpecies(benchmark::State& state) {
+        const Composition comp = populated(state.range(0));
+        const std::vector<Species> species = first_species(state.range(0));
+        for (auto _ : state) {
+            double sum = 0.0;
+            for (const auto& sp : species) {
+                sum += (comp.*Getter)(sp);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    constexpr double (Composition::*kMolarAbundanceOf)(const Species&) const = &Composition::getMolarAbundance;
+    constexpr double (Composition::*kMassFractionOf)(const Species&) const = &Composition::getMassFraction;
+    constexpr double (Composition::*kNumberFractionOf)(const Species&) const = &Composition::getNumberFraction;
+    BENCHMARK_TEMPLATE(BM_GetBySpecies, kMolarAbundanceOf)->Name("BM_GetMolarAbundanceSpecies")->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_GetBySpecies, kMassFractionOf)->Name("BM_GetMassFractionSpecies")->Apply(species_sweep);
+    BENCHMARK_TEMPLATE(BM_GetBySpecies, kNumberFractionOf)->Name("BM_GetNumberFractionSpecies")->Apply(species_sweep);
+
+    void BM_GetMolarAbundanceSymbol(benchmark::State& state) {
+        const Composition comp = populated(state.range(0));
+        const std::vector<std::string> symbols = symbols_of(first_species(state.range(0)));
+        for (auto _ : state) {
+            double sum = 0.0;
+            for (const std::string_view symbol : symbols) {
+                sum += comp.getMolarAbundance(symbol);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_GetMolarAbundanceSymbol)->Apply(species_sweep);
+
+    void BM_Contains(benchmark::State& state) {
+        const Composition comp = populated(state.range(0));
+        const std::vector<Species> species = first_species(state.range(0));
+        for (auto _ : state) {
+            std::size_t found = 0;
+            for (const auto& sp : species) {
+                found += comp.contains(sp);
+            }
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_Contains)->Apply(species_sweep);
+
+    // Bulk access
+
+    void BM_SetMolarAbundanceBulk(benchmark::State& state) {
+        Composition comp = populated(state.range(0));
+        const std::vector<Species> species = first_species(state.range(0));
+        std::vector<double> y = abundances(species.size());
+        for (auto _ : state) {
+            comp.setMolarAbundance(species, y);
+            y.front() *= 1.0000001;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_SetMolarAbundanceBulk)->Apply(species_sweep);
+
+    /*
+     * Whole-composition queries. Each iteration first changes one abundance, as a zone update
+     * would, so the cached result of the previous iteration is not simply returned.
+     */
+    template <typename Query>
+    void run_query(benchmark::State& state, Query&& query) {
+        Composition comp = populated(state.range(0));
+        const Species first = comp.getSpeciesAtIndex(0);
+        double y = comp.getMolarAbundance(first);
+        for (auto _ : state) {
+            y *= 1.0000001;
+            comp.setMolarAbundance(first, y);
+            auto result = query(comp);
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_GetMolarAbundanceVector(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getMolarAbundanceVector(); });
+    }
+    void BM_GetMassFractionVector(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getMassFractionVector(); });
+    }
+    void BM_GetNumberFractionVector(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getNumberFractionVector(); });
+    }
+    void BM_GetMassFractionMap(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getMassFraction(); });
+    }
+    void BM_GetNumberFractionMap(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getNumberFraction(); });
+    }
+    void BM_GetRegisteredSymbols(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getRegisteredSymbols(); });
+    }
+    BENCHMARK(BM_GetMolarAbundanceVector)->Apply(species_sweep);
+    BENCHMARK(BM_GetMassFractionVector)->Apply(species_sweep);
+    BENCHMARK(BM_GetNumberFractionVector)->Apply(species_sweep);
+    BENCHMARK(BM_GetMassFractionMap)->Apply(species_sweep);
+    BENCHMARK(BM_GetNumberFractionMap)->Apply(species_sweep);
+    BENCHMARK(BM_GetRegisteredSymbols)->Apply(species_sweep);
+
+    // Derived quantities
+
+    void BM_GetMeanParticleMass(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getMeanParticleMass(); });
+    }
+    void BM_GetElectronAbundance(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getElectronAbundance(); });
+    }
+    void BM_GetCanonicalComposition(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return comp.getCanonicalComposition(); });
+    }
+    BENCHMARK(BM_GetMeanParticleMass)->Apply(species_sweep);
+    BENCHMARK(BM_GetElectronAbundance)->Apply(species_sweep);
+    BENCHMARK(BM_GetCanonicalComposition)->Apply(species_sweep);
+
+    void BM_GetMeanParticleMassCached(benchmark::State& state) {
+        const Composition comp = populated(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(comp.getMeanParticleMass());
+        }
+    }
+    BENCHMARK(BM_GetMeanParticleMassCached)->Apply(species_sweep);
+
+    // MaskedComposition over every other species of the base composition
+
+    std::vector<Species> every_other(const std::vector<Species>& species) {
+        std::vector<Species> active;
+        for (std::size_t i = 0; i < species.size(); i += 2) {
+            active.push_back(species[i]);
+        }
+        return active;
+    }
+
+    void BM_MaskedConstruct(benchmark::State& state) {
+        const Composition base = populated(state.range(0));
+        const std::vector<Species> active = every_other(first_species(state.range(0)));
+        for (auto _ : state) {
+            MaskedComposition masked(base, active);
+            benchmark::DoNotOptimize(masked);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_MaskedConstruct)->Apply(species_sweep);
+
+    void BM_MaskedGetMassFraction(benchmark::State& state) {
+        const Composition base = populated(state.range(0));
+        const std::vector<Species> active = every_other(first_species(state.range(0)));
+        const MaskedComposition masked(base, active);
+        for (auto _ : state) {
+            double sum = 0.0;
+            for (const auto& sp : active) {
+                sum += masked.getMassFraction(sp);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(active.size()));
+    }
+    BENCHMARK(BM_MaskedGetMassFraction)->Apply(species_sweep);
+
+    void BM_MaskedDerived(benchmark::State& state) {
+        const Composition base = populated(state.range(0));
+        const MaskedComposition masked(base, every_other(first_species(state.range(0))));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(masked.getMeanParticleMass());
+            benchmark::DoNotOptimize(masked.getElectronAbundance());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_MaskedDerived)->Apply(species_sweep);
+
+    // Builders
+
+    void BM_BuildFromMassFractionsSpecies(benchmark::State& state) {
+        const std::vector<Species> species = first_species(state.range(0));
+        const std::vector<double> x(species.size(), 1.0 / static_cast<double>(species.size()));
+        for (auto _ : state) {
+            Composition comp = fourdst::composition::buildCompositionFromMassFractions(species, x);
+            benchmark::DoNotOptimize(comp);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_BuildFromMassFractionsSpecies)->Apply(species_sweep);
+
+    void BM_BuildFromMassFractionsSymbols(benchmark::State& state) {
+        const std::vector<std::string> symbols = symbols_of(first_species(state.range(0)));
+        const std::vector<std::string_view> views(symbols.begin(), symbols.end());
+        const std::vector<double> x(symbols.size(), 1.0 / static_cast<double>(symbols.size()));
+        for (auto _ : state) {
+            Composition comp = fourdst::composition::buildCompositionFromMassFractions(std::span(views), std::span(x));
+            benchmark::DoNotOptimize(comp);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_BuildFromMassFractionsSymbols)->Apply(species_sweep);
+
+    void BM_GetCompositionRecord(benchmark::State& state) {
+        using namespace fourdst::composition;
+        for (auto _ : state) {
+            Composition comp = get_composition_record(io::SolarCompositions::AAG21_photospheric, io::IsotopicPercentages::L09, 0.014, 0.27);
+            benchmark::DoNotOptimize(comp);
+        }
+    }
+    BENCHMARK(BM_GetCompositionRecord);
+
+    // Hashing
+
+    void BM_HashExact(benchmark::State& state) {
+        run_query(state, [](const Composition& comp) { return fourdst::composition::utils::CompositionHash::hash_exact(comp); });
+    }
+    BENCHMARK(BM_HashExact)->Apply(species_sweep);
+
+    void BM_HashCached(benchmark::State& state) {
+        const Composition comp = populated(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(comp.hash());
+        }
+    }
+    BENCHMARK(BM_HashCached)->Apply(species_sweep);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,160 @@
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species.h"
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/atomic/nuclide_symbol.h"
+#include "fourdst/atomic/species_literals.h"
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/utils/utils.h"
+
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <format>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark_utils.h"
+
+namespace {
+    using fourdst::atomic::Species;
+
+    /**
+     * Abundance deck of `lines` "<symbol> <molar abundance>" lines cycling through `symbols`.
+     */
+    std::string make_deck(const std::vector<std::string>& symbols, const size_t lines) {
+        std::string deck;
+        for (size_t i = 0; i < lines; ++i) {
+            deck += std::format("{} {:.6e}\n", symbols[i % symbols.size()], 1.0e-6 * static_cast<double>(i + 1));
+        }
+        return deck;
+    }
+
+    /**
+     * Splits the deck into (symbol, abundance) pairs and hands them to `apply`, without copying the symbols.
+     */
+    template <typename Apply>
+    void parse_deck(const std::string_view deck, Apply&& apply) {
+        size_t pos = 0;
+        while (pos < deck.size()) {
+            const size_t blank = deck.find(' ', pos);
+            const size_t newline = deck.find('\n', blank);
+            double y = 0.0;
+            std::from_chars(deck.data() + blank + 1, deck.data() + newline, y);
+            apply(deck.substr(pos, blank - pos), y);
+            pos = newline + 1;
+        }
+    }
+}
+
+int main() {
+    constexpr size_t nLines = 10000;
+    constexpr size_t nSymbols = 256;
+    constexpr size_t nIterations = 50;
+
+    std::vector<std::string> symbols;
+    std::vector<Species> registered;
+    for (const auto& [name, sp] : fourdst::atomic::species) {
+        if (symbols.size() == nSymbols) {
+            break;
+        }
+        symbols.push_back(name);
+        registered.push_back(sp);
+    }
+    const std::string deck = make_deck(symbols, nLines);
+    fourdst::composition::Composition comp(registered);
+
+    // What every line cost before the string_view overloads: a std::string per call, a contains()
+    // probe followed by an at() probe, and a copy of the species
+    const auto stringDuration = fdst_benchmark_function([&]() {
+        for (size_t i = 0; i < nIterations; ++i) {
+            parse_deck(deck, [&](const std::string_view token, const double y) {
+                const std::string symbol(token);
+                if (!fourdst::atomic::species.contains(symbol)) {
+                    throw std::runtime_error("unknown symbol " + symbol);
+                }
+                const Species sp = fourdst::atomic::species.at(symbol);
+                comp.setMolarAbundance(sp, y);
+            });
+        }
+    });
+
+    const auto viewDuration = fdst_benchmark_function([&]() {
+        for (size_t i = 0; i < nIterations; ++i) {
+            parse_deck(deck, [&](const std::string_view token, const double y) {
+                comp.setMolarAbundance(token, y);
+            });
+        }
+    });
+
+    double total = 0.0;
+    const auto containsDuration = fdst_benchmark_function([&]() {
+        for (size_t i = 0; i < nIterations; ++i) {
+            parse_deck(deck, [&](const std::string_view token, const double y) {
+                if (comp.contains(token)) {
+                    total += y;
+                }
+            });
+        }
+    });
+    do_not_optimize(total);
+
+    // The same deck in the lower case, dashless spelling of reaction libraries ("fe56")
+    std::vector<std::string> librarySymbols;
+    for (const auto& symbol : symbols) {
+        std::string spelled;
+        for (const char c : symbol) {
+            if (c != '-') {
+                spelled += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+        }
+        librarySymbols.push_back(spelled);
+    }
+    const std::string libraryDeck = make_deck(librarySymbols, nLines);
+    const fourdst::atomic::SpeciesTable& table = fourdst::atomic::SpeciesTable::builtin();
+    size_t resolved = 0;
+    const auto nuclideDuration = fdst_benchmark_function([&]() {
+        for (size_t i = 0; i < nIterations; ++i) {
+            parse_deck(libraryDeck, [&](const std::string_view token, double) {
+                resolved += table.findNuclide(token).has_value();
+            });
+        }
+    });
+    do_not_optimize(resolved);
+
+    // A hot loop naming its species: by symbol, paying a lookup per call, and by a compile-time literal
+    using namespace fourdst::atomic::literals;
+    comp.registerSpecies({"He-4"_sp, "C-12"_sp, "O-16"_sp});
+    double byName = 0.0;
+    const auto byNameDuration = fdst_benchmark_function([&]() {
+        for (size_t i = 0; i < nIterations * nLines; ++i) {
+            byName += comp.getMolarAbundance("He-4") + comp.getMolarAbundance("C-12") + comp.getMolarAbundance("O-16");
+        }
+    });
+    do_not_optimize(byName);
+    double byLiteral = 0.0;
+    const auto byLiteralDuration = fdst_benchmark_function([&]() {
+        for (size_t i = 0; i < nIterations * nLines; ++i) {
+            byLiteral += comp.getMolarAbundance("He-4"_sp) + comp.getMolarAbundance("C-12"_sp) + comp.getMolarAbundance("O-16"_sp);
+        }
+    });
+    do_not_optimize(byLiteral);
+
+    const double stringNs = static_cast<double>(stringDuration.count()) / (nIterations * nLines);
+    const double viewNs = static_cast<double>(viewDuration.count()) / (nIterations * nLines);
+    const double containsNs = static_cast<double>(containsDuration.count()) / (nIterations * nLines);
+    std::println("{} line deck over {} symbols", nLines, nSymbols);
+    std::println("{:>40} {:>10.1f} ns/line", "setMolarAbundance(std::string), 2 probes", stringNs);
+    std::println("{:>40} {:>10.1f} ns/line ({:.1f}x)", "setMolarAbundance(std::string_view)", viewNs, stringNs / viewNs);
+    std::println("{:>40} {:>10.1f} ns/line", "contains(std::string_view)", containsNs);
+    const double nuclideNs = static_cast<double>(nuclideDuration.count()) / (nIterations * nLines);
+    std::println("{:>40} {:>10.1f} ns/line ({:.1f} M symbols/s, {} of {} resolved)", "SpeciesTable::findNuclide(\"fe56\")",
+        nuclideNs, 1.0e3 / nuclideNs, resolved, nIterations * nLines);
+    const double byNameNs = static_cast<double>(byNameDuration.count()) / (3 * nIterations * nLines);
+    const double byLiteralNs = static_cast<double>(byLiteralDuration.count()) / (3 * nIterations * nLines);
+    std::println("{:>40} {:>10.1f} ns/call", "getMolarAbundance(\"He-4\")", byNameNs);
+    std::println("{:>40} {:>10.1f} ns/call ({:.1f}x)", "getMolarAbundance(\"He-4\"_sp)", byLiteralNs, byNameNs / byLiteralNs);
+    return 0;
+}
@@ -0,0 +1,319 @@
+#define FDST_DEFINE_COUNTING_OPERATOR_NEW
+#include "allocation_counter.h"
+#include "benchmark_utils.h"
+
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/composition/c/composition_c.h"
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/utils/composition_hash.h"
+
+#include <algorithm>
+#include <barrier>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <print>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+ * Throughput of zone updates on 1..N threads, each started with std::jthread. One update sets
+ * every abundance of a zone and then queries the mean particle mass, Ye, X/Y/Z and the hash of
+ * the zone, which is the loop of a network step writing back into the composition. Variants:
+ *  - private:            every thread owns Composition objects for its zones;
+ *  - private+allocating: as private, plus one getMolarAbundanceVector() per update, so the
+ *                        difference in efficiency is the cost of sharing the allocator;
+ *  - shared const:       every thread reads the same const solar compositions;
+ *  - batch:              every thread owns a zone-major abundance array, evaluated with the
+ *                        C batch calls on one shared handle and hashed through CompositionView.
+ *
+ * Composition::hash() and the vector getters fill a mutable cache, so they are not safe on a
+ * composition read by several threads. The shared variant uses only the getters which do not
+ * touch the cache, and CompositionHash::hash_exact.
+ *
+ * For every variant and thread count this reports updates per second, the scaling efficiency
+ * T(n) / (n T(1)), and the operator new calls and bytes per update; an efficiency which falls
+ * only for the allocating variant points at allocator contention.
+ *
+ * Usage: thread_scaling_bench [--max-threads=N] [--species=N] [--zones=N] [--updates=N]
+ */
+
+namespace {
+    using fourdst::atomic::Species;
+    using fourdst::composition::Composition;
+    using fourdst::composition::CompositionView;
+    using fourdst::composition::utils::CompositionHash;
+
+    struct ScalingOptions {
+        std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+        std::size_t species = 128;
+        std::size_t zones = 16; ///< Zones owned by each thread.
+        std::size_t updates = 2000; ///< Zone updates made by each thread.
+    };
+
+    struct ThreadResult {
+        std::size_t updates = 0;
+        AllocationCounts counts{};
+        double sink = 0.0;
+    };
+
+    struct CanonicalFractions {
+        double x;
+        double y;
+        double z;
+    };
+
+    // X, Y and Z in one pass over the abundances, without the cache of getCanonicalComposition()
+    template <typename CompositionT>
+    CanonicalFractions canonical_fractions(const CompositionT& comp) {
+        double hydrogen = 0.0;
+        double helium = 0.0;
+        double total = 0.0;
+        for (const auto& [sp, y] : comp) {
+            const double mass = y * sp.mass();
+            total += mass;
+            if (sp.z() == 1) {
+                hydrogen += mass;
+            } else if (sp.z() == 2) {
+                helium += mass;
+            }
+        }
+        return {hydrogen / total, helium / total, (total - hydrogen - helium) / total};
+    }
+
+    // Abundance of species `i` in update `step` of zone `zone`; varies so no query can be cached
+    double abundance(const std::size_t i, const std::size_t zone, const std::size_t step) {
+        return 1.0e-3 * (1.0 + 1.0e-3 * static_cast<double>((i + zone + step) % 97));
+    }
+
+    // Shared, read-only state of one variant
+    struct ScalingFixture {
+        explicit ScalingFixture(const std::size_t n)
+            : schema(std::make_shared<const std::vector<Species>>([n] {
+                  std::vector<fourdst::atomic::SpeciesId> ids(n);
+                  std::iota(ids.begin(), ids.end(), fourdst::atomic::SpeciesId{0});
+                  const auto species = fourdst::atomic::SpeciesTable::builtin().species(ids);
+                  // Composition order, which CompositionView and the C handle are given in
+                  return Composition(species).getRegisteredSpecies();
+              }())) {
+            for (std::size_t k = 0; k < 4; ++k) {
+                std::vector<double> y(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    y[i] = abundance(i, k, 0);
+                }
+                solar.emplace_back(*schema, y);
+            }
+
+            std::vector<int32_t> z;
+            std::vector<int32_t> a;
+            for (const Species& sp : *schema) {
+                z.push_back(static_cast<int32_t>(sp.z()));
+                a.push_back(static_cast<int32_t>(sp.a()));
+            }
+            fdst_composition* created = nullptr;
+            if (fdst_composition_create(z.data(), a.data(), z.size(), &created) != FDST_COMPOSITION_OK) {
+                throw std::runtime_error(std::string("fdst_composition_create failed: ") + fdst_composition_last_error());
+            }
+            handle.reset(created);
+        }
+
+        std::shared_ptr<const std::vector<Species>> schema;
+        std::vector<Composition> solar; ///< Read by every thread of the shared variant.
+        std::unique_ptr<fdst_composition, decltype(&fdst_composition_destroy)> handle{nullptr, &fdst_composition_destroy};
+    };
+
+    ThreadResult run_private(const ScalingFixture& fixture, const ScalingOptions& options, const bool allocating, std::barrier<>& start) {
+        const std::vector<Species>& species = *fixture.schema;
+        std::vector<Composition> zones(options.zones, Composition(species, std::vector<double>(species.size(), 1.0e-3)));
+        ThreadResult result;
+        start.arrive_and_wait();
+
+        AllocationScope scope;
+        for (std::size_t step = 0; step < options.updates; ++step) {
+            const std::size_t zone = step % zones.size();
+            Composition& comp = zones[zone];
+            for (std::size_t i = 0; i < species.size(); ++i) {
+                comp.setMolarAbundance(species[i], abundance(i, zone, step));
+            }
+            const CanonicalFractions xyz = canonical_fractions(comp);
+            result.sink += comp.getMeanParticleMass() + comp.getElectronAbundance() + xyz.x + xyz.y + xyz.z
+                + static_cast<double>(comp.hash() & 0xff);
+            if (allocating) {
+                result.sink += comp.getMolarAbundanceVector().back();
+            }
+        }
+        result.counts = scope.counts();
+        result.updates = options.updates;
+        return result;
+    }
+
+    ThreadResult run_shared(const ScalingFixture& fixture, const ScalingOptions& options, std::barrier<>& start) {
+        const Species& probe = fixture.schema->at(fixture.schema->size() / 2);
+        ThreadResult result;
+        start.arrive_and_wait();
+
+        AllocationScope scope;
+        for (std::size_t step = 0; step < options.updates; ++step) {
+            const Composition& comp = fixture.solar[step % fixture.solar.size()];
+            const CanonicalFractions xyz = canonical_fractions(comp);
+            result.sink += comp.getMeanParticleMass() + comp.getElectronAbundance() + comp.getMolarAbundance(probe)
+                + xyz.x + xyz.y + xyz.z + static_cast<double>(CompositionHash::hash_exact(comp) & 0xff);
+        }
+        result.counts = scope.counts();
+        result.updates = options.updates;
+        return result;
+    }
+
+    ThreadResult run_batch(const ScalingFixture& fixture, const ScalingOptions& options, std::barrier<>& start) {
+        const std::vector<Species>& species = *fixture.schema;
+        const std::size_t n = species.size();
+        std::vector<double> y(options.zones * n, 1.0e-3);
+        std::vector<double> x(y.size());
+        std::vector<fdst_composition_moments> moments(options.zones);
+        // Views over this thread's rows, built once: they read the updated abundances in place
+        std::vector<CompositionView> views;
+        for (std::size_t zone = 0; zone < options.zones; ++zone) {
+            views.emplace_back(fixture.schema, std::span<const double>(y).subspan(zone * n, n));
+        }
+        ThreadResult result;
+        start.arrive_and_wait();
+
+        AllocationScope scope;
+        for (std::size_t step = 0; step * options.zones < options.updates; ++step) {
+            for (std::size_t zone = 0; zone < options.zones; ++zone) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    y[zone * n + i] = abundance(i, zone, step);
+                }
+            }
+            fdst_composition_moments_batch(fixture.handle.get(), y.data(), options.zones, n, moments.data());
+            fdst_composition_mass_fractions_batch(fixture.handle.get(), y.data(), options.zones, n, x.data());
+            for (std::size_t zone = 0; zone < options.zones; ++zone) {
+                double hydrogen = 0.0;
+                double helium = 0.0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const double xi = x[zone * n + i];
+                    hydrogen += species[i].z() == 1 ? xi : 0.0;
+                    helium += species[i].z() == 2 ? xi : 0.0;
+                }
+                result.sink += moments[zone].mean_particle_mass + moments[zone].ye + hydrogen + helium
+                    + (1.0 - hydrogen - helium) + static_cast<double>(CompositionHash::hash_exact(views[zone]) & 0xff);
+            }
+            result.updates += options.zones;
+        }
+        result.counts = scope.counts();
+        return result;
+    }
+
+    struct ScalingSample {
+        double seconds;
+        std::size_t updates;
+        AllocationCounts counts;
+    };
+
+    using Workload = std::function<ThreadResult(std::barrier<>&)>;
+
+    // Runs `workload` on `threads` jthreads, timed from the moment all of them are ready
+    ScalingSample run_threads(const std::size_t threads, const Workload& workload) {
+        std::vector<ThreadResult> results(threads);
+        std::barrier ready(static_cast<std::ptrdiff_t>(threads + 1));
+        std::chrono::steady_clock::time_point started;
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(threads);
+            for (std::size_t t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] { results[t] = workload(ready); });
+            }
+            ready.arrive_and_wait();
+            started = std::chrono::steady_clock::now();
+        } // jthreads join here
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+
+        ScalingSample sample{elapsed.count(), 0, {}};
+        double sink = 0.0;
+        for (const ThreadResult& result : results) {
+            sample.updates += result.updates;
+            sample.counts.allocations += result.counts.allocations;
+            sample.counts.bytes += result.counts.bytes;
+            sink += result.sink;
+        }
+        do_not_optimize(sink);
+        return sample;
+    }
+
+    std::vector<std::size_t> thread_counts(const std::size_t maxThreads) {
+        std::vector<std::size_t> counts;
+        for (std::size_t n = 1; n < maxThreads; n *= 2) {
+            counts.push_back(n);
+        }
+        counts.push_back(maxThreads);
+        return counts;
+    }
+
+    std::size_t parse_size(const std::string_view text) {
+        std::size_t value = 0;
+        const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size() || value == 0) {
+            throw std::invalid_argument("Not a positive number: " + std::string(text));
+        }
+        return value;
+    }
+}
+
+int main(const int argc, char** argv) {
+    ScalingOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg.starts_with("--max-threads=")) {
+            options.maxThreads = parse_size(arg.substr(14));
+        } else if (arg.starts_with("--species=")) {
+            options.species = parse_size(arg.substr(10));
+        } else if (arg.starts_with("--zones=")) {
+            options.zones = parse_size(arg.substr(8));
+        } else if (arg.starts_with("--updates=")) {
+            options.updates = parse_size(arg.substr(10));
+        } else {
+            std::println(stderr, "Usage: {} [--max-threads=N] [--species=N] [--zones=N] [--updates=N]", argv[0]);
+            return 2;
+        }
+    }
+
+    const ScalingFixture fixture(options.species);
+    const std::vector<std::pair<std::string_view, Workload>> variants{
+        {"private", [&](std::barrier<>& start) { return run_private(fixture, options, false, start); }},
+        {"private+allocating", [&](std::barrier<>& start) { return run_private(fixture, options, true, start); }},
+        {"shared const", [&](std::barrier<>& start) { return run_shared(fixture, options, start); }},
+        {"batch", [&](std::barrier<>& start) { return run_batch(fixture, options, start); }},
+    };
+
+    std::println("{} species, {} zones and {} updates per thread, {} hardware threads",
+        options.species, options.zones, options.updates, std::thread::hardware_concurrency());
+    std::println("{:>20} {:>8} {:>16} {:>12} {:>14} {:>14}",
+        "variant", "threads", "updates/s", "efficiency", "allocs/update", "bytes/update");
+    for (const auto& [name, workload] : variants) {
+        double singleThreadRate = 0.0;
+        for (const std::size_t threads : thread_counts(options.maxThreads)) {
+            const ScalingSample sample = run_threads(threads, workload);
+            const double rate = static_cast<double>(sample.updates) / sample.seconds;
+            if (threads == 1) {
+                singleThreadRate = rate;
+            }
+            const auto updates = static_cast<double>(sample.updates);
+            std::println("{:>20} {:>8} {:>16.0f} {:>12.2f} {:>14.2f} {:>14.1f}",
+                name, threads, rate, rate / (static_cast<double>(threads) * singleThreadRate),
+                static_cast<double>(sample.counts.allocations) / updates, static_cast<double>(sample.counts.bytes) / updates);
+        }
+        std::println("");
+    }
+    return 0;
+}
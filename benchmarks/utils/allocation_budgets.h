@@ -0,0 +1,95 @@
+#pragma once
+
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/decorators/composition_masked.h"
+#include "fourdst/composition/utils/composition_hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Declared allocation budgets of the Composition API, shared by the allocation benchmark and the
+ * allocation budget test. A call may make at most `fixed + perSpecies * N` operator new
+ * allocations on a composition of N species. Lowering a budget after an optimisation locks the
+ * gain in; raising one needs a reason.
+ */
+
+struct AllocationFixture {
+    explicit AllocationFixture(const std::size_t n)
+        : species([n] {
+              std::vector<fourdst::atomic::SpeciesId> ids(n);
+              std::iota(ids.begin(), ids.end(), fourdst::atomic::SpeciesId{0});
+              return fourdst::atomic::SpeciesTable::builtin().species(ids);
+          }()),
+          comp(species, std::vector<double>(n, 1.0e-3)),
+          masked(comp, std::vector(species.begin(), species.begin() + static_cast<std::ptrdiff_t>((n + 1) / 2))),
+          probe(species[n / 2]),
+          symbol(probe.name()) {}
+
+    std::vector<fourdst::atomic::Species> species;
+    fourdst::composition::Composition comp;
+    fourdst::composition::MaskedComposition masked;
+    fourdst::atomic::Species probe; ///< A registered species from the middle of the list.
+    std::string symbol; ///< Name of `probe`.
+    double y = 1.0e-3;
+
+    // Changes one abundance, so the next query cannot return a cached result
+    void touch() {
+        y *= 1.0000001;
+        comp.setMolarAbundance(probe, y);
+    }
+};
+
+struct AllocationBudget {
+    std::string_view operation;
+    std::size_t fixed;
+    std::size_t perSpecies;
+    std::function<void(AllocationFixture&)> call;
+
+    [[nodiscard]] std::size_t allowed(const std::size_t n) const noexcept { return fixed + perSpecies * n; }
+};
+
+inline const std::vector<AllocationBudget>& composition_allocation_budgets() {
+    using fourdst::composition::utils::CompositionHash;
+    static const std::vector<AllocationBudget> budgets{
+        // Single species access by Species or by symbol
+        {"getMolarAbundance(Species)", 0, 0, [](AllocationFixture& f) { (void)f.comp.getMolarAbundance(f.probe); }},
+        {"getMolarAbundance(symbol)", 0, 0, [](AllocationFixture& f) { (void)f.comp.getMolarAbundance(f.symbol); }},
+        {"getMassFraction(Species)", 0, 0, [](AllocationFixture& f) { (void)f.comp.getMassFraction(f.probe); }},
+        {"getNumberFraction(Species)", 0, 0, [](AllocationFixture& f) { (void)f.comp.getNumberFraction(f.probe); }},
+        {"setMolarAbundance(Species)", 0, 0, [](AllocationFixture& f) { f.touch(); }},
+        {"setMolarAbundance(symbol)", 0, 0, [](AllocationFixture& f) { f.comp.setMolarAbundance(f.symbol, f.y); }},
+        {"contains(Species)", 0, 0, [](AllocationFixture& f) { (void)f.comp.contains(f.probe); }},
+        {"contains(symbol)", 0, 0, [](AllocationFixture& f) { (void)f.comp.contains(f.symbol); }},
+        {"getSpeciesIndex(Species)", 0, 0, [](AllocationFixture& f) { (void)f.comp.getSpeciesIndex(f.probe); }},
+
+        // Derived quantities, recomputed after an update
+        {"getMeanParticleMass()", 0, 0, [](AllocationFixture& f) { f.touch(); (void)f.comp.getMeanParticleMass(); }},
+        {"getElectronAbundance()", 0, 0, [](AllocationFixture& f) { f.touch(); (void)f.comp.getElectronAbundance(); }},
+        {"hash_exact", 0, 0, [](AllocationFixture& f) { f.touch(); (void)CompositionHash::hash_exact(f.comp); }},
+        {"hash()", 0, 0, [](AllocationFixture& f) { f.touch(); (void)f.comp.hash(); }},
+
+        // Bulk getters return containers: one vector, or one node per species
+        {"getMolarAbundanceVector()", 1, 0, [](AllocationFixture& f) { (void)f.comp.getMolarAbundanceVector(); }},
+        {"getMassFractionVector() after update", 2, 0, [](AllocationFixture& f) { f.touch(); (void)f.comp.getMassFractionVector(); }},
+        {"getMassFractionVector() cached", 1, 0, [](AllocationFixture& f) { (void)f.comp.getMassFractionVector(); }},
+        {"getNumberFractionVector() after update", 2, 0, [](AllocationFixture& f) { f.touch(); (void)f.comp.getNumberFractionVector(); }},
+        {"getRegisteredSymbols()", 0, 1, [](AllocationFixture& f) { (void)f.comp.getRegisteredSymbols(); }},
+        {"getMassFraction() map", 16, 2, [](AllocationFixture& f) { (void)f.comp.getMassFraction(); }},
+        {"getNumberFraction() map", 16, 2, [](AllocationFixture& f) { (void)f.comp.getNumberFraction(); }},
+
+        // MaskedComposition reads through to its base composition
+        {"MaskedComposition::getMolarAbundance(Species)", 0, 0, [](AllocationFixture& f) { (void)f.masked.getMolarAbundance(f.species.front()); }},
+        {"MaskedComposition::getMassFraction(Species)", 0, 0, [](AllocationFixture& f) { (void)f.masked.getMassFraction(f.species.front()); }},
+        {"MaskedComposition::getMeanParticleMass()", 0, 0, [](AllocationFixture& f) { (void)f.masked.getMeanParticleMass(); }},
+        {"MaskedComposition::getElectronAbundance()", 0, 0, [](AllocationFixture& f) { (void)f.masked.getElectronAbundance(); }},
+    };
+    return budgets;
+}
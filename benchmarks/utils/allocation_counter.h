@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+ * Counts the operator new allocations of the calling thread while an AllocationScope is active.
+ *
+ * The library allocates only through operator new (strings, vectors, maps), so replacing it is
+ * enough to see every allocation a composition call makes, without depending on the C library
+ * for malloc interposition. The replacements are defined by the one translation unit of an
+ * executable which defines FDST_DEFINE_COUNTING_OPERATOR_NEW before including this header.
+ */
+
+struct AllocationCounts {
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+};
+
+namespace fdst_allocation_counter {
+    inline thread_local AllocationCounts g_counts{};
+    inline thread_local bool g_active = false;
+
+    inline void record(const std::size_t size) noexcept {
+        if (g_active) {
+            ++g_counts.allocations;
+            g_counts.bytes += size;
+        }
+    }
+}
+
+// Counts allocations of the calling thread for its lifetime; scopes do not nest
+class AllocationScope {
+public:
+    AllocationScope() noexcept {
+        fdst_allocation_counter::g_counts = {};
+        fdst_allocation_counter::g_active = true;
+    }
+    ~AllocationScope() { fdst_allocation_counter::g_active = false; }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    [[nodiscard]] AllocationCounts counts() const noexcept { return fdst_allocation_counter::g_counts; }
+};
+
+// Allocations made by `calls` calls of `func`, after one uncounted warm-up call which may fill caches and function statics
+template <typename Func>
+AllocationCounts count_allocations(Func&& func, const std::size_t calls = 1) {
+    func();
+    AllocationScope scope;
+    for (std::size_t i = 0; i < calls; ++i) {
+        func();
+    }
+    return scope.counts();
+}
+
+#if defined(FDST_DEFINE_COUNTING_OPERATOR_NEW)
+namespace fdst_allocation_counter {
+    inline void* allocate(const std::size_t size) {
+        record(size);
+        if (void* p = std::malloc(size == 0 ? 1 : size)) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    inline void* allocate_aligned(const std::size_t size, const std::align_val_t alignment) {
+        record(size);
+        const auto align = static_cast<std::size_t>(alignment);
+        if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(const std::size_t size) { return fdst_allocation_counter::allocate(size); }
+void* operator new[](const std::size_t size) { return fdst_allocation_counter::allocate(size); }
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    try { return fdst_allocation_counter::allocate(size); } catch (...) { return nullptr; } // NOLINT(bugprone-empty-catch) nothrow new reports failure as nullptr
+}
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept {
+    try { return fdst_allocation_counter::allocate(size); } catch (...) { return nullptr; } // NOLINT(bugprone-empty-catch) nothrow new reports failure as nullptr
+}
+void* operator new(const std::size_t size, const std::align_val_t alignment) { return fdst_allocation_counter::allocate_aligned(size, alignment); }
+void* operator new[](const std::size_t size, const std::align_val_t alignment) { return fdst_allocation_counter::allocate_aligned(size, alignment); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+#endif
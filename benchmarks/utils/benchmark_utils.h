@@ -1,12 +1,23 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstdlib>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cmath>
 #include <format>
 #include <chrono>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 
 template <class T>
@@ -62,4 +73,161 @@ auto fdst_benchmark_function(Func&& func_call) {
     do_not_optimize(duration.count());
 
     return duration;
-}
\ No newline at end of file
+}
+
+/*
+ * Hardware performance counters of the calling thread, read through Linux perf_event_open.
+ *
+ * Every event is opened on its own, so a machine (or VM) lacking, say, an LLC miss event still
+ * reports the others; events which cannot be opened at all (no perf support, a restrictive
+ * perf_event_paranoid, not Linux) are reported as unavailable instead of failing the benchmark.
+ * Counts are user space only and scaled for multiplexing. Set FDST_BENCHMARK_PERF=0 to skip them.
+ */
+enum class PerfEvent : std::size_t { Cycles, Instructions, L1DMisses, LLCMisses, BranchMisses };
+inline constexpr std::size_t kPerfEventCount = 5;
+inline constexpr std::array<std::string_view, kPerfEventCount> kPerfEventNames{
+    "cycles", "instructions", "L1d read misses", "LLC misses", "branch misses"
+};
+
+struct PerfCounts {
+    std::array<double, kPerfEventCount> values{};
+    std::array<bool, kPerfEventCount> valid{};
+
+    [[nodiscard]] bool any() const noexcept { return std::ranges::any_of(valid, [](const bool v) { return v; }); }
+    [[nodiscard]] double operator[](PerfEvent event) const noexcept { return values[static_cast<std::size_t>(event)]; }
+    [[nodiscard]] bool has(PerfEvent event) const noexcept { return valid[static_cast<std::size_t>(event)]; }
+
+    PerfCounts& operator+=(const PerfCounts& other) noexcept {
+        for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+            values[i] += other.values[i];
+            valid[i] = valid[i] || other.valid[i];
+        }
+        return *this;
+    }
+};
+
+class PerfCounters {
+public:
+    PerfCounters() {
+        m_fds.fill(-1);
+#if defined(__linux__)
+        const char* env = std::getenv("FDST_BENCHMARK_PERF");
+        if (env != nullptr && std::string_view(env) == "0") {
+            return;
+        }
+        constexpr std::uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D
+            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const std::array<std::pair<std::uint32_t, std::uint64_t>, kPerfEventCount> events{{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, l1dReadMiss},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        }};
+        for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            m_fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+#endif
+    }
+
+    ~PerfCounters() {
+#if defined(__linux__)
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // Counters of the calling thread, opened on first use
+    static PerfCounters& thread_instance() {
+        thread_local PerfCounters counters;
+        return counters;
+    }
+
+    [[nodiscard]] bool available() const noexcept {
+        return std::ranges::any_of(m_fds, [](const int fd) { return fd >= 0; });
+    }
+
+    void start() noexcept {
+#if defined(__linux__)
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    PerfCounts stop() noexcept {
+        PerfCounts counts;
+#if defined(__linux__)
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+            std::uint64_t data[3]{}; // value, time enabled, time running
+            if (m_fds[i] < 0 || read(m_fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) {
+                continue;
+            }
+            counts.values[i] = static_cast<double>(data[0]) * (static_cast<double>(data[1]) / static_cast<double>(data[2]));
+            counts.valid[i] = true;
+        }
+#endif
+        return counts;
+    }
+
+private:
+    std::array<int, kPerfEventCount> m_fds{};
+};
+
+/*
+ * fdst_benchmark_function, additionally recording the hardware counters of the call. The counts
+ * are all invalid where perf_event_open is unavailable.
+ */
+template <typename Func>
+auto fdst_benchmark_function_counted(Func&& func_call) {
+    PerfCounters& counters = PerfCounters::thread_instance();
+    counters.start();
+    const auto duration = fdst_benchmark_function(std::forward<Func>(func_call));
+    const PerfCounts counts = counters.stop();
+    return std::pair(duration, counts);
+}
+
+// Formats counts accumulated over `operations` operations as per-operation values, in the layout of plot_ascii_histogram
+inline std::string format_perf_counts(const PerfCounts& counts, const double operations, std::string title) {
+    std::string report;
+    report += std::format("{:^60}\n", title);
+    report += std::string(60, '=') + "\n";
+    if (!counts.any()) {
+        report += "hardware counters unavailable (no perf_event_open access)\n";
+        return report;
+    }
+    for (std::size_t i = 0; i < kPerfEventCount; ++i) {
+        if (counts.valid[i]) {
+            report += std::format("{:>20}: {:>15.2f} per op\n", kPerfEventNames[i], counts.values[i] / operations);
+        } else {
+            report += std::format("{:>20}: {:>15}\n", kPerfEventNames[i], "n/a");
+        }
+    }
+    if (counts.has(PerfEvent::Cycles) && counts.has(PerfEvent::Instructions) && counts[PerfEvent::Cycles] > 0.0) {
+        report += std::format("{:>20}: {:>15.2f}\n", "IPC", counts[PerfEvent::Instructions] / counts[PerfEvent::Cycles]);
+    }
+    return report;
+}
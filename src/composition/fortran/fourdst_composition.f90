@@ -0,0 +1,163 @@
+!> @file fourdst_composition.f90
+!> @brief Fortran 2008 bindings of the libcomposition C ABI (fourdst/composition/c/composition_c.h).
+!>
+!> @details Handles are `type(c_ptr)`. Abundance arrays use the order the handle was created with
+!> and are never copied; a bound array must have the `target` attribute and stay alive while it is
+!> bound. A two dimensional array `y(n_species, n_zones)` is a valid batch with `zone_stride = n_species`.
+!>
+!> @par Examples
+!> @code{.f90}
+!> use fourdst_composition
+!> type(c_ptr) :: comp
+!> real(c_double), target :: y(3) = [0.7d0, 0.07d0, 1d-3]
+!> type(fdst_composition_moments) :: m
+!> if (fdst_composition_create([1_c_int32_t, 2_c_int32_t, 6_c_int32_t], &
+!>                             [1_c_int32_t, 4_c_int32_t, 12_c_int32_t], 3_c_size_t, comp) /= FDST_COMPOSITION_OK) &
+!>     error stop fdst_composition_error_message()
+!> ierr = fdst_composition_bind(comp, y)
+!> ierr = fdst_composition_get_moments(comp, m)
+!> call fdst_composition_destroy(comp)
+!> @endcode
+module fourdst_composition
+    use, intrinsic :: iso_c_binding
+    implicit none
+    private
+
+    public :: c_ptr, c_null_ptr, c_int, c_int32_t, c_size_t, c_double
+
+    enum, bind(c)
+        enumerator :: FDST_COMPOSITION_OK = 0
+        enumerator :: FDST_COMPOSITION_INVALID_ARGUMENT = 1
+        enumerator :: FDST_COMPOSITION_UNKNOWN_SPECIES = 2
+        enumerator :: FDST_COMPOSITION_NOT_BOUND = 3
+        enumerator :: FDST_COMPOSITION_ERROR = 4
+    end enum
+    public :: FDST_COMPOSITION_OK, FDST_COMPOSITION_INVALID_ARGUMENT, FDST_COMPOSITION_UNKNOWN_SPECIES, &
+              FDST_COMPOSITION_NOT_BOUND, FDST_COMPOSITION_ERROR
+
+    !> Abundance moments of one zone, layout compatible with fdst_composition_moments.
+    type, bind(c), public :: fdst_composition_moments
+        real(c_double) :: sum_y
+        real(c_double) :: mean_particle_mass
+        real(c_double) :: ye
+        real(c_double) :: abar
+        real(c_double) :: zbar
+        real(c_double) :: z2bar
+    end type fdst_composition_moments
+
+    public :: fdst_composition_create, fdst_composition_destroy, fdst_composition_species_count, &
+              fdst_composition_species_masses, fdst_composition_bind, fdst_composition_unbind, &
+              fdst_composition_get_moments, fdst_composition_get_mass_fractions, &
+              fdst_composition_get_number_fractions, fdst_composition_moments_batch, &
+              fdst_composition_mass_fractions_batch, fdst_composition_error_message
+
+    interface
+        integer(c_int) function fdst_composition_create(z, a, n_species, comp) bind(c, name='fdst_composition_create')
+            import :: c_int, c_int32_t, c_size_t, c_ptr
+            integer(c_int32_t), intent(in) :: z(*), a(*)
+            integer(c_size_t), value :: n_species
+            type(c_ptr), intent(out) :: comp
+        end function fdst_composition_create
+
+        subroutine fdst_composition_destroy(comp) bind(c, name='fdst_composition_destroy')
+            import :: c_ptr
+            type(c_ptr), value :: comp
+        end subroutine fdst_composition_destroy
+
+        integer(c_size_t) function fdst_composition_species_count(comp) bind(c, name='fdst_composition_species_count')
+            import :: c_size_t, c_ptr
+            type(c_ptr), value :: comp
+        end function fdst_composition_species_count
+
+        integer(c_int) function fdst_composition_species_masses(comp, masses) bind(c, name='fdst_composition_species_masses')
+            import :: c_int, c_double, c_ptr
+            type(c_ptr), value :: comp
+            real(c_double), intent(out) :: masses(*)
+        end function fdst_composition_species_masses
+
+        integer(c_int) function c_bind(comp, y) bind(c, name='fdst_composition_bind')
+            import :: c_int, c_ptr
+            type(c_ptr), value :: comp
+            type(c_ptr), value :: y
+        end function c_bind
+
+        integer(c_int) function fdst_composition_get_moments(comp, moments) bind(c, name='fdst_composition_get_moments')
+            import :: c_int, c_ptr, fdst_composition_moments
+            type(c_ptr), value :: comp
+            type(fdst_composition_moments), intent(out) :: moments
+        end function fdst_composition_get_moments
+
+        integer(c_int) function fdst_composition_get_mass_fractions(comp, x) bind(c, name='fdst_composition_get_mass_fractions')
+            import :: c_int, c_double, c_ptr
+            type(c_ptr), value :: comp
+            real(c_double), intent(out) :: x(*)
+        end function fdst_composition_get_mass_fractions
+
+        integer(c_int) function fdst_composition_get_number_fractions(comp, x) &
+                bind(c, name='fdst_composition_get_number_fractions')
+            import :: c_int, c_double, c_ptr
+            type(c_ptr), value :: comp
+            real(c_double), intent(out) :: x(*)
+        end function fdst_composition_get_number_fractions
+
+        integer(c_int) function fdst_composition_moments_batch(comp, y, n_zones, zone_stride, moments) &
+                bind(c, name='fdst_composition_moments_batch')
+            import :: c_int, c_double, c_size_t, c_ptr, fdst_composition_moments
+            type(c_ptr), value :: comp
+            real(c_double), intent(in) :: y(*)
+            integer(c_size_t), value :: n_zones, zone_stride
+            type(fdst_composition_moments), intent(out) :: moments(*)
+        end function fdst_composition_moments_batch
+
+        integer(c_int) function fdst_composition_mass_fractions_batch(comp, y, n_zones, zone_stride, x) &
+                bind(c, name='fdst_composition_mass_fractions_batch')
+            import :: c_int, c_double, c_size_t, c_ptr
+            type(c_ptr), value :: comp
+            real(c_double), intent(in) :: y(*)
+            integer(c_size_t), value :: n_zones, zone_stride
+            real(c_double), intent(out) :: x(*)
+        end function fdst_composition_mass_fractions_batch
+
+        type(c_ptr) function c_last_error() bind(c, name='fdst_composition_last_error')
+            import :: c_ptr
+        end function c_last_error
+
+        integer(c_size_t) function c_strlen(s) bind(c, name='strlen')
+            import :: c_size_t, c_ptr
+            type(c_ptr), value :: s
+        end function c_strlen
+    end interface
+
+contains
+
+    !> Binds a caller-owned abundance array, in handle order, without copying it.
+    integer(c_int) function fdst_composition_bind(comp, y)
+        type(c_ptr), intent(in) :: comp
+        real(c_double), target, contiguous, intent(in) :: y(:)
+        fdst_composition_bind = c_bind(comp, c_loc(y))
+    end function fdst_composition_bind
+
+    !> Unbinds the abundance array of a handle.
+    integer(c_int) function fdst_composition_unbind(comp)
+        type(c_ptr), intent(in) :: comp
+        fdst_composition_unbind = c_bind(comp, c_null_ptr)
+    end function fdst_composition_unbind
+
+    !> Message of the last failed call on this thread, as a Fortran string.
+    function fdst_composition_error_message() result(message)
+        character(len=:), allocatable :: message
+        type(c_ptr) :: raw
+        character(kind=c_char), pointer :: chars(:)
+        integer(c_size_t) :: n
+        integer :: i
+
+        raw = c_last_error()
+        n = c_strlen(raw)
+        call c_f_pointer(raw, chars, [n])
+        allocate(character(len=n) :: message)
+        do i = 1, int(n)
+            message(i:i) = chars(i)
+        end do
+    end function fdst_composition_error_message
+
+end module fourdst_composition
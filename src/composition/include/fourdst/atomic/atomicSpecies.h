@@ -1,6 +1,7 @@
 #pragma once
 
 
+#include <cstdint>
 #include <format>
 #include <string_view>
 #include <string>
@@ -13,6 +14,51 @@
  * @brief Contains classes and functions related to atomic data, such as properties of atomic species.
  */
 namespace fourdst::atomic {
+    /**
+     * @brief Parity of a nuclear level.
+     */
+    enum class Parity : std::int8_t {
+        NEGATIVE = -1, ///< Odd parity ("-").
+        UNKNOWN = 0, ///< No parity given in the evaluation.
+        POSITIVE = 1 ///< Even parity ("+").
+    };
+
+    /**
+     * @struct NuclearSpin
+     * @brief Decoded form of a spin-parity (J^pi) string.
+     *
+     * The spin is stored as the integer 2J so that half-integer spins are exact; a value of -1
+     * marks a level whose spin is not assigned.
+     */
+    struct NuclearSpin {
+        std::int16_t twoJ = -1; ///< Twice the spin, or -1 if unknown.
+        Parity parity = Parity::UNKNOWN; ///< Parity of the level.
+        bool uncertain = false; ///< True if the assignment is tentative or systematic ("(...)" or "#").
+
+        /**
+         * @brief Checks whether a spin is assigned.
+         * @return `true` if `twoJ` is not negative.
+         */
+        [[nodiscard]] constexpr bool known() const noexcept {
+            return twoJ >= 0;
+        }
+
+        /**
+         * @brief Gets the spin as a numeric value.
+         * @return J as a double, or `NaN` if the spin is unknown.
+         */
+        [[nodiscard]] constexpr double spin() const noexcept {
+            return twoJ >= 0 ? twoJ / 2.0 : std::numeric_limits<double>::quiet_NaN();
+        }
+    };
+
+    /**
+     * @brief Decodes a spin-parity (JPI) string into its spin, parity and certainty.
+     * @param jpi The spin-parity string to decode (e.g., "1/2+", "(5/2-)", "0+#").
+     * @return The decoded spin. `twoJ` is -1 for empty or unparsable strings.
+     */
+    constexpr NuclearSpin decode_jpi(std::string_view jpi) noexcept;
+
     /**
      * @brief Converts a spin-parity string (JPI string) to a double-precision floating-point number.
      * @param jpi_string The spin-parity string to convert (e.g., "1/2+", "5/2-", "0+").
@@ -64,7 +110,8 @@ namespace fourdst::atomic {
         std::string m_decayModes; ///< Decay modes as a string.
         double m_atomicMass; ///< Atomic mass in atomic mass units (u).
         double m_atomicMassUnc; ///< Uncertainty in the atomic mass.
-        mutable std::optional<double> m_spin = std::nullopt; ///< Nuclear spin as a double, derived from m_spinParity.
+        NuclearSpin m_nuclearSpin; ///< Spin and parity decoded from m_spinParity.
+        double m_spin; ///< Nuclear spin as a double, derived from m_nuclearSpin.
 
         /**
          * @brief Constructs a Species object with detailed properties.
@@ -84,7 +131,36 @@ namespace fourdst::atomic {
          * @param atomicMass Atomic mass.
          * @param atomicMassUnc Atomic mass uncertainty.
          *
-         * @post The `m_spin` member is initialized by parsing `m_spinParity` using `convert_jpi_to_double`.
+         * @post The `m_nuclearSpin` and `m_spin` members are initialized by decoding `m_spinParity` using `decode_jpi`.
+         */
+        Species(
+            const std::string_view name,
+            const std::string_view el,
+            const int nz,
+            const int n,
+            const int z,
+            const int a,
+            const double bindingEnergy,
+            const std::string_view betaCode,
+            const double betaDecayEnergy,
+            const double halfLife_s,
+            const std::string_view spinParity,
+            const std::string_view decayModes,
+            const double atomicMass,
+            const double atomicMassUnc
+        ) :
+        Species(name, el, nz, n, z, a, bindingEnergy, betaCode, betaDecayEnergy, halfLife_s,
+                spinParity, decode_jpi(spinParity), decayModes, atomicMass, atomicMassUnc) {}
+
+        /**
+         * @brief Constructs a Species object whose spin-parity string has already been decoded.
+         *
+         * The compiled-in table in species.h is generated with the decoded spin, so none of its
+         * species run `decode_jpi` during static initialization.
+         *
+         * @param nuclearSpin The decoded form of `spinParity`, as `decode_jpi(spinParity)` would return it.
+         *
+         * The remaining parameters are those of the constructor above.
          */
         Species(
             const std::string_view name,
@@ -98,6 +174,7 @@ namespace fourdst::atomic {
             const double betaDecayEnergy,
             const double halfLife_s,
             const std::string_view spinParity,
+            const NuclearSpin nuclearSpin,
             const std::string_view decayModes,
             const double atomicMass,
             const double atomicMassUnc
@@ -115,29 +192,32 @@ namespace fourdst::atomic {
         m_spinParity(spinParity),
         m_decayModes(decayModes),
         m_atomicMass(atomicMass),
-        m_atomicMassUnc(atomicMassUnc) {};
+        m_atomicMassUnc(atomicMassUnc),
+        m_nuclearSpin(nuclearSpin),
+        m_spin(m_nuclearSpin.spin()) {}
 
         /**
          * @brief Copy constructor for Species.
          * @param species The Species object to copy.
-         * @post A new Species object is created as a deep copy of `species`. The `m_spin` member is re-calculated.
+         * @post A new Species object is created as a deep copy of `species`, including its decoded spin.
          */
-        Species(const Species& species) {
-            m_name = species.m_name;
-            m_el = species.m_el;
-            m_nz = species.m_nz;
-            m_n = species.m_n;
-            m_z = species.m_z;
-            m_a = species.m_a;
-            m_bindingEnergy = species.m_bindingEnergy;
-            m_betaCode = species.m_betaCode;
-            m_betaDecayEnergy = species.m_betaDecayEnergy;
-            m_halfLife_s = species.m_halfLife_s;
-            m_spinParity = species.m_spinParity;
-            m_decayModes = species.m_decayModes;
-            m_atomicMass = species.m_atomicMass;
-            m_atomicMassUnc = species.m_atomicMassUnc;
-        }
+        Species(const Species& species) :
+        m_name(species.m_name),
+        m_el(species.m_el),
+        m_nz(species.m_nz),
+        m_n(species.m_n),
+        m_z(species.m_z),
+        m_a(species.m_a),
+        m_bindingEnergy(species.m_bindingEnergy),
+        m_betaCode(species.m_betaCode),
+        m_betaDecayEnergy(species.m_betaDecayEnergy),
+        m_halfLife_s(species.m_halfLife_s),
+        m_spinParity(species.m_spinParity),
+        m_decayModes(species.m_decayModes),
+        m_atomicMass(species.m_atomicMass),
+        m_atomicMassUnc(species.m_atomicMassUnc),
+        m_nuclearSpin(species.m_nuclearSpin),
+        m_spin(species.m_spin) {}
 
 
         /**
@@ -254,13 +334,42 @@ namespace fourdst::atomic {
 
         /**
          * @brief Gets the nuclear spin as a numeric value.
-         * @return The spin as a double.
+         * @return The spin as a double, or `NaN` if no spin is assigned.
          */
-        [[nodiscard]] double spin() const {
-            if (!m_spin.has_value()) { // The spin calculation is very expensive, and we almost never need it so we only compute it the first time it is requested
-                m_spin = convert_jpi_to_double(m_spinParity);
-            }
-            return m_spin.value();
+        [[nodiscard]] double spin() const noexcept {
+            return m_spin;
+        }
+
+        /**
+         * @brief Gets twice the nuclear spin as an exact integer.
+         * @return 2J, or -1 if no spin is assigned.
+         */
+        [[nodiscard]] int twoJ() const noexcept {
+            return m_nuclearSpin.twoJ;
+        }
+
+        /**
+         * @brief Gets the parity of the ground state.
+         * @return The parity, or `Parity::UNKNOWN` if none is given.
+         */
+        [[nodiscard]] Parity parity() const noexcept {
+            return m_nuclearSpin.parity;
+        }
+
+        /**
+         * @brief Checks whether the spin-parity assignment is tentative or systematic.
+         * @return `true` if the evaluation marks the assignment with parentheses or "#".
+         */
+        [[nodiscard]] bool spinUncertain() const noexcept {
+            return m_nuclearSpin.uncertain;
+        }
+
+        /**
+         * @brief Gets the decoded spin, parity and certainty of the ground state.
+         * @return The decoded spin-parity.
+         */
+        [[nodiscard]] const NuclearSpin& nuclearSpin() const noexcept {
+            return m_nuclearSpin;
         }
 
         /**
@@ -309,87 +418,122 @@ namespace fourdst::atomic {
 
 
     /**
-     * @brief Converts a spin-parity string (JPI string) to a double-precision floating-point number representing the spin.
+     * @brief Decodes a spin-parity (JPI) string into its spin, parity and certainty.
      *
      * @details
      * **Purpose and Usage:**
-     * This function is a utility for converting the textual representation of nuclear spin and parity,
-     * commonly found in nuclear data files (e.g., "5/2-"), into a numerical format (`double`)
-     * that can be used in calculations. It is used internally by the `Species` constructor to
-     * initialize the `m_spin` member.
+     * Nuclear data files give the spin and parity of a level as text (e.g., "5/2-", "(3+)", "0+#").
+     * This function turns that text into the exact integer 2J, the parity, and a flag recording
+     * whether the assignment is tentative. It is run once when a `Species` is constructed from a
+     * spin-parity string alone, so that `Species::spin()` and the other accessors are plain loads.
+     * utils/atomic/format.py mirrors it to write the decoded spin into species.h.
      *
      * **Algorithm:**
-     * The function robustly parses various formats of JPI strings:
-     * 1.  **Sanitization:** It first removes common non-numeric characters like `(`, `)`, `*`, and `#`.
-     * 2.  **Parity-Only:** Strings containing only `+` or `-` are treated as spin 0.
-     * 3.  **Comma-Separated:** If multiple values are present (e.g., "3/2+,5/2+"), it considers only the first one.
-     * 4.  **Parity Suffix:** It removes the trailing `+` or `-` parity indicator.
-     * 5.  **Fractional vs. Integer:**
-     *     - If the string contains a `/` (e.g., "5/2"), it parses the numerator and denominator to calculate the fraction.
-     *     - Otherwise, it attempts to parse the string directly as a double (for integer spins like "1", "2").
-     * 6.  **Error Handling:** If the string is empty, malformed, or results in division by zero,
-     *     it returns `std::numeric_limits<double>::quiet_NaN()` to indicate a parsing failure.
-     *     This function does not throw exceptions but relies on the return value for error signaling.
-     *
-     * @param jpi_string The spin-parity string to convert.
+     * 1.  **Annotations:** Leading blanks are skipped and everything after the next blank (isospin
+     *     "T=..." or "frg" annotations) is dropped.
+     * 2.  **Lists and Ranges:** Only the first value of a list ("3/2+,5/2+") or range ("1/2:9/2") is kept.
+     * 3.  **Sanitization:** `(`, `)` and `#` are removed and set `uncertain`; `*` is removed.
+     * 4.  **Parity Suffix:** A trailing `+` or `-` sets the parity. A parity alone is treated as spin 0.
+     * 5.  **Value:** The remainder must be an integer or a fraction with denominator 2. A missing
+     *     numerator ("/2") is read as 1.
+     * 6.  **Error Handling:** Anything else leaves `twoJ` at -1. The function does not throw.
      *
-     * @pre The input `jpi_string` is a standard C++ string.
-     * @post The function returns a `double` representing the spin, or `NaN` if parsing fails. The input string is not modified.
+     * @param jpi The spin-parity string to decode.
+     * @return The decoded spin.
      *
-     * @return The spin value as a `double`. Returns `NaN` for invalid or unparsable strings.
+     * @par Examples
+     * @code{.cpp}
+     * static_assert(decode_jpi("5/2-").twoJ == 5);
+     * static_assert(decode_jpi("(3+)").uncertain);
+     * static_assert(!decode_jpi("").known());
+     * @endcode
      */
-    inline double convert_jpi_to_double(const std::string& jpi_string) noexcept {
-        std::string s = jpi_string;
+    constexpr NuclearSpin decode_jpi(std::string_view jpi) noexcept {
+        NuclearSpin result;
 
-        if (s.empty()) {
-            return std::numeric_limits<double>::quiet_NaN();
+        while (!jpi.empty() && jpi.front() == ' ') {
+            jpi.remove_prefix(1);
         }
-
-        std::erase_if(s, [](const char c) {
-            return c == '(' || c == ')' || c == '*' || c == '#';
-        });
-
-        if (s == "+" || s == "-") {
-            return 0.0;
+        if (const size_t blank = jpi.find(' '); blank != std::string_view::npos) {
+            jpi = jpi.substr(0, blank);
+        }
+        if (const size_t separator = jpi.find_first_of(",:"); separator != std::string_view::npos) {
+            jpi = jpi.substr(0, separator);
         }
 
-        if (const size_t comma_pos = s.find(','); comma_pos != std::string::npos) {
-            s = s.substr(0, comma_pos);
+        char buffer[16]{};
+        size_t length = 0;
+        for (const char c : jpi) {
+            if (c == '(' || c == ')' || c == '#') {
+                result.uncertain = true;
+                continue;
+            }
+            if (c == '*') {
+                continue;
+            }
+            if (length == sizeof(buffer)) {
+                return result;
+            }
+            buffer[length++] = c;
         }
+        std::string_view s(buffer, length);
 
         if (!s.empty() && (s.back() == '+' || s.back() == '-')) {
-            s.pop_back();
+            result.parity = s.back() == '+' ? Parity::POSITIVE : Parity::NEGATIVE;
+            s.remove_suffix(1);
         }
 
         if (s.empty()) {
-            return std::numeric_limits<double>::quiet_NaN();
+            if (result.parity != Parity::UNKNOWN) {
+                result.twoJ = 0;
+            }
+            return result;
         }
 
-        try {
-            if (size_t slash_pos = s.find('/'); slash_pos != std::string::npos) {
-                if (slash_pos == 0) {
-                    s = "1" + s;
-                    slash_pos = 1;
-                }
-                const std::string numerator_str = s.substr(0, slash_pos);
-                const std::string denominator_str = s.substr(slash_pos + 1);
-                if (denominator_str.empty()) {
-                    return std::numeric_limits<double>::quiet_NaN();
-                }
-                const double numerator = std::stod(numerator_str);
-                const double denominator = std::stod(denominator_str);
-                if (denominator == 0.0) {
-                    return std::numeric_limits<double>::quiet_NaN();
+        auto parse_digits = [](std::string_view& text, int& value) {
+            if (text.empty() || text.front() < '0' || text.front() > '9') {
+                return false;
+            }
+            value = 0;
+            while (!text.empty() && text.front() >= '0' && text.front() <= '9') {
+                value = value * 10 + (text.front() - '0');
+                if (value > 10000) {
+                    return false;
                 }
-                return numerator / denominator;
-            } else {
-                return std::stod(s);
+                text.remove_prefix(1);
             }
-        } catch (const std::invalid_argument&) {
-            return std::numeric_limits<double>::quiet_NaN();
-        } catch (const std::out_of_range&) {
-            return std::numeric_limits<double>::quiet_NaN();
+            return true;
+        };
+
+        int numerator = 1;
+        if (s.front() != '/' && !parse_digits(s, numerator)) {
+            return result;
         }
+        int denominator = 1;
+        if (!s.empty() && s.front() == '/') {
+            s.remove_prefix(1);
+            if (!parse_digits(s, denominator) || (denominator != 1 && denominator != 2)) {
+                return result;
+            }
+        }
+        if (!s.empty()) {
+            return result;
+        }
+
+        result.twoJ = static_cast<std::int16_t>(denominator == 2 ? numerator : 2 * numerator);
+        return result;
+    }
+
+    /**
+     * @brief Converts a spin-parity string (JPI string) to a double-precision floating-point number representing the spin.
+     *
+     * @details Equivalent to `decode_jpi(jpi_string).spin()`; kept for callers that only need the numeric spin.
+     *
+     * @param jpi_string The spin-parity string to convert.
+     * @return The spin value as a `double`. Returns `NaN` for invalid or unparsable strings.
+     */
+    inline double convert_jpi_to_double(const std::string& jpi_string) noexcept {
+        return decode_jpi(jpi_string).spin();
     }
 
 }
@@ -429,3 +573,22 @@ struct std::hash<fourdst::atomic::Species> {
         return std::hash<std::string>()(s.m_name);
     }
 };
+
+/**
+ * @brief Specialization of `std::formatter` for `fourdst::atomic::Species`.
+ *
+ * @details Formats the species name and accepts the standard string format spec, so fill,
+ * alignment and width work as for `std::string_view`.
+ *
+ * @par Usage Example
+ * @code
+ * std::println("{:>6} {}", fourdst::atomic::He_4, fourdst::atomic::C_12); // "  He-4 C-12"
+ * @endcode
+ */
+template<>
+struct std::formatter<fourdst::atomic::Species> : std::formatter<std::string_view> {
+    template <typename FormatContext>
+    auto format(const fourdst::atomic::Species& s, FormatContext& ctx) const {
+        return std::formatter<std::string_view>::format(s.name(), ctx);
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace fourdst::atomic {
+    /**
+     * @brief Radioactive decay modes of the NUBASE evaluation.
+     *
+     * @details Each mode corresponds to one NUBASE decay-mode token, given in the comments.
+     * β-delayed modes name the particles emitted after the β decay.
+     */
+    enum class DecayMode : std::uint8_t {
+        BETA_MINUS,                  ///< "B-"
+        BETA_MINUS_NEUTRON,          ///< "B-n"
+        BETA_MINUS_TWO_NEUTRON,      ///< "B-2n"
+        BETA_MINUS_THREE_NEUTRON,    ///< "B-3n"
+        BETA_MINUS_FOUR_NEUTRON,     ///< "B-4n"
+        BETA_MINUS_PROTON,           ///< "B-p"
+        BETA_MINUS_DEUTERON,         ///< "B-d"
+        BETA_MINUS_TRITON,           ///< "B-t"
+        BETA_MINUS_ALPHA,            ///< "B-A"
+        BETA_MINUS_FISSION,          ///< "B-SF"
+        DOUBLE_BETA_MINUS,           ///< "2B-"
+        BETA_PLUS,                   ///< "B+" (electron capture and positron emission together), "EC+B+"
+        ELECTRON_CAPTURE,            ///< "EC"
+        POSITRON_EMISSION,           ///< "e+"
+        BETA_PLUS_PROTON,            ///< "B+p"
+        BETA_PLUS_TWO_PROTON,        ///< "B+2p"
+        BETA_PLUS_THREE_PROTON,      ///< "B+3p"
+        BETA_PLUS_ALPHA,             ///< "B+A"
+        BETA_PLUS_PROTON_ALPHA,      ///< "B+pA"
+        BETA_PLUS_FISSION,           ///< "B+SF"
+        DOUBLE_BETA_PLUS,            ///< "2B+"
+        ALPHA,                       ///< "A"
+        PROTON,                      ///< "p"
+        TWO_PROTON,                  ///< "2p"
+        THREE_PROTON,                ///< "3p"
+        NEUTRON,                     ///< "n"
+        TWO_NEUTRON,                 ///< "2n"
+        THREE_NEUTRON,               ///< "3n"
+        ISOMERIC_TRANSITION,         ///< "IT"
+        SPONTANEOUS_FISSION,         ///< "SF"
+        CLUSTER                      ///< Emission of a nucleus heavier than 4He, e.g. "14C"
+    };
+
+    /**
+     * @struct DecayBranch
+     * @brief One decay channel of a nuclide, as decoded from its decay-mode string.
+     */
+    struct DecayBranch {
+        DecayMode mode; ///< Decay mode.
+        double branchingRatio; ///< Fraction of all decays (0 to 1) going through this channel; NaN if not measured.
+        int daughterZ; ///< Charge number of the daughter; -1 for fission.
+        int daughterA; ///< Mass number of the daughter; -1 for fission.
+    };
+
+    /**
+     * @brief Gets the NUBASE token of a decay mode.
+     * @param[in] mode The decay mode.
+     * @return The token, e.g. "B-n"; "cluster" for CLUSTER.
+     */
+    [[nodiscard]] std::string_view toString(DecayMode mode) noexcept;
+
+    /**
+     * @brief Decodes a NUBASE decay-mode string into exclusive decay channels.
+     *
+     * @details The string is a `;` separated list of entries such as `B-=100`, `B-n=16 1`,
+     * `A ?` or `SF<0.0006`. The intensity after the relation (`=`, `~`, `<`, `>`) is read as a
+     * percentage and the uncertainty after it is ignored; `?` gives a NaN ratio. Isotopic
+     * abundances (`IS=...`) are not decays and are skipped, as are entries with an unknown mode.
+     *
+     * NUBASE counts every β-delayed branch (e.g. `B-n`) as part of the β branch and lists the
+     * electron capture and positron parts of a `B+` branch in addition to it. The returned
+     * channels are made exclusive, so that their ratios add up to one for a fully measured
+     * nuclide: known β-delayed ratios are subtracted from their β channel, and `EC`/`e+` entries
+     * are dropped when a `B+` entry is present.
+     *
+     * @param[in] decayModes The decay-mode string (NUBASE columns 120 to 209).
+     * @param[in] z Charge number of the decaying nuclide.
+     * @param[in] a Mass number of the decaying nuclide.
+     * @return The channels, in the order of the string.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * // 8He: 100% β-, of which 16% are followed by a neutron and 0.9% by a triton
+     * const auto branches = fourdst::atomic::parseDecayModes("B-=100;B-n=16 1;B-t=0.9 1", 2, 8);
+     * // {BETA_MINUS, 0.831, 3, 8}, {BETA_MINUS_NEUTRON, 0.16, 3, 7}, {BETA_MINUS_TRITON, 0.009, 2, 5}
+     * @endcode
+     */
+    [[nodiscard]] std::vector<DecayBranch> parseDecayModes(std::string_view decayModes, int z, int a);
+}
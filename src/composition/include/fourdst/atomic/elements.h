@@ -2,7 +2,10 @@
 
 #include <unordered_map>
 #include <cstdint>
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <string_view>
 
 /**
  * @file elements.h
@@ -14,6 +17,20 @@
  */
 
 namespace fourdst::atomic {
+    /**
+     * @brief Transparent hash for string keyed maps.
+     *
+     * @details Together with `std::equal_to<>` it lets `find` and `contains` of an
+     * `std::unordered_map<std::string, T>` take a `std::string_view` or a string literal without
+     * building a temporary `std::string`.
+     */
+    struct TransparentStringHash {
+        using is_transparent = void;
+
+        std::size_t operator()(const std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
 
     /**
      * @brief Maps atomic number (Z) to element symbol.
@@ -156,7 +173,7 @@ namespace fourdst::atomic {
      * uint8_t z = fourdst::atomic::symbol_element_map.at("Fe"); // z == 26
      * @endcode
      */
-    static const std::unordered_map<std::string, uint8_t> symbol_element_map = {
+    static const std::unordered_map<std::string, uint8_t, TransparentStringHash, std::equal_to<>> symbol_element_map = {
         {"H", 1u},
         {"He", 2u},
         {"Li", 3u},
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace fourdst::atomic {
+    /**
+     * @struct NuclideZA
+     * @brief Charge and mass number of a nuclide, as decoded by parse_nuclide().
+     */
+    struct NuclideZA {
+        int z; ///< Charge number; 0 for the neutron.
+        int a; ///< Mass number.
+
+        constexpr bool operator==(const NuclideZA&) const = default;
+    };
+
+    namespace detail {
+        /**
+         * @brief Element symbols indexed by charge number; index 0 holds the neutron.
+         */
+        inline constexpr std::array<std::string_view, 119> kElementSymbols{
+            "n", "H", "He", "Li", "Be", "B", "C", "N", "O", "F",
+            "Ne", "Na", "Mg", "Al", "Si", "P", "S", "Cl", "Ar", "K",
+            "Ca", "Sc", "Ti", "V", "Cr", "Mn", "Fe", "Co", "Ni", "Cu",
+            "Zn", "Ga", "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Y",
+            "Zr", "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag", "Cd", "In",
+            "Sn", "Sb", "Te", "I", "Xe", "Cs", "Ba", "La", "Ce", "Pr",
+            "Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Ho", "Er", "Tm",
+            "Yb", "Lu", "Hf", "Ta", "W", "Re", "Os", "Ir", "Pt", "Au",
+            "Hg", "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac",
+            "Th", "Pa", "U", "Np", "Pu", "Am", "Cm", "Bk", "Cf", "Es",
+            "Fm", "Md", "No", "Lr", "Rf", "Db", "Sg", "Bh", "Hs", "Mt",
+            "Ds", "Rg", "Cn", "Nh", "Fl", "Mc", "Lv", "Ts", "Og",
+        };
+
+        constexpr bool is_letter(const char c) noexcept {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+        }
+
+        constexpr bool is_digit(const char c) noexcept {
+            return c >= '0' && c <= '9';
+        }
+
+        constexpr int letter_index(const char c) noexcept {
+            return c >= 'a' ? c - 'a' : c - 'A';
+        }
+
+        /**
+         * @brief Slot of a one or two letter symbol in kElementIndex, ignoring case.
+         */
+        constexpr std::size_t element_slot(const char first, const char second) noexcept {
+            return static_cast<std::size_t>(letter_index(first) * 27 + (second == '\0' ? 0 : letter_index(second) + 1));
+        }
+
+        /**
+         * @brief Charge number of every one or two letter symbol, 0 where no element has the symbol.
+         */
+        inline constexpr std::array<std::uint8_t, 26 * 27> kElementIndex = [] {
+            std::array<std::uint8_t, 26 * 27> index{};
+            for (std::size_t z = 1; z < kElementSymbols.size(); ++z) {
+                const std::string_view symbol = kElementSymbols[z];
+                index[element_slot(symbol[0], symbol.size() > 1 ? symbol[1] : '\0')] = static_cast<std::uint8_t>(z);
+            }
+            return index;
+        }();
+
+        constexpr bool iequals(const std::string_view s, const std::string_view lower) noexcept {
+            if (s.size() != lower.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < s.size(); ++i) {
+                const char c = s[i] >= 'A' && s[i] <= 'Z' ? static_cast<char>(s[i] - 'A' + 'a') : s[i];
+                if (c != lower[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Decodes a nuclide symbol in any of the common notations into its charge and mass number.
+     *
+     * @details Accepted are, with the element symbol in any case and surrounding blanks ignored:
+     * - element then mass number, optionally separated by `-`, `_` or a blank: "Fe-56", "Fe56", "fe56", "FE_56";
+     * - mass number then element: "56Fe", "56-fe";
+     * - the particle names "p", "n", "d", "t" and "alpha" (any case).
+     *
+     * A lone "n" or "N" with mass number 1 is the neutron, so both "n-1" and the lower case
+     * nitrogen of reaction libraries ("n14") decode as expected. Isomer suffixes are not accepted.
+     * The parser neither allocates nor checks that the nuclide exists; SpeciesTable::findNuclide()
+     * resolves the result to a row.
+     *
+     * @param[in] symbol The symbol to decode.
+     * @return The charge and mass number, or std::nullopt if `symbol` is not a nuclide symbol.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * using fourdst::atomic::parse_nuclide;
+     * static_assert(parse_nuclide("56fe") == fourdst::atomic::NuclideZA{26, 56});
+     * static_assert(parse_nuclide("alpha") == fourdst::atomic::NuclideZA{2, 4});
+     * static_assert(!parse_nuclide("Xx-9"));
+     * @endcode
+     */
+    constexpr std::optional<NuclideZA> parse_nuclide(std::string_view symbol) noexcept {
+        while (!symbol.empty() && symbol.front() == ' ') {
+            symbol.remove_prefix(1);
+        }
+        while (!symbol.empty() && symbol.back() == ' ') {
+            symbol.remove_suffix(1);
+        }
+
+        if (detail::iequals(symbol, "p")) return NuclideZA{1, 1};
+        if (detail::iequals(symbol, "n")) return NuclideZA{0, 1};
+        if (detail::iequals(symbol, "d")) return NuclideZA{1, 2};
+        if (detail::iequals(symbol, "t")) return NuclideZA{1, 3};
+        if (detail::iequals(symbol, "alpha")) return NuclideZA{2, 4};
+
+        const auto take_number = [&symbol](int& value) {
+            std::size_t digits = 0;
+            value = 0;
+            while (digits < symbol.size() && digits < 4 && detail::is_digit(symbol[digits])) {
+                value = value * 10 + (symbol[digits] - '0');
+                ++digits;
+            }
+            symbol.remove_prefix(digits);
+            return digits > 0 && digits < 4;
+        };
+        const auto take_letters = [&symbol](std::string_view& letters) {
+            std::size_t count = 0;
+            while (count < symbol.size() && detail::is_letter(symbol[count])) {
+                ++count;
+            }
+            letters = symbol.substr(0, count);
+            symbol.remove_prefix(count);
+            return count == 1 || count == 2;
+        };
+        const auto take_separator = [&symbol] {
+            if (!symbol.empty() && (symbol.front() == '-' || symbol.front() == '_' || symbol.front() == ' ')) {
+                symbol.remove_prefix(1);
+            }
+        };
+
+        int a = 0;
+        std::string_view letters;
+        if (!symbol.empty() && detail::is_digit(symbol.front())) {
+            if (!take_number(a)) return std::nullopt;
+            take_separator();
+            if (!take_letters(letters)) return std::nullopt;
+        } else {
+            if (!take_letters(letters)) return std::nullopt;
+            take_separator();
+            if (!take_number(a)) return std::nullopt;
+        }
+        if (!symbol.empty() || a == 0) {
+            return std::nullopt;
+        }
+
+        if (letters.size() == 1 && (letters[0] == 'n' || letters[0] == 'N') && a == 1) {
+            return NuclideZA{0, 1};
+        }
+        const int z = detail::kElementIndex[detail::element_slot(letters[0], letters.size() > 1 ? letters[1] : '\0')];
+        if (z == 0 || a < z) {
+            return std::nullopt;
+        }
+        return NuclideZA{z, a};
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "fourdst/atomic/species_table.h"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace fourdst::atomic {
+    /**
+     * @struct ReactionTerm
+     * @brief One species of a reaction and its signed stoichiometric coefficient.
+     *
+     * @details Reactants have negative and products positive coefficients, so p + 7Li -> 2 4He
+     * is {H_1, -1}, {Li_7, -1}, {He_4, +2}.
+     */
+    struct ReactionTerm {
+        SpeciesId species; ///< Row of the species in the species table.
+        std::int32_t stoichiometry; ///< Signed stoichiometric coefficient; negative for reactants.
+    };
+    static_assert(sizeof(ReactionTerm) == 8);
+
+    /**
+     * @brief Computes the Q-values of many reactions from the mass excess column of a species table.
+     *
+     * @details Reactions are given in compressed sparse row form: the terms of reaction r are
+     * `terms[offsets[r]]` to `terms[offsets[r + 1] - 1]`. The Q-value is
+     * \f$Q = -\sum_i \nu_i \Delta_i\f$ over the atomic mass excesses \f$\Delta_i\f$, which is the
+     * energy released by reactions conserving charge (and by β- decays and electron captures).
+     * The uncertainty is the mass uncertainties added in quadrature,
+     * \f$\sigma_Q = \sqrt{\sum_i (\nu_i \sigma_i)^2}\f$.
+     *
+     * The computation is a single pass over the terms; the mass excesses are precomputed by the
+     * table, so no species is looked up by name and no mass is converted per reaction.
+     *
+     * @param[in] table The species table the IDs of `terms` refer to.
+     * @param[in] offsets Start of every reaction in `terms`, followed by `terms.size()`; `offsets.size() - 1` reactions.
+     * @param[in] terms The terms of all reactions.
+     * @param[out] qValues Receives the Q-values in MeV; one per reaction.
+     * @param[out] uncertainties Receives the Q-value uncertainties in MeV; one per reaction, or empty to skip them.
+     * @throws std::invalid_argument If `offsets` is not a valid row index of `terms` or an output has the wrong size.
+     * @throws std::out_of_range If a term refers to a species which is not a row of `table`.
+     */
+    void computeQValues(
+        const SpeciesTable& table,
+        std::span<const std::uint32_t> offsets,
+        std::span<const ReactionTerm> terms,
+        std::span<double> qValues,
+        std::span<double> uncertainties = {}
+    );
+
+    /**
+     * @class ReactionQValues
+     * @brief Q-values and their uncertainties of a reaction network.
+     *
+     * @details The values are computed once, by computeQValues(), when the object is built.
+     * cached() keeps the values of every network definition, i.e. of every distinct reaction list
+     * and species table, so that repeated network setups share one computation.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * using namespace fourdst::atomic;
+     * const SpeciesTable& table = SpeciesTable::builtin();
+     * const SpeciesId p = *table.find("H-1"), li7 = *table.find("Li-7"), he4 = *table.find("He-4");
+     * const std::vector<std::uint32_t> offsets{0, 3};
+     * const std::vector<ReactionTerm> terms{{p, -1}, {li7, -1}, {he4, 2}};
+     * const auto q = ReactionQValues::cached(offsets, terms);
+     * // q->qValues()[0] is about 17.35 MeV
+     * @endcode
+     */
+    class ReactionQValues {
+    public:
+        /**
+         * @brief Computes the Q-values of a reaction network; see computeQValues().
+         * @throws std::invalid_argument If `offsets` is not a valid row index of `terms`.
+         * @throws std::out_of_range If a term refers to a species which is not a row of `table`.
+         */
+        ReactionQValues(const SpeciesTable& table, std::span<const std::uint32_t> offsets, std::span<const ReactionTerm> terms);
+
+        /**
+         * @brief Gets the Q-values of a reaction network over the installed species table, computing them on first use.
+         *
+         * @details Uses the table set with SpeciesTable::install(), or the compiled-in table if
+         * none is installed. Thread safe.
+         *
+         * @throws std::invalid_argument If `offsets` is not a valid row index of `terms`.
+         * @throws std::out_of_range If a term refers to a species which is not a row of the table.
+         */
+        [[nodiscard]] static std::shared_ptr<const ReactionQValues> cached(std::span<const std::uint32_t> offsets, std::span<const ReactionTerm> terms);
+
+        /**
+         * @brief Gets the Q-values of a reaction network over the given species table, computing them on first use.
+         * @details Thread safe. Values of a table are dropped from the cache once the cache holds the
+         * only references to it, and the whole cache is cleared when it reaches 1024 networks.
+         * @throws std::invalid_argument If `table` is null or `offsets` is not a valid row index of `terms`.
+         * @throws std::out_of_range If a term refers to a species which is not a row of `table`.
+         */
+        [[nodiscard]] static std::shared_ptr<const ReactionQValues> cached(
+            std::shared_ptr<const SpeciesTable> table,
+            std::span<const std::uint32_t> offsets,
+            std::span<const ReactionTerm> terms
+        );
+
+        /**
+         * @brief Gets the number of reactions.
+         */
+        [[nodiscard]] std::size_t size() const noexcept { return m_qValues.size(); }
+
+        [[nodiscard]] std::span<const double> qValues() const noexcept { return m_qValues; } ///< Q-values (MeV), one per reaction.
+        [[nodiscard]] std::span<const double> uncertainties() const noexcept { return m_uncertainties; } ///< Q-value uncertainties (MeV), one per reaction.
+
+    private:
+        std::vector<double> m_qValues;
+        std::vector<double> m_uncertainties;
+    };
+}
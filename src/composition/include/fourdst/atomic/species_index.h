@@ -0,0 +1,366 @@
+#pragma once
+#include <array>
+
+#include "fourdst/atomic/nuclide_symbol.h"
+
+namespace fourdst::atomic {
+    // Charge and mass number of every species in species.h, in the (Z, A) order of the rows of SpeciesTable::builtin().
+    inline constexpr std::array<NuclideZA, 3558> kBuiltinNuclides{{
+        {0, 1}, {1, 1}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {1, 6}, {1, 7}, {2, 3}, {2, 4},
+        {2, 5}, {2, 6}, {2, 7}, {2, 8}, {2, 9}, {2, 10}, {3, 3}, {3, 4}, {3, 5}, {3, 6},
+        {3, 7}, {3, 8}, {3, 9}, {3, 10}, {3, 11}, {3, 12}, {3, 13}, {4, 5}, {4, 6}, {4, 7},
+        {4, 8}, {4, 9}, {4, 10}, {4, 11}, {4, 12}, {4, 13}, {4, 14}, {4, 15}, {4, 16}, {5, 6},
+        {5, 7}, {5, 8}, {5, 9}, {5, 10}, {5, 11}, {5, 12}, {5, 13}, {5, 14}, {5, 15}, {5, 16},
+        {5, 17}, {5, 18}, {5, 19}, {5, 20}, {5, 21}, {6, 8}, {6, 9}, {6, 10}, {6, 11}, {6, 12},
+        {6, 13}, {6, 14}, {6, 15}, {6, 16}, {6, 17}, {6, 18}, {6, 19}, {6, 20}, {6, 21}, {6, 22},
+        {6, 23}, {7, 10}, {7, 11}, {7, 12}, {7, 13}, {7, 14}, {7, 15}, {7, 16}, {7, 17}, {7, 18},
+        {7, 19}, {7, 20}, {7, 21}, {7, 22}, {7, 23}, {7, 24}, {7, 25}, {8, 11}, {8, 12}, {8, 13},
+        {8, 14}, {8, 15}, {8, 16}, {8, 17}, {8, 18}, {8, 19}, {8, 20}, {8, 21}, {8, 22}, {8, 23},
+        {8, 24}, {8, 25}, {8, 26}, {8, 27}, {8, 28}, {9, 13}, {9, 14}, {9, 15}, {9, 16}, {9, 17},
+        {9, 18}, {9, 19}, {9, 20}, {9, 21}, {9, 22}, {9, 23}, {9, 24}, {9, 25}, {9, 26}, {9, 27},
+        {9, 28}, {9, 29}, {9, 30}, {9, 31}, {10, 15}, {10, 16}, {10, 17}, {10, 18}, {10, 19}, {10, 20},
+        {10, 21}, {10, 22}, {10, 23}, {10, 24}, {10, 25}, {10, 26}, {10, 27}, {10, 28}, {10, 29}, {10, 30},
+        {10, 31}, {10, 32}, {10, 33}, {10, 34}, {11, 17}, {11, 18}, {11, 19}, {11, 20}, {11, 21}, {11, 22},
+        {11, 23}, {11, 24}, {11, 25}, {11, 26}, {11, 27}, {11, 28}, {11, 29}, {11, 30}, {11, 31}, {11, 32},
+        {11, 33}, {11, 34}, {11, 35}, {11, 36}, {11, 37}, {11, 38}, {11, 39}, {12, 19}, {12, 20}, {12, 21},
+        {12, 22}, {12, 23}, {12, 24}, {12, 25}, {12, 26}, {12, 27}, {12, 28}, {12, 29}, {12, 30}, {12, 31},
+        {12, 32}, {12, 33}, {12, 34}, {12, 35}, {12, 36}, {12, 37}, {12, 38}, {12, 39}, {12, 40}, {12, 41},
+        {13, 21}, {13, 22}, {13, 23}, {13, 24}, {13, 25}, {13, 26}, {13, 27}, {13, 28}, {13, 29}, {13, 30},
+        {13, 31}, {13, 32}, {13, 33}, {13, 34}, {13, 35}, {13, 36}, {13, 37}, {13, 38}, {13, 39}, {13, 40},
+        {13, 41}, {13, 42}, {13, 43}, {14, 22}, {14, 23}, {14, 24}, {14, 25}, {14, 26}, {14, 27}, {14, 28},
+        {14, 29}, {14, 30}, {14, 31}, {14, 32}, {14, 33}, {14, 34}, {14, 35}, {14, 36}, {14, 37}, {14, 38},
+        {14, 39}, {14, 40}, {14, 41}, {14, 42}, {14, 43}, {14, 44}, {14, 45}, {15, 24}, {15, 25}, {15, 26},
+        {15, 27}, {15, 28}, {15, 29}, {15, 30}, {15, 31}, {15, 32}, {15, 33}, {15, 34}, {15, 35}, {15, 36},
+        {15, 37}, {15, 38}, {15, 39}, {15, 40}, {15, 41}, {15, 42}, {15, 43}, {15, 44}, {15, 45}, {15, 46},
+        {15, 47}, {16, 26}, {16, 27}, {16, 28}, {16, 29}, {16, 30}, {16, 31}, {16, 32}, {16, 33}, {16, 34},
+        {16, 35}, {16, 36}, {16, 37}, {16, 38}, {16, 39}, {16, 40}, {16, 41}, {16, 42}, {16, 43}, {16, 44},
+        {16, 45}, {16, 46}, {16, 47}, {16, 48}, {16, 49}, {17, 28}, {17, 29}, {17, 30}, {17, 31}, {17, 32},
+        {17, 33}, {17, 34}, {17, 35}, {17, 36}, {17, 37}, {17, 38}, {17, 39}, {17, 40}, {17, 41}, {17, 42},
+        {17, 43}, {17, 44}, {17, 45}, {17, 46}, {17, 47}, {17, 48}, {17, 49}, {17, 50}, {17, 51}, {17, 52},
+        {18, 29}, {18, 30}, {18, 31}, {18, 32}, {18, 33}, {18, 34}, {18, 35}, {18, 36}, {18, 37}, {18, 38},
+        {18, 39}, {18, 40}, {18, 41}, {18, 42}, {18, 43}, {18, 44}, {18, 45}, {18, 46}, {18, 47}, {18, 48},
+        {18, 49}, {18, 50}, {18, 51}, {18, 52}, {18, 53}, {18, 54}, {19, 31}, {19, 32}, {19, 33}, {19, 34},
+        {19, 35}, {19, 36}, {19, 37}, {19, 38}, {19, 39}, {19, 40}, {19, 41}, {19, 42}, {19, 43}, {19, 44},
+        {19, 45}, {19, 46}, {19, 47}, {19, 48}, {19, 49}, {19, 50}, {19, 51}, {19, 52}, {19, 53}, {19, 54},
+        {19, 55}, {19, 56}, {19, 57}, {19, 58}, {19, 59}, {20, 33}, {20, 34}, {20, 35}, {20, 36}, {20, 37},
+        {20, 38}, {20, 39}, {20, 40}, {20, 41}, {20, 42}, {20, 43}, {20, 44}, {20, 45}, {20, 46}, {20, 47},
+        {20, 48}, {20, 49}, {20, 50}, {20, 51}, {20, 52}, {20, 53}, {20, 54}, {20, 55}, {20, 56}, {20, 57},
+        {20, 58}, {20, 59}, {20, 60}, {20, 61}, {21, 35}, {21, 36}, {21, 37}, {21, 38}, {21, 39}, {21, 40},
+        {21, 41}, {21, 42}, {21, 43}, {21, 44}, {21, 45}, {21, 46}, {21, 47}, {21, 48}, {21, 49}, {21, 50},
+        {21, 51}, {21, 52}, {21, 53}, {21, 54}, {21, 55}, {21, 56}, {21, 57}, {21, 58}, {21, 59}, {21, 60},
+        {21, 61}, {21, 62}, {21, 63}, {22, 37}, {22, 38}, {22, 39}, {22, 40}, {22, 41}, {22, 42}, {22, 43},
+        {22, 44}, {22, 45}, {22, 46}, {22, 47}, {22, 48}, {22, 49}, {22, 50}, {22, 51}, {22, 52}, {22, 53},
+        {22, 54}, {22, 55}, {22, 56}, {22, 57}, {22, 58}, {22, 59}, {22, 60}, {22, 61}, {22, 62}, {22, 63},
+        {22, 64}, {22, 65}, {23, 39}, {23, 40}, {23, 41}, {23, 42}, {23, 43}, {23, 44}, {23, 45}, {23, 46},
+        {23, 47}, {23, 48}, {23, 49}, {23, 50}, {23, 51}, {23, 52}, {23, 53}, {23, 54}, {23, 55}, {23, 56},
+        {23, 57}, {23, 58}, {23, 59}, {23, 60}, {23, 61}, {23, 62}, {23, 63}, {23, 64}, {23, 65}, {23, 66},
+        {23, 67}, {24, 41}, {24, 42}, {24, 43}, {24, 44}, {24, 45}, {24, 46}, {24, 47}, {24, 48}, {24, 49},
+        {24, 50}, {24, 51}, {24, 52}, {24, 53}, {24, 54}, {24, 55}, {24, 56}, {24, 57}, {24, 58}, {24, 59},
+        {24, 60}, {24, 61}, {24, 62}, {24, 63}, {24, 64}, {24, 65}, {24, 66}, {24, 67}, {24, 68}, {24, 69},
+        {24, 70}, {25, 43}, {25, 44}, {25, 45}, {25, 46}, {25, 47}, {25, 48}, {25, 49}, {25, 50}, {25, 51},
+        {25, 52}, {25, 53}, {25, 54}, {25, 55}, {25, 56}, {25, 57}, {25, 58}, {25, 59}, {25, 60}, {25, 61},
+        {25, 62}, {25, 63}, {25, 64}, {25, 65}, {25, 66}, {25, 67}, {25, 68}, {25, 69}, {25, 70}, {25, 71},
+        {25, 72}, {25, 73}, {26, 45}, {26, 46}, {26, 47}, {26, 48}, {26, 49}, {26, 50}, {26, 51}, {26, 52},
+        {26, 53}, {26, 54}, {26, 55}, {26, 56}, {26, 57}, {26, 58}, {26, 59}, {26, 60}, {26, 61}, {26, 62},
+        {26, 63}, {26, 64}, {26, 65}, {26, 66}, {26, 67}, {26, 68}, {26, 69}, {26, 70}, {26, 71}, {26, 72},
+        {26, 73}, {26, 74}, {26, 75}, {26, 76}, {27, 47}, {27, 48}, {27, 49}, {27, 50}, {27, 51}, {27, 52},
+        {27, 53}, {27, 54}, {27, 55}, {27, 56}, {27, 57}, {27, 58}, {27, 59}, {27, 60}, {27, 61}, {27, 62},
+        {27, 63}, {27, 64}, {27, 65}, {27, 66}, {27, 67}, {27, 68}, {27, 69}, {27, 70}, {27, 71}, {27, 72},
+        {27, 73}, {27, 74}, {27, 75}, {27, 76}, {27, 77}, {27, 78}, {28, 48}, {28, 49}, {28, 50}, {28, 51},
+        {28, 52}, {28, 53}, {28, 54}, {28, 55}, {28, 56}, {28, 57}, {28, 58}, {28, 59}, {28, 60}, {28, 61},
+        {28, 62}, {28, 63}, {28, 64}, {28, 65}, {28, 66}, {28, 67}, {28, 68}, {28, 69}, {28, 70}, {28, 71},
+        {28, 72}, {28, 73}, {28, 74}, {28, 75}, {28, 76}, {28, 77}, {28, 78}, {28, 79}, {28, 80}, {28, 81},
+        {28, 82}, {29, 52}, {29, 53}, {29, 54}, {29, 55}, {29, 56}, {29, 57}, {29, 58}, {29, 59}, {29, 60},
+        {29, 61}, {29, 62}, {29, 63}, {29, 64}, {29, 65}, {29, 66}, {29, 67}, {29, 68}, {29, 69}, {29, 70},
+        {29, 71}, {29, 72}, {29, 73}, {29, 74}, {29, 75}, {29, 76}, {29, 77}, {29, 78}, {29, 79}, {29, 80},
+        {29, 81}, {29, 82}, {29, 83}, {29, 84}, {30, 54}, {30, 55}, {30, 56}, {30, 57}, {30, 58}, {30, 59},
+        {30, 60}, {30, 61}, {30, 62}, {30, 63}, {30, 64}, {30, 65}, {30, 66}, {30, 67}, {30, 68}, {30, 69},
+        {30, 70}, {30, 71}, {30, 72}, {30, 73}, {30, 74}, {30, 75}, {30, 76}, {30, 77}, {30, 78}, {30, 79},
+        {30, 80}, {30, 81}, {30, 82}, {30, 83}, {30, 84}, {30, 85}, {30, 86}, {31, 56}, {31, 57}, {31, 58},
+        {31, 59}, {31, 60}, {31, 61}, {31, 62}, {31, 63}, {31, 64}, {31, 65}, {31, 66}, {31, 67}, {31, 68},
+        {31, 69}, {31, 70}, {31, 71}, {31, 72}, {31, 73}, {31, 74}, {31, 75}, {31, 76}, {31, 77}, {31, 78},
+        {31, 79}, {31, 80}, {31, 81}, {31, 82}, {31, 83}, {31, 84}, {31, 85}, {31, 86}, {31, 87}, {31, 88},
+        {32, 58}, {32, 59}, {32, 60}, {32, 61}, {32, 62}, {32, 63}, {32, 64}, {32, 65}, {32, 66}, {32, 67},
+        {32, 68}, {32, 69}, {32, 70}, {32, 71}, {32, 72}, {32, 73}, {32, 74}, {32, 75}, {32, 76}, {32, 77},
+        {32, 78}, {32, 79}, {32, 80}, {32, 81}, {32, 82}, {32, 83}, {32, 84}, {32, 85}, {32, 86}, {32, 87},
+        {32, 88}, {32, 89}, {32, 90}, {33, 60}, {33, 61}, {33, 62}, {33, 63}, {33, 64}, {33, 65}, {33, 66},
+        {33, 67}, {33, 68}, {33, 69}, {33, 70}, {33, 71}, {33, 72}, {33, 73}, {33, 74}, {33, 75}, {33, 76},
+        {33, 77}, {33, 78}, {33, 79}, {33, 80}, {33, 81}, {33, 82}, {33, 83}, {33, 84}, {33, 85}, {33, 86},
+        {33, 87}, {33, 88}, {33, 89}, {33, 90}, {33, 91}, {33, 92}, {34, 63}, {34, 64}, {34, 65}, {34, 66},
+        {34, 67}, {34, 68}, {34, 69}, {34, 70}, {34, 71}, {34, 72}, {34, 73}, {34, 74}, {34, 75}, {34, 76},
+        {34, 77}, {34, 78}, {34, 79}, {34, 80}, {34, 81}, {34, 82}, {34, 83}, {34, 84}, {34, 85}, {34, 86},
+        {34, 87}, {34, 88}, {34, 89}, {34, 90}, {34, 91}, {34, 92}, {34, 93}, {34, 94}, {34, 95}, {35, 65},
+        {35, 66}, {35, 67}, {35, 68}, {35, 69}, {35, 70}, {35, 71}, {35, 72}, {35, 73}, {35, 74}, {35, 75},
+        {35, 76}, {35, 77}, {35, 78}, {35, 79}, {35, 80}, {35, 81}, {35, 82}, {35, 83}, {35, 84}, {35, 85},
+        {35, 86}, {35, 87}, {35, 88}, {35, 89}, {35, 90}, {35, 91}, {35, 92}, {35, 93}, {35, 94}, {35, 95},
+        {35, 96}, {35, 97}, {35, 98}, {36, 67}, {36, 68}, {36, 69}, {36, 70}, {36, 71}, {36, 72}, {36, 73},
+        {36, 74}, {36, 75}, {36, 76}, {36, 77}, {36, 78}, {36, 79}, {36, 80}, {36, 81}, {36, 82}, {36, 83},
+        {36, 84}, {36, 85}, {36, 86}, {36, 87}, {36, 88}, {36, 89}, {36, 90}, {36, 91}, {36, 92}, {36, 93},
+        {36, 94}, {36, 95}, {36, 96}, {36, 97}, {36, 98}, {36, 99}, {36, 100}, {36, 101}, {37, 71}, {37, 72},
+        {37, 73}, {37, 74}, {37, 75}, {37, 76}, {37, 77}, {37, 78}, {37, 79}, {37, 80}, {37, 81}, {37, 82},
+        {37, 83}, {37, 84}, {37, 85}, {37, 86}, {37, 87}, {37, 88}, {37, 89}, {37, 90}, {37, 91}, {37, 92},
+        {37, 93}, {37, 94}, {37, 95}, {37, 96}, {37, 97}, {37, 98}, {37, 99}, {37, 100}, {37, 101}, {37, 102},
+        {37, 103}, {37, 104}, {38, 73}, {38, 74}, {38, 75}, {38, 76}, {38, 77}, {38, 78}, {38, 79}, {38, 80},
+        {38, 81}, {38, 82}, {38, 83}, {38, 84}, {38, 85}, {38, 86}, {38, 87}, {38, 88}, {38, 89}, {38, 90},
+        {38, 91}, {38, 92}, {38, 93}, {38, 94}, {38, 95}, {38, 96}, {38, 97}, {38, 98}, {38, 99}, {38, 100},
+        {38, 101}, {38, 102}, {38, 103}, {38, 104}, {38, 105}, {38, 106}, {38, 107}, {39, 75}, {39, 76}, {39, 77},
+        {39, 78}, {39, 79}, {39, 80}, {39, 81}, {39, 82}, {39, 83}, {39, 84}, {39, 85}, {39, 86}, {39, 87},
+        {39, 88}, {39, 89}, {39, 90}, {39, 91}, {39, 92}, {39, 93}, {39, 94}, {39, 95}, {39, 96}, {39, 97},
+        {39, 98}, {39, 99}, {39, 100}, {39, 101}, {39, 102}, {39, 103}, {39, 104}, {39, 105}, {39, 106}, {39, 107},
+        {39, 108}, {39, 109}, {40, 77}, {40, 78}, {40, 79}, {40, 80}, {40, 81}, {40, 82}, {40, 83}, {40, 84},
+        {40, 85}, {40, 86}, {40, 87}, {40, 88}, {40, 89}, {40, 90}, {40, 91}, {40, 92}, {40, 93}, {40, 94},
+        {40, 95}, {40, 96}, {40, 97}, {40, 98}, {40, 99}, {40, 100}, {40, 101}, {40, 102}, {40, 103}, {40, 104},
+        {40, 105}, {40, 106}, {40, 107}, {40, 108}, {40, 109}, {40, 110}, {40, 111}, {40, 112}, {40, 113}, {41, 79},
+        {41, 80}, {41, 81}, {41, 82}, {41, 83}, {41, 84}, {41, 85}, {41, 86}, {41, 87}, {41, 88}, {41, 89},
+        {41, 90}, {41, 91}, {41, 92}, {41, 93}, {41, 94}, {41, 95}, {41, 96}, {41, 97}, {41, 98}, {41, 99},
+        {41, 100}, {41, 101}, {41, 102}, {41, 103}, {41, 104}, {41, 105}, {41, 106}, {41, 107}, {41, 108}, {41, 109},
+        {41, 110}, {41, 111}, {41, 112}, {41, 113}, {41, 114}, {41, 115}, {41, 116}, {42, 81}, {42, 82}, {42, 83},
+        {42, 84}, {42, 85}, {42, 86}, {42, 87}, {42, 88}, {42, 89}, {42, 90}, {42, 91}, {42, 92}, {42, 93},
+        {42, 94}, {42, 95}, {42, 96}, {42, 97}, {42, 98}, {42, 99}, {42, 100}, {42, 101}, {42, 102}, {42, 103},
+        {42, 104}, {42, 105}, {42, 106}, {42, 107}, {42, 108}, {42, 109}, {42, 110}, {42, 111}, {42, 112}, {42, 113},
+        {42, 114}, {42, 115}, {42, 116}, {42, 117}, {42, 118}, {42, 119}, {43, 83}, {43, 84}, {43, 85}, {43, 86},
+        {43, 87}, {43, 88}, {43, 89}, {43, 90}, {43, 91}, {43, 92}, {43, 93}, {43, 94}, {43, 95}, {43, 96},
+        {43, 97}, {43, 98}, {43, 99}, {43, 100}, {43, 101}, {43, 102}, {43, 103}, {43, 104}, {43, 105}, {43, 106},
+        {43, 107}, {43, 108}, {43, 109}, {43, 110}, {43, 111}, {43, 112}, {43, 113}, {43, 114}, {43, 115}, {43, 116},
+        {43, 117}, {43, 118}, {43, 119}, {43, 120}, {43, 121}, {43, 122}, {44, 85}, {44, 86}, {44, 87}, {44, 88},
+        {44, 89}, {44, 90}, {44, 91}, {44, 92}, {44, 93}, {44, 94}, {44, 95}, {44, 96}, {44, 97}, {44, 98},
+        {44, 99}, {44, 100}, {44, 101}, {44, 102}, {44, 103}, {44, 104}, {44, 105}, {44, 106}, {44, 107}, {44, 108},
+        {44, 109}, {44, 110}, {44, 111}, {44, 112}, {44, 113}, {44, 114}, {44, 115}, {44, 116}, {44, 117}, {44, 118},
+        {44, 119}, {44, 120}, {44, 121}, {44, 122}, {44, 123}, {44, 124}, {44, 125}, {45, 88}, {45, 89}, {45, 90},
+        {45, 91}, {45, 92}, {45, 93}, {45, 94}, {45, 95}, {45, 96}, {45, 97}, {45, 98}, {45, 99}, {45, 100},
+        {45, 101}, {45, 102}, {45, 103}, {45, 104}, {45, 105}, {45, 106}, {45, 107}, {45, 108}, {45, 109}, {45, 110},
+        {45, 111}, {45, 112}, {45, 113}, {45, 114}, {45, 115}, {45, 116}, {45, 117}, {45, 118}, {45, 119}, {45, 120},
+        {45, 121}, {45, 122}, {45, 123}, {45, 124}, {45, 125}, {45, 126}, {45, 127}, {45, 128}, {46, 90}, {46, 91},
+        {46, 92}, {46, 93}, {46, 94}, {46, 95}, {46, 96}, {46, 97}, {46, 98}, {46, 99}, {46, 100}, {46, 101},
+        {46, 102}, {46, 103}, {46, 104}, {46, 105}, {46, 106}, {46, 107}, {46, 108}, {46, 109}, {46, 110}, {46, 111},
+        {46, 112}, {46, 113}, {46, 114}, {46, 115}, {46, 116}, {46, 117}, {46, 118}, {46, 119}, {46, 120}, {46, 121},
+        {46, 122}, {46, 123}, {46, 124}, {46, 125}, {46, 126}, {46, 127}, {46, 128}, {46, 129}, {46, 130}, {46, 131},
+        {47, 92}, {47, 93}, {47, 94}, {47, 95}, {47, 96}, {47, 97}, {47, 98}, {47, 99}, {47, 100}, {47, 101},
+        {47, 102}, {47, 103}, {47, 104}, {47, 105}, {47, 106}, {47, 107}, {47, 108}, {47, 109}, {47, 110}, {47, 111},
+        {47, 112}, {47, 113}, {47, 114}, {47, 115}, {47, 116}, {47, 117}, {47, 118}, {47, 119}, {47, 120}, {47, 121},
+        {47, 122}, {47, 123}, {47, 124}, {47, 125}, {47, 126}, {47, 127}, {47, 128}, {47, 129}, {47, 130}, {47, 131},
+        {47, 132}, {47, 133}, {48, 94}, {48, 95}, {48, 96}, {48, 97}, {48, 98}, {48, 99}, {48, 100}, {48, 101},
+        {48, 102}, {48, 103}, {48, 104}, {48, 105}, {48, 106}, {48, 107}, {48, 108}, {48, 109}, {48, 110}, {48, 111},
+        {48, 112}, {48, 113}, {48, 114}, {48, 115}, {48, 116}, {48, 117}, {48, 118}, {48, 119}, {48, 120}, {48, 121},
+        {48, 122}, {48, 123}, {48, 124}, {48, 125}, {48, 126}, {48, 127}, {48, 128}, {48, 129}, {48, 130}, {48, 131},
+        {48, 132}, {48, 133}, {48, 134}, {48, 135}, {49, 96}, {49, 97}, {49, 98}, {49, 99}, {49, 100}, {49, 101},
+        {49, 102}, {49, 103}, {49, 104}, {49, 105}, {49, 106}, {49, 107}, {49, 108}, {49, 109}, {49, 110}, {49, 111},
+        {49, 112}, {49, 113}, {49, 114}, {49, 115}, {49, 116}, {49, 117}, {49, 118}, {49, 119}, {49, 120}, {49, 121},
+        {49, 122}, {49, 123}, {49, 124}, {49, 125}, {49, 126}, {49, 127}, {49, 128}, {49, 129}, {49, 130}, {49, 131},
+        {49, 132}, {49, 133}, {49, 134}, {49, 135}, {49, 136}, {49, 137}, {50, 99}, {50, 100}, {50, 101}, {50, 102},
+        {50, 103}, {50, 104}, {50, 105}, {50, 106}, {50, 107}, {50, 108}, {50, 109}, {50, 110}, {50, 111}, {50, 112},
+        {50, 113}, {50, 114}, {50, 115}, {50, 116}, {50, 117}, {50, 118}, {50, 119}, {50, 120}, {50, 121}, {50, 122},
+        {50, 123}, {50, 124}, {50, 125}, {50, 126}, {50, 127}, {50, 128}, {50, 129}, {50, 130}, {50, 131}, {50, 132},
+        {50, 133}, {50, 134}, {50, 135}, {50, 136}, {50, 137}, {50, 138}, {50, 139}, {50, 140}, {51, 102}, {51, 103},
+        {51, 104}, {51, 105}, {51, 106}, {51, 107}, {51, 108}, {51, 109}, {51, 110}, {51, 111}, {51, 112}, {51, 113},
+        {51, 114}, {51, 115}, {51, 116}, {51, 117}, {51, 118}, {51, 119}, {51, 120}, {51, 121}, {51, 122}, {51, 123},
+        {51, 124}, {51, 125}, {51, 126}, {51, 127}, {51, 128}, {51, 129}, {51, 130}, {51, 131}, {51, 132}, {51, 133},
+        {51, 134}, {51, 135}, {51, 136}, {51, 137}, {51, 138}, {51, 139}, {51, 140}, {51, 141}, {51, 142}, {52, 104},
+        {52, 105}, {52, 106}, {52, 107}, {52, 108}, {52, 109}, {52, 110}, {52, 111}, {52, 112}, {52, 113}, {52, 114},
+        {52, 115}, {52, 116}, {52, 117}, {52, 118}, {52, 119}, {52, 120}, {52, 121}, {52, 122}, {52, 123}, {52, 124},
+        {52, 125}, {52, 126}, {52, 127}, {52, 128}, {52, 129}, {52, 130}, {52, 131}, {52, 132}, {52, 133}, {52, 134},
+        {52, 135}, {52, 136}, {52, 137}, {52, 138}, {52, 139}, {52, 140}, {52, 141}, {52, 142}, {52, 143}, {52, 144},
+        {52, 145}, {53, 106}, {53, 107}, {53, 108}, {53, 109}, {53, 110}, {53, 111}, {53, 112}, {53, 113}, {53, 114},
+        {53, 115}, {53, 116}, {53, 117}, {53, 118}, {53, 119}, {53, 120}, {53, 121}, {53, 122}, {53, 123}, {53, 124},
+        {53, 125}, {53, 126}, {53, 127}, {53, 128}, {53, 129}, {53, 130}, {53, 131}, {53, 132}, {53, 133}, {53, 134},
+        {53, 135}, {53, 136}, {53, 137}, {53, 138}, {53, 139}, {53, 140}, {53, 141}, {53, 142}, {53, 143}, {53, 144},
+        {53, 145}, {53, 146}, {53, 147}, {54, 108}, {54, 109}, {54, 110}, {54, 111}, {54, 112}, {54, 113}, {54, 114},
+        {54, 115}, {54, 116}, {54, 117}, {54, 118}, {54, 119}, {54, 120}, {54, 121}, {54, 122}, {54, 123}, {54, 124},
+        {54, 125}, {54, 126}, {54, 127}, {54, 128}, {54, 129}, {54, 130}, {54, 131}, {54, 132}, {54, 133}, {54, 134},
+        {54, 135}, {54, 136}, {54, 137}, {54, 138}, {54, 139}, {54, 140}, {54, 141}, {54, 142}, {54, 143}, {54, 144},
+        {54, 145}, {54, 146}, {54, 147}, {54, 148}, {54, 149}, {54, 150}, {55, 111}, {55, 112}, {55, 113}, {55, 114},
+        {55, 115}, {55, 116}, {55, 117}, {55, 118}, {55, 119}, {55, 120}, {55, 121}, {55, 122}, {55, 123}, {55, 124},
+        {55, 125}, {55, 126}, {55, 127}, {55, 128}, {55, 129}, {55, 130}, {55, 131}, {55, 132}, {55, 133}, {55, 134},
+        {55, 135}, {55, 136}, {55, 137}, {55, 138}, {55, 139}, {55, 140}, {55, 141}, {55, 142}, {55, 143}, {55, 144},
+        {55, 145}, {55, 146}, {55, 147}, {55, 148}, {55, 149}, {55, 150}, {55, 151}, {55, 152}, {56, 113}, {56, 114},
+        {56, 115}, {56, 116}, {56, 117}, {56, 118}, {56, 119}, {56, 120}, {56, 121}, {56, 122}, {56, 123}, {56, 124},
+        {56, 125}, {56, 126}, {56, 127}, {56, 128}, {56, 129}, {56, 130}, {56, 131}, {56, 132}, {56, 133}, {56, 134},
+        {56, 135}, {56, 136}, {56, 137}, {56, 138}, {56, 139}, {56, 140}, {56, 141}, {56, 142}, {56, 143}, {56, 144},
+        {56, 145}, {56, 146}, {56, 147}, {56, 148}, {56, 149}, {56, 150}, {56, 151}, {56, 152}, {56, 153}, {56, 154},
+        {57, 116}, {57, 117}, {57, 118}, {57, 119}, {57, 120}, {57, 121}, {57, 122}, {57, 123}, {57, 124}, {57, 125},
+        {57, 126}, {57, 127}, {57, 128}, {57, 129}, {57, 130}, {57, 131}, {57, 132}, {57, 133}, {57, 134}, {57, 135},
+        {57, 136}, {57, 137}, {57, 138}, {57, 139}, {57, 140}, {57, 141}, {57, 142}, {57, 143}, {57, 144}, {57, 145},
+        {57, 146}, {57, 147}, {57, 148}, {57, 149}, {57, 150}, {57, 151}, {57, 152}, {57, 153}, {57, 154}, {57, 155},
+        {57, 156}, {57, 157}, {58, 119}, {58, 120}, {58, 121}, {58, 122}, {58, 123}, {58, 124}, {58, 125}, {58, 126},
+        {58, 127}, {58, 128}, {58, 129}, {58, 130}, {58, 131}, {58, 132}, {58, 133}, {58, 134}, {58, 135}, {58, 136},
+        {58, 137}, {58, 138}, {58, 139}, {58, 140}, {58, 141}, {58, 142}, {58, 143}, {58, 144}, {58, 145}, {58, 146},
+        {58, 147}, {58, 148}, {58, 149}, {58, 150}, {58, 151}, {58, 152}, {58, 153}, {58, 154}, {58, 155}, {58, 156},
+        {58, 157}, {58, 158}, {58, 159}, {59, 121}, {59, 122}, {59, 123}, {59, 124}, {59, 125}, {59, 126}, {59, 127},
+        {59, 128}, {59, 129}, {59, 130}, {59, 131}, {59, 132}, {59, 133}, {59, 134}, {59, 135}, {59, 136}, {59, 137},
+        {59, 138}, {59, 139}, {59, 140}, {59, 141}, {59, 142}, {59, 143}, {59, 144}, {59, 145}, {59, 146}, {59, 147},
+        {59, 148}, {59, 149}, {59, 150}, {59, 151}, {59, 152}, {59, 153}, {59, 154}, {59, 155}, {59, 156}, {59, 157},
+        {59, 158}, {59, 159}, {59, 160}, {59, 161}, {60, 124}, {60, 125}, {60, 126}, {60, 127}, {60, 128}, {60, 129},
+        {60, 130}, {60, 131}, {60, 132}, {60, 133}, {60, 134}, {60, 135}, {60, 136}, {60, 137}, {60, 138}, {60, 139},
+        {60, 140}, {60, 141}, {60, 142}, {60, 143}, {60, 144}, {60, 145}, {60, 146}, {60, 147}, {60, 148}, {60, 149},
+        {60, 150}, {60, 151}, {60, 152}, {60, 153}, {60, 154}, {60, 155}, {60, 156}, {60, 157}, {60, 158}, {60, 159},
+        {60, 160}, {60, 161}, {60, 162}, {60, 163}, {61, 126}, {61, 127}, {61, 128}, {61, 129}, {61, 130}, {61, 131},
+        {61, 132}, {61, 133}, {61, 134}, {61, 135}, {61, 136}, {61, 137}, {61, 138}, {61, 139}, {61, 140}, {61, 141},
+        {61, 142}, {61, 143}, {61, 144}, {61, 145}, {61, 146}, {61, 147}, {61, 148}, {61, 149}, {61, 150}, {61, 151},
+        {61, 152}, {61, 153}, {61, 154}, {61, 155}, {61, 156}, {61, 157}, {61, 158}, {61, 159}, {61, 160}, {61, 161},
+        {61, 162}, {61, 163}, {61, 164}, {61, 165}, {62, 128}, {62, 129}, {62, 130}, {62, 131}, {62, 132}, {62, 133},
+        {62, 134}, {62, 135}, {62, 136}, {62, 137}, {62, 138}, {62, 139}, {62, 140}, {62, 141}, {62, 142}, {62, 143},
+        {62, 144}, {62, 145}, {62, 146}, {62, 147}, {62, 148}, {62, 149}, {62, 150}, {62, 151}, {62, 152}, {62, 153},
+        {62, 154}, {62, 155}, {62, 156}, {62, 157}, {62, 158}, {62, 159}, {62, 160}, {62, 161}, {62, 162}, {62, 163},
+        {62, 164}, {62, 165}, {62, 166}, {62, 167}, {62, 168}, {63, 130}, {63, 131}, {63, 132}, {63, 133}, {63, 134},
+        {63, 135}, {63, 136}, {63, 137}, {63, 138}, {63, 139}, {63, 140}, {63, 141}, {63, 142}, {63, 143}, {63, 144},
+        {63, 145}, {63, 146}, {63, 147}, {63, 148}, {63, 149}, {63, 150}, {63, 151}, {63, 152}, {63, 153}, {63, 154},
+        {63, 155}, {63, 156}, {63, 157}, {63, 158}, {63, 159}, {63, 160}, {63, 161}, {63, 162}, {63, 163}, {63, 164},
+        {63, 165}, {63, 166}, {63, 167}, {63, 168}, {63, 169}, {63, 170}, {64, 133}, {64, 134}, {64, 135}, {64, 136},
+        {64, 137}, {64, 138}, {64, 139}, {64, 140}, {64, 141}, {64, 142}, {64, 143}, {64, 144}, {64, 145}, {64, 146},
+        {64, 147}, {64, 148}, {64, 149}, {64, 150}, {64, 151}, {64, 152}, {64, 153}, {64, 154}, {64, 155}, {64, 156},
+        {64, 157}, {64, 158}, {64, 159}, {64, 160}, {64, 161}, {64, 162}, {64, 163}, {64, 164}, {64, 165}, {64, 166},
+        {64, 167}, {64, 168}, {64, 169}, {64, 170}, {64, 171}, {64, 172}, {65, 135}, {65, 136}, {65, 137}, {65, 138},
+        {65, 139}, {65, 140}, {65, 141}, {65, 142}, {65, 143}, {65, 144}, {65, 145}, {65, 146}, {65, 147}, {65, 148},
+        {65, 149}, {65, 150}, {65, 151}, {65, 152}, {65, 153}, {65, 154}, {65, 155}, {65, 156}, {65, 157}, {65, 158},
+        {65, 159}, {65, 160}, {65, 161}, {65, 162}, {65, 163}, {65, 164}, {65, 165}, {65, 166}, {65, 167}, {65, 168},
+        {65, 169}, {65, 170}, {65, 171}, {65, 172}, {65, 173}, {65, 174}, {66, 138}, {66, 139}, {66, 140}, {66, 141},
+        {66, 142}, {66, 143}, {66, 144}, {66, 145}, {66, 146}, {66, 147}, {66, 148}, {66, 149}, {66, 150}, {66, 151},
+        {66, 152}, {66, 153}, {66, 154}, {66, 155}, {66, 156}, {66, 157}, {66, 158}, {66, 159}, {66, 160}, {66, 161},
+        {66, 162}, {66, 163}, {66, 164}, {66, 165}, {66, 166}, {66, 167}, {66, 168}, {66, 169}, {66, 170}, {66, 171},
+        {66, 172}, {66, 173}, {66, 174}, {66, 175}, {66, 176}, {67, 140}, {67, 141}, {67, 142}, {67, 143}, {67, 144},
+        {67, 145}, {67, 146}, {67, 147}, {67, 148}, {67, 149}, {67, 150}, {67, 151}, {67, 152}, {67, 153}, {67, 154},
+        {67, 155}, {67, 156}, {67, 157}, {67, 158}, {67, 159}, {67, 160}, {67, 161}, {67, 162}, {67, 163}, {67, 164},
+        {67, 165}, {67, 166}, {67, 167}, {67, 168}, {67, 169}, {67, 170}, {67, 171}, {67, 172}, {67, 173}, {67, 174},
+        {67, 175}, {67, 176}, {67, 177}, {67, 178}, {68, 142}, {68, 143}, {68, 144}, {68, 145}, {68, 146}, {68, 147},
+        {68, 148}, {68, 149}, {68, 150}, {68, 151}, {68, 152}, {68, 153}, {68, 154}, {68, 155}, {68, 156}, {68, 157},
+        {68, 158}, {68, 159}, {68, 160}, {68, 161}, {68, 162}, {68, 163}, {68, 164}, {68, 165}, {68, 166}, {68, 167},
+        {68, 168}, {68, 169}, {68, 170}, {68, 171}, {68, 172}, {68, 173}, {68, 174}, {68, 175}, {68, 176}, {68, 177},
+        {68, 178}, {68, 179}, {68, 180}, {69, 144}, {69, 145}, {69, 146}, {69, 147}, {69, 148}, {69, 149}, {69, 150},
+        {69, 151}, {69, 152}, {69, 153}, {69, 154}, {69, 155}, {69, 156}, {69, 157}, {69, 158}, {69, 159}, {69, 160},
+        {69, 161}, {69, 162}, {69, 163}, {69, 164}, {69, 165}, {69, 166}, {69, 167}, {69, 168}, {69, 169}, {69, 170},
+        {69, 171}, {69, 172}, {69, 173}, {69, 174}, {69, 175}, {69, 176}, {69, 177}, {69, 178}, {69, 179}, {69, 180},
+        {69, 181}, {69, 182}, {70, 148}, {70, 149}, {70, 150}, {70, 151}, {70, 152}, {70, 153}, {70, 154}, {70, 155},
+        {70, 156}, {70, 157}, {70, 158}, {70, 159}, {70, 160}, {70, 161}, {70, 162}, {70, 163}, {70, 164}, {70, 165},
+        {70, 166}, {70, 167}, {70, 168}, {70, 169}, {70, 170}, {70, 171}, {70, 172}, {70, 173}, {70, 174}, {70, 175},
+        {70, 176}, {70, 177}, {70, 178}, {70, 179}, {70, 180}, {70, 181}, {70, 182}, {70, 183}, {70, 184}, {70, 185},
+        {71, 150}, {71, 151}, {71, 152}, {71, 153}, {71, 154}, {71, 155}, {71, 156}, {71, 157}, {71, 158}, {71, 159},
+        {71, 160}, {71, 161}, {71, 162}, {71, 163}, {71, 164}, {71, 165}, {71, 166}, {71, 167}, {71, 168}, {71, 169},
+        {71, 170}, {71, 171}, {71, 172}, {71, 173}, {71, 174}, {71, 175}, {71, 176}, {71, 177}, {71, 178}, {71, 179},
+        {71, 180}, {71, 181}, {71, 182}, {71, 183}, {71, 184}, {71, 185}, {71, 186}, {71, 187}, {71, 188}, {72, 153},
+        {72, 154}, {72, 155}, {72, 156}, {72, 157}, {72, 158}, {72, 159}, {72, 160}, {72, 161}, {72, 162}, {72, 163},
+        {72, 164}, {72, 165}, {72, 166}, {72, 167}, {72, 168}, {72, 169}, {72, 170}, {72, 171}, {72, 172}, {72, 173},
+        {72, 174}, {72, 175}, {72, 176}, {72, 177}, {72, 178}, {72, 179}, {72, 180}, {72, 181}, {72, 182}, {72, 183},
+        {72, 184}, {72, 185}, {72, 186}, {72, 187}, {72, 188}, {72, 189}, {72, 190}, {73, 155}, {73, 156}, {73, 157},
+        {73, 158}, {73, 159}, {73, 160}, {73, 161}, {73, 162}, {73, 163}, {73, 164}, {73, 165}, {73, 166}, {73, 167},
+        {73, 168}, {73, 169}, {73, 170}, {73, 171}, {73, 172}, {73, 173}, {73, 174}, {73, 175}, {73, 176}, {73, 177},
+        {73, 178}, {73, 179}, {73, 180}, {73, 181}, {73, 182}, {73, 183}, {73, 184}, {73, 185}, {73, 186}, {73, 187},
+        {73, 188}, {73, 189}, {73, 190}, {73, 191}, {73, 192}, {73, 193}, {73, 194}, {74, 157}, {74, 158}, {74, 159},
+        {74, 160}, {74, 161}, {74, 162}, {74, 163}, {74, 164}, {74, 165}, {74, 166}, {74, 167}, {74, 168}, {74, 169},
+        {74, 170}, {74, 171}, {74, 172}, {74, 173}, {74, 174}, {74, 175}, {74, 176}, {74, 177}, {74, 178}, {74, 179},
+        {74, 180}, {74, 181}, {74, 182}, {74, 183}, {74, 184}, {74, 185}, {74, 186}, {74, 187}, {74, 188}, {74, 189},
+        {74, 190}, {74, 191}, {74, 192}, {74, 193}, {74, 194}, {74, 195}, {74, 196}, {74, 197}, {75, 159}, {75, 160},
+        {75, 161}, {75, 162}, {75, 163}, {75, 164}, {75, 165}, {75, 166}, {75, 167}, {75, 168}, {75, 169}, {75, 170},
+        {75, 171}, {75, 172}, {75, 173}, {75, 174}, {75, 175}, {75, 176}, {75, 177}, {75, 178}, {75, 179}, {75, 180},
+        {75, 181}, {75, 182}, {75, 183}, {75, 184}, {75, 185}, {75, 186}, {75, 187}, {75, 188}, {75, 189}, {75, 190},
+        {75, 191}, {75, 192}, {75, 193}, {75, 194}, {75, 195}, {75, 196}, {75, 197}, {75, 198}, {75, 199}, {76, 161},
+        {76, 162}, {76, 163}, {76, 164}, {76, 165}, {76, 166}, {76, 167}, {76, 168}, {76, 169}, {76, 170}, {76, 171},
+        {76, 172}, {76, 173}, {76, 174}, {76, 175}, {76, 176}, {76, 177}, {76, 178}, {76, 179}, {76, 180}, {76, 181},
+        {76, 182}, {76, 183}, {76, 184}, {76, 185}, {76, 186}, {76, 187}, {76, 188}, {76, 189}, {76, 190}, {76, 191},
+        {76, 192}, {76, 193}, {76, 194}, {76, 195}, {76, 196}, {76, 197}, {76, 198}, {76, 199}, {76, 200}, {76, 201},
+        {76, 202}, {76, 203}, {77, 163}, {77, 164}, {77, 165}, {77, 166}, {77, 167}, {77, 168}, {77, 169}, {77, 170},
+        {77, 171}, {77, 172}, {77, 173}, {77, 174}, {77, 175}, {77, 176}, {77, 177}, {77, 178}, {77, 179}, {77, 180},
+        {77, 181}, {77, 182}, {77, 183}, {77, 184}, {77, 185}, {77, 186}, {77, 187}, {77, 188}, {77, 189}, {77, 190},
+        {77, 191}, {77, 192}, {77, 193}, {77, 194}, {77, 195}, {77, 196}, {77, 197}, {77, 198}, {77, 199}, {77, 200},
+        {77, 201}, {77, 202}, {77, 203}, {77, 204}, {77, 205}, {78, 165}, {78, 166}, {78, 167}, {78, 168}, {78, 169},
+        {78, 170}, {78, 171}, {78, 172}, {78, 173}, {78, 174}, {78, 175}, {78, 176}, {78, 177}, {78, 178}, {78, 179},
+        {78, 180}, {78, 181}, {78, 182}, {78, 183}, {78, 184}, {78, 185}, {78, 186}, {78, 187}, {78, 188}, {78, 189},
+        {78, 190}, {78, 191}, {78, 192}, {78, 193}, {78, 194}, {78, 195}, {78, 196}, {78, 197}, {78, 198}, {78, 199},
+        {78, 200}, {78, 201}, {78, 202}, {78, 203}, {78, 204}, {78, 205}, {78, 206}, {78, 207}, {78, 208}, {79, 168},
+        {79, 169}, {79, 170}, {79, 171}, {79, 172}, {79, 173}, {79, 174}, {79, 175}, {79, 176}, {79, 177}, {79, 178},
+        {79, 179}, {79, 180}, {79, 181}, {79, 182}, {79, 183}, {79, 184}, {79, 185}, {79, 186}, {79, 187}, {79, 188},
+        {79, 189}, {79, 190}, {79, 191}, {79, 192}, {79, 193}, {79, 194}, {79, 195}, {79, 196}, {79, 197}, {79, 198},
+        {79, 199}, {79, 200}, {79, 201}, {79, 202}, {79, 203}, {79, 204}, {79, 205}, {79, 206}, {79, 207}, {79, 208},
+        {79, 209}, {79, 210}, {80, 170}, {80, 171}, {80, 172}, {80, 173}, {80, 174}, {80, 175}, {80, 176}, {80, 177},
+        {80, 178}, {80, 179}, {80, 180}, {80, 181}, {80, 182}, {80, 183}, {80, 184}, {80, 185}, {80, 186}, {80, 187},
+        {80, 188}, {80, 189}, {80, 190}, {80, 191}, {80, 192}, {80, 193}, {80, 194}, {80, 195}, {80, 196}, {80, 197},
+        {80, 198}, {80, 199}, {80, 200}, {80, 201}, {80, 202}, {80, 203}, {80, 204}, {80, 205}, {80, 206}, {80, 207},
+        {80, 208}, {80, 209}, {80, 210}, {80, 211}, {80, 212}, {80, 213}, {80, 214}, {80, 215}, {80, 216}, {81, 176},
+        {81, 177}, {81, 178}, {81, 179}, {81, 180}, {81, 181}, {81, 182}, {81, 183}, {81, 184}, {81, 185}, {81, 186},
+        {81, 187}, {81, 188}, {81, 189}, {81, 190}, {81, 191}, {81, 192}, {81, 193}, {81, 194}, {81, 195}, {81, 196},
+        {81, 197}, {81, 198}, {81, 199}, {81, 200}, {81, 201}, {81, 202}, {81, 203}, {81, 204}, {81, 205}, {81, 206},
+        {81, 207}, {81, 208}, {81, 209}, {81, 210}, {81, 211}, {81, 212}, {81, 213}, {81, 214}, {81, 215}, {81, 216},
+        {81, 217}, {81, 218}, {82, 178}, {82, 179}, {82, 180}, {82, 181}, {82, 182}, {82, 183}, {82, 184}, {82, 185},
+        {82, 186}, {82, 187}, {82, 188}, {82, 189}, {82, 190}, {82, 191}, {82, 192}, {82, 193}, {82, 194}, {82, 195},
+        {82, 196}, {82, 197}, {82, 198}, {82, 199}, {82, 200}, {82, 201}, {82, 202}, {82, 203}, {82, 204}, {82, 205},
+        {82, 206}, {82, 207}, {82, 208}, {82, 209}, {82, 210}, {82, 211}, {82, 212}, {82, 213}, {82, 214}, {82, 215},
+        {82, 216}, {82, 217}, {82, 218}, {82, 219}, {82, 220}, {83, 184}, {83, 185}, {83, 186}, {83, 187}, {83, 188},
+        {83, 189}, {83, 190}, {83, 191}, {83, 192}, {83, 193}, {83, 194}, {83, 195}, {83, 196}, {83, 197}, {83, 198},
+        {83, 199}, {83, 200}, {83, 201}, {83, 202}, {83, 203}, {83, 204}, {83, 205}, {83, 206}, {83, 207}, {83, 208},
+        {83, 209}, {83, 210}, {83, 211}, {83, 212}, {83, 213}, {83, 214}, {83, 215}, {83, 216}, {83, 217}, {83, 218},
+        {83, 219}, {83, 220}, {83, 221}, {83, 222}, {83, 223}, {83, 224}, {84, 186}, {84, 187}, {84, 188}, {84, 189},
+        {84, 190}, {84, 191}, {84, 192}, {84, 193}, {84, 194}, {84, 195}, {84, 196}, {84, 197}, {84, 198}, {84, 199},
+        {84, 200}, {84, 201}, {84, 202}, {84, 203}, {84, 204}, {84, 205}, {84, 206}, {84, 207}, {84, 208}, {84, 209},
+        {84, 210}, {84, 211}, {84, 212}, {84, 213}, {84, 214}, {84, 215}, {84, 216}, {84, 217}, {84, 218}, {84, 219},
+        {84, 220}, {84, 221}, {84, 222}, {84, 223}, {84, 224}, {84, 225}, {84, 226}, {84, 227}, {85, 191}, {85, 192},
+        {85, 193}, {85, 194}, {85, 195}, {85, 196}, {85, 197}, {85, 198}, {85, 199}, {85, 200}, {85, 201}, {85, 202},
+        {85, 203}, {85, 204}, {85, 205}, {85, 206}, {85, 207}, {85, 208}, {85, 209}, {85, 210}, {85, 211}, {85, 212},
+        {85, 213}, {85, 214}, {85, 215}, {85, 216}, {85, 217}, {85, 218}, {85, 219}, {85, 220}, {85, 221}, {85, 222},
+        {85, 223}, {85, 224}, {85, 225}, {85, 226}, {85, 227}, {85, 228}, {85, 229}, {86, 193}, {86, 194}, {86, 195},
+        {86, 196}, {86, 197}, {86, 198}, {86, 199}, {86, 200}, {86, 201}, {86, 202}, {86, 203}, {86, 204}, {86, 205},
+        {86, 206}, {86, 207}, {86, 208}, {86, 209}, {86, 210}, {86, 211}, {86, 212}, {86, 213}, {86, 214}, {86, 215},
+        {86, 216}, {86, 217}, {86, 218}, {86, 219}, {86, 220}, {86, 221}, {86, 222}, {86, 223}, {86, 224}, {86, 225},
+        {86, 226}, {86, 227}, {86, 228}, {86, 229}, {86, 230}, {86, 231}, {87, 197}, {87, 198}, {87, 199}, {87, 200},
+        {87, 201}, {87, 202}, {87, 203}, {87, 204}, {87, 205}, {87, 206}, {87, 207}, {87, 208}, {87, 209}, {87, 210},
+        {87, 211}, {87, 212}, {87, 213}, {87, 214}, {87, 215}, {87, 216}, {87, 217}, {87, 218}, {87, 219}, {87, 220},
+        {87, 221}, {87, 222}, {87, 223}, {87, 224}, {87, 225}, {87, 226}, {87, 227}, {87, 228}, {87, 229}, {87, 230},
+        {87, 231}, {87, 232}, {87, 233}, {88, 201}, {88, 202}, {88, 203}, {88, 204}, {88, 205}, {88, 206}, {88, 207},
+        {88, 208}, {88, 209}, {88, 210}, {88, 211}, {88, 212}, {88, 213}, {88, 214}, {88, 215}, {88, 216}, {88, 217},
+        {88, 218}, {88, 219}, {88, 220}, {88, 221}, {88, 222}, {88, 223}, {88, 224}, {88, 225}, {88, 226}, {88, 227},
+        {88, 228}, {88, 229}, {88, 230}, {88, 231}, {88, 232}, {88, 233}, {88, 234}, {88, 235}, {89, 205}, {89, 206},
+        {89, 207}, {89, 208}, {89, 209}, {89, 210}, {89, 211}, {89, 212}, {89, 213}, {89, 214}, {89, 215}, {89, 216},
+        {89, 217}, {89, 218}, {89, 219}, {89, 220}, {89, 221}, {89, 222}, {89, 223}, {89, 224}, {89, 225}, {89, 226},
+        {89, 227}, {89, 228}, {89, 229}, {89, 230}, {89, 231}, {89, 232}, {89, 233}, {89, 234}, {89, 235}, {89, 236},
+        {89, 237}, {90, 208}, {90, 209}, {90, 210}, {90, 211}, {90, 212}, {90, 213}, {90, 214}, {90, 215}, {90, 216},
+        {90, 217}, {90, 218}, {90, 219}, {90, 220}, {90, 221}, {90, 222}, {90, 223}, {90, 224}, {90, 225}, {90, 226},
+        {90, 227}, {90, 228}, {90, 229}, {90, 230}, {90, 231}, {90, 232}, {90, 233}, {90, 234}, {90, 235}, {90, 236},
+        {90, 237}, {90, 238}, {90, 239}, {91, 211}, {91, 212}, {91, 213}, {91, 214}, {91, 215}, {91, 216}, {91, 217},
+        {91, 218}, {91, 219}, {91, 220}, {91, 221}, {91, 222}, {91, 223}, {91, 224}, {91, 225}, {91, 226}, {91, 227},
+        {91, 228}, {91, 229}, {91, 230}, {91, 231}, {91, 232}, {91, 233}, {91, 234}, {91, 235}, {91, 236}, {91, 237},
+        {91, 238}, {91, 239}, {91, 240}, {91, 241}, {92, 215}, {92, 216}, {92, 217}, {92, 218}, {92, 219}, {92, 220},
+        {92, 221}, {92, 222}, {92, 223}, {92, 224}, {92, 225}, {92, 226}, {92, 227}, {92, 228}, {92, 229}, {92, 230},
+        {92, 231}, {92, 232}, {92, 233}, {92, 234}, {92, 235}, {92, 236}, {92, 237}, {92, 238}, {92, 239}, {92, 240},
+        {92, 241}, {92, 242}, {92, 243}, {93, 219}, {93, 220}, {93, 221}, {93, 222}, {93, 223}, {93, 224}, {93, 225},
+        {93, 226}, {93, 227}, {93, 228}, {93, 229}, {93, 230}, {93, 231}, {93, 232}, {93, 233}, {93, 234}, {93, 235},
+        {93, 236}, {93, 237}, {93, 238}, {93, 239}, {93, 240}, {93, 241}, {93, 242}, {93, 243}, {93, 244}, {93, 245},
+        {94, 221}, {94, 222}, {94, 223}, {94, 224}, {94, 225}, {94, 226}, {94, 227}, {94, 228}, {94, 229}, {94, 230},
+        {94, 231}, {94, 232}, {94, 233}, {94, 234}, {94, 235}, {94, 236}, {94, 237}, {94, 238}, {94, 239}, {94, 240},
+        {94, 241}, {94, 242}, {94, 243}, {94, 244}, {94, 245}, {94, 246}, {94, 247}, {95, 223}, {95, 224}, {95, 225},
+        {95, 226}, {95, 227}, {95, 228}, {95, 229}, {95, 230}, {95, 231}, {95, 232}, {95, 233}, {95, 234}, {95, 235},
+        {95, 236}, {95, 237}, {95, 238}, {95, 239}, {95, 240}, {95, 241}, {95, 242}, {95, 243}, {95, 244}, {95, 245},
+        {95, 246}, {95, 247}, {95, 248}, {95, 249}, {96, 231}, {96, 232}, {96, 233}, {96, 234}, {96, 235}, {96, 236},
+        {96, 237}, {96, 238}, {96, 239}, {96, 240}, {96, 241}, {96, 242}, {96, 243}, {96, 244}, {96, 245}, {96, 246},
+        {96, 247}, {96, 248}, {96, 249}, {96, 250}, {96, 251}, {96, 252}, {97, 233}, {97, 234}, {97, 235}, {97, 236},
+        {97, 237}, {97, 238}, {97, 239}, {97, 240}, {97, 241}, {97, 242}, {97, 243}, {97, 244}, {97, 245}, {97, 246},
+        {97, 247}, {97, 248}, {97, 249}, {97, 250}, {97, 251}, {97, 252}, {97, 253}, {97, 254}, {98, 237}, {98, 238},
+        {98, 239}, {98, 240}, {98, 241}, {98, 242}, {98, 243}, {98, 244}, {98, 245}, {98, 246}, {98, 247}, {98, 248},
+        {98, 249}, {98, 250}, {98, 251}, {98, 252}, {98, 253}, {98, 254}, {98, 255}, {98, 256}, {99, 239}, {99, 240},
+        {99, 241}, {99, 242}, {99, 243}, {99, 244}, {99, 245}, {99, 246}, {99, 247}, {99, 248}, {99, 249}, {99, 250},
+        {99, 251}, {99, 252}, {99, 253}, {99, 254}, {99, 255}, {99, 256}, {99, 257}, {99, 258}, {100, 241}, {100, 242},
+        {100, 243}, {100, 244}, {100, 245}, {100, 246}, {100, 247}, {100, 248}, {100, 249}, {100, 250}, {100, 251}, {100, 252},
+        {100, 253}, {100, 254}, {100, 255}, {100, 256}, {100, 257}, {100, 258}, {100, 259}, {100, 260}, {101, 244}, {101, 245},
+        {101, 246}, {101, 247}, {101, 248}, {101, 249}, {101, 250}, {101, 251}, {101, 252}, {101, 253}, {101, 254}, {101, 255},
+        {101, 256}, {101, 257}, {101, 258}, {101, 259}, {101, 260}, {101, 261}, {101, 262}, {102, 248}, {102, 249}, {102, 250},
+        {102, 251}, {102, 252}, {102, 253}, {102, 254}, {102, 255}, {102, 256}, {102, 257}, {102, 258}, {102, 259}, {102, 260},
+        {102, 261}, {102, 262}, {102, 263}, {102, 264}, {103, 251}, {103, 252}, {103, 253}, {103, 254}, {103, 255}, {103, 256},
+        {103, 257}, {103, 258}, {103, 259}, {103, 260}, {103, 261}, {103, 262}, {103, 263}, {103, 264}, {103, 265}, {103, 266},
+        {104, 253}, {104, 254}, {104, 255}, {104, 256}, {104, 257}, {104, 258}, {104, 259}, {104, 260}, {104, 261}, {104, 262},
+        {104, 263}, {104, 264}, {104, 265}, {104, 266}, {104, 267}, {104, 268}, {105, 255}, {105, 256}, {105, 257}, {105, 258},
+        {105, 259}, {105, 260}, {105, 261}, {105, 262}, {105, 263}, {105, 264}, {105, 265}, {105, 266}, {105, 267}, {105, 268},
+        {105, 269}, {105, 270}, {106, 258}, {106, 259}, {106, 260}, {106, 261}, {106, 262}, {106, 263}, {106, 264}, {106, 265},
+        {106, 266}, {106, 267}, {106, 268}, {106, 269}, {106, 270}, {106, 271}, {106, 272}, {106, 273}, {107, 260}, {107, 261},
+        {107, 262}, {107, 263}, {107, 264}, {107, 265}, {107, 266}, {107, 267}, {107, 268}, {107, 269}, {107, 270}, {107, 271},
+        {107, 272}, {107, 273}, {107, 274}, {107, 275}, {107, 276}, {107, 277}, {107, 278}, {108, 263}, {108, 264}, {108, 265},
+        {108, 266}, {108, 267}, {108, 268}, {108, 269}, {108, 270}, {108, 271}, {108, 272}, {108, 273}, {108, 274}, {108, 275},
+        {108, 276}, {108, 277}, {108, 278}, {108, 279}, {108, 280}, {109, 265}, {109, 266}, {109, 267}, {109, 268}, {109, 269},
+        {109, 270}, {109, 271}, {109, 272}, {109, 273}, {109, 274}, {109, 275}, {109, 276}, {109, 277}, {109, 278}, {109, 279},
+        {109, 280}, {109, 281}, {109, 282}, {110, 267}, {110, 268}, {110, 269}, {110, 270}, {110, 271}, {110, 272}, {110, 273},
+        {110, 274}, {110, 275}, {110, 276}, {110, 277}, {110, 278}, {110, 279}, {110, 280}, {110, 281}, {110, 282}, {110, 283},
+        {110, 284}, {111, 272}, {111, 273}, {111, 274}, {111, 275}, {111, 276}, {111, 277}, {111, 278}, {111, 279}, {111, 280},
+        {111, 281}, {111, 282}, {111, 283}, {111, 284}, {111, 285}, {111, 286}, {112, 276}, {112, 277}, {112, 278}, {112, 279},
+        {112, 280}, {112, 281}, {112, 282}, {112, 283}, {112, 284}, {112, 285}, {112, 286}, {112, 287}, {112, 288}, {113, 278},
+        {113, 279}, {113, 280}, {113, 281}, {113, 282}, {113, 283}, {113, 284}, {113, 285}, {113, 286}, {113, 287}, {113, 288},
+        {113, 289}, {113, 290}, {114, 284}, {114, 285}, {114, 286}, {114, 287}, {114, 288}, {114, 289}, {114, 290}, {114, 291},
+        {115, 287}, {115, 288}, {115, 289}, {115, 290}, {115, 291}, {115, 292}, {116, 289}, {116, 290}, {116, 291}, {116, 292},
+        {116, 293}, {117, 291}, {117, 292}, {117, 293}, {117, 294}, {118, 293}, {118, 294}, {118, 295},
+    }};
+} // namespace fourdst::atomic
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "fourdst/atomic/nuclide_symbol.h"
+#include "fourdst/atomic/species_index.h"
+#include "fourdst/atomic/species_table.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace fourdst::atomic {
+    /**
+     * @struct SpeciesRef
+     * @brief A species of the compiled-in table, resolved from its symbol at compile time.
+     *
+     * @details Created by the `_sp` literal. It holds the row of the species in
+     * SpeciesTable::builtin(), so converting it to a Species is an array access rather than a
+     * lookup by name. The ID is only meaningful for the builtin table; against a table set with
+     * SpeciesTable::install(), resolve it by `za` with SpeciesTable::find(int, int).
+     */
+    struct SpeciesRef {
+        SpeciesId id; ///< Row of the species in SpeciesTable::builtin().
+        NuclideZA za; ///< Charge and mass number of the species.
+
+        /**
+         * @brief Gets the species from the compiled-in table.
+         */
+        [[nodiscard]] const Species& species() const { return SpeciesTable::builtin()[id]; }
+
+        // NOLINTNEXTLINE(google-explicit-constructor) Lets literals stand in for species in the composition API
+        operator const Species&() const { return species(); }
+
+        constexpr bool operator==(const SpeciesRef&) const = default;
+    };
+
+    namespace detail {
+        // Deliberately not constexpr: a species literal reaching one of these fails to compile, naming the reason.
+        void species_literal_is_not_a_nuclide_symbol();
+        void species_literal_is_not_in_the_species_table();
+
+        consteval SpeciesRef resolve_species_literal(const std::string_view symbol) {
+            const std::optional<NuclideZA> za = parse_nuclide(symbol);
+            if (!za) {
+                species_literal_is_not_a_nuclide_symbol();
+            }
+            const auto it = std::ranges::lower_bound(
+                kBuiltinNuclides,
+                std::pair(za->z, za->a),
+                {},
+                [](const NuclideZA& nuclide) { return std::pair(nuclide.z, nuclide.a); }
+            );
+            if (it == kBuiltinNuclides.end() || *it != *za) {
+                species_literal_is_not_in_the_species_table();
+            }
+            return SpeciesRef{static_cast<SpeciesId>(it - kBuiltinNuclides.begin()), *za};
+        }
+    }
+
+    namespace literals {
+        /**
+         * @brief Resolves a species symbol at compile time.
+         *
+         * @details The symbol may be in any notation parse_nuclide() accepts ("He-4", "he4", "4He",
+         * "alpha"). A symbol which is malformed or names a nuclide absent from species.h is a
+         * compile error, so hot code pays neither a name lookup nor a runtime exception path.
+         *
+         * @par Examples
+         * @code{.cpp}
+         * using namespace fourdst::atomic::literals;
+         * constexpr auto he4 = "He-4"_sp;
+         * const double y = comp.getMolarAbundance("C-12"_sp);
+         * // "He-44"_sp does not compile
+         * @endcode
+         */
+        consteval SpeciesRef operator""_sp(const char* symbol, const std::size_t length) {
+            return detail::resolve_species_literal(std::string_view(symbol, length));
+        }
+    }
+}
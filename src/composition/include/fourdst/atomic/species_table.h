@@ -0,0 +1,429 @@
+#pragma once
+
+#include "fourdst/atomic/atomicSpecies.h"
+#include "fourdst/atomic/decay_modes.h"
+#include "fourdst/atomic/elements.h"
+#include "fourdst/atomic/nuclide_symbol.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fourdst::atomic {
+    /**
+     * @brief Row index of a species in a SpeciesTable.
+     */
+    using SpeciesId = std::uint32_t;
+
+    /**
+     * @brief SpeciesId marking the absence of a species, e.g. the daughter of a fission channel.
+     */
+    inline constexpr SpeciesId kNoSpecies = std::numeric_limits<SpeciesId>::max();
+
+    /**
+     * @brief Numeric columns of a SpeciesTable which predicates can filter on.
+     */
+    enum class SpeciesColumn : std::uint8_t {
+        Z,                 ///< Charge number.
+        N,                 ///< Neutron number.
+        A,                 ///< Mass number.
+        MASS,              ///< Atomic mass in u.
+        MASS_EXCESS,       ///< Atomic mass excess in MeV.
+        BINDING_ENERGY,    ///< Binding energy per nucleon in keV.
+        HALF_LIFE,         ///< Half-life in s; infinity for stable species.
+        BETA_DECAY_ENERGY, ///< Beta decay energy in keV; NaN where not calculable.
+        SPIN,              ///< Nuclear spin J; NaN where unknown.
+        TWO_J,             ///< Twice the nuclear spin; -1 where unknown.
+        PARITY             ///< Ground-state parity: -1, +1, or 0 where unknown.
+    };
+
+    /**
+     * @brief Magic number at the start of a species table cache file ("FDSC" read as little-endian).
+     */
+    inline constexpr std::uint32_t kSpeciesTableCacheMagic = 0x43534446U;
+
+    /**
+     * @brief Current version of the species table cache format.
+     */
+    inline constexpr std::uint16_t kSpeciesTableCacheVersion = 1;
+
+    /**
+     * @brief Energy equivalent of the atomic mass unit in MeV (CODATA 2018, as used by AME2020).
+     */
+    inline constexpr double kAtomicMassUnitMeV = 931.49410242;
+
+    /**
+     * @struct SpeciesPredicate
+     * @brief Selects the rows whose column value lies in the closed interval [min, max].
+     *
+     * @details NaN values never match, so e.g. a predicate on SPIN skips species of unknown spin.
+     */
+    struct SpeciesPredicate {
+        SpeciesColumn column; ///< Column to test.
+        double min = -std::numeric_limits<double>::infinity(); ///< Smallest accepted value.
+        double max = std::numeric_limits<double>::infinity(); ///< Largest accepted value.
+    };
+
+    /**
+     * @brief Predicate accepting `min <= column <= max`.
+     */
+    constexpr SpeciesPredicate between(const SpeciesColumn column, const double min, const double max) noexcept {
+        return {column, min, max};
+    }
+
+    /**
+     * @brief Predicate accepting `column >= min`.
+     */
+    constexpr SpeciesPredicate atLeast(const SpeciesColumn column, const double min) noexcept {
+        return {column, min, std::numeric_limits<double>::infinity()};
+    }
+
+    /**
+     * @brief Predicate accepting `column <= max`.
+     */
+    constexpr SpeciesPredicate atMost(const SpeciesColumn column, const double max) noexcept {
+        return {column, -std::numeric_limits<double>::infinity(), max};
+    }
+
+    /**
+     * @brief Predicate accepting `column == value`.
+     */
+    constexpr SpeciesPredicate equalTo(const SpeciesColumn column, const double value) noexcept {
+        return {column, value, value};
+    }
+
+    /**
+     * @brief Predicate accepting stable species (infinite half-life).
+     */
+    constexpr SpeciesPredicate isStable() noexcept {
+        return equalTo(SpeciesColumn::HALF_LIFE, std::numeric_limits<double>::infinity());
+    }
+
+    /**
+     * @struct SpeciesRecord
+     * @brief Compact row of a SpeciesTable, for walking isotope chains in contiguous memory.
+     */
+    struct SpeciesRecord {
+        SpeciesId id; ///< Row of the species in its table.
+        std::int32_t z; ///< Charge number.
+        std::int32_t n; ///< Neutron number.
+        std::int32_t a; ///< Mass number.
+        double mass; ///< Atomic mass in u.
+        double halfLife; ///< Half-life in s; infinity for stable species.
+    };
+    static_assert(sizeof(SpeciesRecord) == 32);
+
+    /**
+     * @struct DecayChannel
+     * @brief Decay channel of a SpeciesTable row, with its daughter resolved to a row of the same table.
+     */
+    struct DecayChannel {
+        double branchingRatio; ///< Fraction of all decays (0 to 1); NaN if not measured.
+        SpeciesId daughter; ///< Row of the daughter; kNoSpecies for fission or if the table lacks the daughter.
+        DecayMode mode; ///< Decay mode.
+    };
+    static_assert(sizeof(DecayChannel) == 16);
+
+    /**
+     * @class SpeciesTable
+     * @brief Structure-of-arrays view of a species database.
+     *
+     * @details Every species is a row, identified by its SpeciesId, and every numeric property is
+     * a contiguous column. Rows are ordered by charge number and then by mass number. Queries
+     * are conjunctions of SpeciesPredicate which are evaluated column by column over the whole
+     * table with branch free loops, so a query over the full database touches a few tens of
+     * kilobytes of contiguous memory instead of thousands of heap allocated Species objects.
+     *
+     * Query results are compact ID lists; species() turns them into the species lists taken by
+     * the Composition constructors and by MaskedComposition.
+     *
+     * Because of the (Z, A) order the isotopes of every element form one contiguous block of
+     * rows. The table indexes these blocks, so element() returns the isotope chain of an element
+     * in constant time.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * using namespace fourdst::atomic;
+     * const SpeciesTable& table = SpeciesTable::builtin();
+     *
+     * // Stable isotopes up to zinc
+     * const auto ids = table.select({atMost(SpeciesColumn::Z, 30), isStable()});
+     * fourdst::composition::Composition comp(table.species(ids));
+     *
+     * // Iron isotopes living longer than a year
+     * const auto longLived = table.select({equalTo(SpeciesColumn::Z, 26), atLeast(SpeciesColumn::HALF_LIFE, 3.15576e7)});
+     *
+     * // Every known isotope of iron, lightest first
+     * for (const SpeciesRecord& iso : table.element(26)) {
+     *     std::println("{} {}", table[iso.id].name(), iso.mass);
+     * }
+     * @endcode
+     *
+     * The decay-mode strings of all rows are decoded once, when the table is built, into a
+     * compressed sparse row table of DecayChannel, so decayChannels() gives the exclusive decay
+     * channels of a species and their daughter rows in constant time, without string handling.
+     *
+     * @par Runtime nuclear data
+     * Besides the compiled-in database, tables can be parsed at runtime from the AME mass table
+     * (`mass_1.mas20.txt`) and the NUBASE table (`nubase2020.asc`), so that a newer mass evaluation
+     * can be used without regenerating `species.h` and rebuilding. Parsing is a single pass over
+     * the memory mapped files; toCache() stores the parsed table in a compact binary form which
+     * loadCache() maps back in without any text parsing. Loading is opt-in: install() makes a
+     * table the one used by the symbol and (Z, A) lookups of `fourdst::composition::getSpecies`.
+     * The named constants (`fourdst::atomic::H_1`, ...) and `fourdst::atomic::species` always
+     * hold the compiled-in data.
+     *
+     * @code{.cpp}
+     * using fourdst::atomic::SpeciesTable;
+     * auto table = SpeciesTable::load("mass_1.mas20.txt", "nubase2020.asc");
+     * table.writeCache("species.fdsc");
+     * // Later runs
+     * SpeciesTable::install(std::make_shared<const SpeciesTable>(SpeciesTable::loadCache("species.fdsc")));
+     * @endcode
+     */
+    class SpeciesTable {
+    public:
+        /**
+         * @brief Builds a table over the given species.
+         * @param[in] species The species; they are reordered by (Z, A).
+         */
+        explicit SpeciesTable(std::vector<Species> species);
+
+        /**
+         * @brief Gets the table of the compiled-in species database (`fourdst::atomic::species`).
+         * @details Built on first use; thread safe.
+         */
+        [[nodiscard]] static const SpeciesTable& builtin();
+
+        /**
+         * @brief Parses AME and NUBASE tables into a species table.
+         *
+         * @details Every ground state of the AME mass table becomes a row. Half-lives, spin-parities
+         * and decay modes are taken from the NUBASE ground state of the same (Z, A); the half-life
+         * is stored in seconds, infinity for stable and 0 for particle unstable or unparsable
+         * entries, and NaN if NUBASE has no entry. Only the first table of a NUBASE file is read.
+         *
+         * @param[in] ame Contents of an AME2020 style mass table (`mass_1.mas20.txt`).
+         * @param[in] nubase Contents of a NUBASE2020 style table (`nubase2020.asc`).
+         * @return The table.
+         * @throws fourdst::composition::exceptions::CompositionIOError If a data line is malformed.
+         */
+        [[nodiscard]] static SpeciesTable fromNuclearData(std::span<const char> ame, std::span<const char> nubase);
+
+        /**
+         * @brief Maps and parses AME and NUBASE files; see fromNuclearData().
+         * @throws fourdst::composition::exceptions::CompositionIOError If a file cannot be mapped or is malformed.
+         */
+        [[nodiscard]] static SpeciesTable load(const std::filesystem::path& ame, const std::filesystem::path& nubase);
+
+        /**
+         * @brief Restores a table from its binary cache form.
+         * @param[in] cache Bytes produced by toCache().
+         * @throws fourdst::composition::exceptions::CompositionIOError If the cache is truncated or invalid.
+         */
+        [[nodiscard]] static SpeciesTable fromCache(std::span<const std::byte> cache);
+
+        /**
+         * @brief Maps a cache file written by writeCache() and restores its table.
+         * @throws fourdst::composition::exceptions::CompositionIOError If the file cannot be mapped or is invalid.
+         */
+        [[nodiscard]] static SpeciesTable loadCache(const std::filesystem::path& path);
+
+        /**
+         * @brief Serialises the table into its binary cache form.
+         *
+         * @details The cache holds the numeric columns as little-endian arrays followed by the
+         * element symbols, beta codes, spin-parities and decay modes as length prefixed strings.
+         */
+        [[nodiscard]] std::vector<std::byte> toCache() const;
+
+        /**
+         * @brief Writes toCache() to a file.
+         * @throws fourdst::composition::exceptions::CompositionIOError If the file cannot be written.
+         */
+        void writeCache(const std::filesystem::path& path) const;
+
+        /**
+         * @brief Makes `table` the species database used by `fourdst::composition::getSpecies`.
+         * @param[in] table The table, or nullptr to return to the compiled-in database.
+         * @details Thread safe; lookups already in progress finish on the table they started with.
+         */
+        static void install(std::shared_ptr<const SpeciesTable> table) noexcept;
+
+        /**
+         * @brief Gets the table set with install().
+         * @return The installed table, or nullptr if the compiled-in database is in use.
+         */
+        [[nodiscard]] static std::shared_ptr<const SpeciesTable> installed() noexcept;
+
+        /**
+         * @brief Gets the number of rows.
+         */
+        [[nodiscard]] std::size_t size() const noexcept { return m_species.size(); }
+
+        /**
+         * @brief Gets the species of a row.
+         * @throws std::out_of_range If `id` is not a row of the table.
+         */
+        [[nodiscard]] const Species& operator[](SpeciesId id) const;
+
+        /**
+         * @brief Gets all species, in row order.
+         */
+        [[nodiscard]] const std::vector<Species>& allSpecies() const noexcept { return m_species; }
+
+        [[nodiscard]] std::span<const std::int32_t> z() const noexcept { return m_z; } ///< Charge number column.
+        [[nodiscard]] std::span<const std::int32_t> n() const noexcept { return m_n; } ///< Neutron number column.
+        [[nodiscard]] std::span<const std::int32_t> a() const noexcept { return m_a; } ///< Mass number column.
+        [[nodiscard]] std::span<const double> mass() const noexcept { return m_mass; } ///< Atomic mass column (u).
+        [[nodiscard]] std::span<const double> massExcess() const noexcept { return m_massExcess; } ///< Mass excess column, (mass - A) u in MeV.
+        [[nodiscard]] std::span<const double> massExcessUnc() const noexcept { return m_massExcessUnc; } ///< Mass excess uncertainty column (MeV).
+        [[nodiscard]] std::span<const double> bindingEnergy() const noexcept { return m_bindingEnergy; } ///< Binding energy column (keV).
+        [[nodiscard]] std::span<const double> halfLife() const noexcept { return m_halfLife; } ///< Half-life column (s).
+        [[nodiscard]] std::span<const double> betaDecayEnergy() const noexcept { return m_betaDecayEnergy; } ///< Beta decay energy column (keV).
+        [[nodiscard]] std::span<const double> spin() const noexcept { return m_spin; } ///< Spin column.
+        [[nodiscard]] std::span<const std::int32_t> twoJ() const noexcept { return m_twoJ; } ///< Twice the spin column (-1 if unknown).
+        [[nodiscard]] std::span<const std::int32_t> parity() const noexcept { return m_parity; } ///< Parity column (-1, 0 or +1).
+
+        /**
+         * @brief Gets the compact records of all rows, in row order.
+         */
+        [[nodiscard]] std::span<const SpeciesRecord> records() const noexcept { return m_records; }
+
+        /**
+         * @brief Gets the decay channels of a species.
+         * @param[in] id Row of the species.
+         * @return The channels; empty if the decay-mode string of the species lists no decay.
+         * @throws std::out_of_range If `id` is not a row of the table.
+         *
+         * @par Examples
+         * @code{.cpp}
+         * // Follow the dominant channel from 238U down to a stable species
+         * const SpeciesTable& table = SpeciesTable::installed() ? *SpeciesTable::installed() : SpeciesTable::builtin();
+         * SpeciesId id = *table.find(92, 238);
+         * while (!table.decayChannels(id).empty()) {
+         *     id = std::ranges::max(table.decayChannels(id), {}, &DecayChannel::branchingRatio).daughter;
+         * }
+         * @endcode
+         */
+        [[nodiscard]] std::span<const DecayChannel> decayChannels(SpeciesId id) const;
+
+        /**
+         * @brief Gets the decay channels of all rows; those of row i are [decayOffsets()[i], decayOffsets()[i + 1]).
+         */
+        [[nodiscard]] std::span<const DecayChannel> decayChannels() const noexcept { return m_decayChannels; }
+
+        /**
+         * @brief Gets the row offsets into decayChannels(); size() + 1 entries.
+         */
+        [[nodiscard]] std::span<const std::uint32_t> decayOffsets() const noexcept { return m_decayOffsets; }
+
+        /**
+         * @brief Gets the isotope chain of an element.
+         * @param[in] z Charge number.
+         * @return The records of every isotope of the element in ascending A; empty if the table has none.
+         */
+        [[nodiscard]] std::span<const SpeciesRecord> element(int z) const noexcept;
+
+        /**
+         * @brief Gets the smallest mass number known for an element.
+         * @return The mass number, or std::nullopt if the table has no isotope of the element.
+         */
+        [[nodiscard]] std::optional<int> lightestA(int z) const noexcept;
+
+        /**
+         * @brief Gets the largest mass number known for an element.
+         * @return The mass number, or std::nullopt if the table has no isotope of the element.
+         */
+        [[nodiscard]] std::optional<int> heaviestA(int z) const noexcept;
+
+        /**
+         * @brief Finds the row of a species by charge and mass number.
+         * @return The row, or std::nullopt if the table has no such species.
+         */
+        [[nodiscard]] std::optional<SpeciesId> find(int z, int a) const noexcept;
+
+        /**
+         * @brief Finds the row of a species by name (e.g. "Fe-56").
+         * @return The row, or std::nullopt if the table has no such species.
+         */
+        [[nodiscard]] std::optional<SpeciesId> find(std::string_view name) const noexcept;
+
+        /**
+         * @brief Finds the row of a species from a symbol in any notation accepted by parse_nuclide().
+         * @details Decodes the symbol into (Z, A) and looks that up, so "Fe-56", "fe56", "56Fe" and
+         * "alpha" resolve without allocating or building a normalised name.
+         * @return The row, or std::nullopt if the symbol is malformed or the table has no such species.
+         */
+        [[nodiscard]] std::optional<SpeciesId> findNuclide(std::string_view symbol) const noexcept {
+            const auto za = parse_nuclide(symbol);
+            return za ? find(za->z, za->a) : std::nullopt;
+        }
+
+        /**
+         * @brief Selects the rows matching every predicate.
+         * @param[in] predicates Conjunction of predicates; an empty list selects every row.
+         * @return Matching rows in ascending order.
+         */
+        [[nodiscard]] std::vector<SpeciesId> select(std::span<const SpeciesPredicate> predicates) const;
+
+        /**
+         * @brief Selects the rows matching every predicate.
+         */
+        [[nodiscard]] std::vector<SpeciesId> select(std::initializer_list<SpeciesPredicate> predicates) const {
+            return select(std::span(predicates.begin(), predicates.size()));
+        }
+
+        /**
+         * @brief Counts the rows matching every predicate.
+         */
+        [[nodiscard]] std::size_t count(std::span<const SpeciesPredicate> predicates) const;
+
+        /**
+         * @brief Counts the rows matching every predicate.
+         */
+        [[nodiscard]] std::size_t count(std::initializer_list<SpeciesPredicate> predicates) const {
+            return count(std::span(predicates.begin(), predicates.size()));
+        }
+
+        /**
+         * @brief Copies the species of the given rows, e.g. to construct a Composition or a MaskedComposition.
+         * @param[in] ids Rows of the table.
+         * @return The species, in the order of `ids`.
+         * @throws std::out_of_range If an id is not a row of the table.
+         */
+        [[nodiscard]] std::vector<Species> species(std::span<const SpeciesId> ids) const;
+
+    private:
+        std::vector<Species> m_species; ///< Rows, ordered by (Z, A).
+        std::vector<std::int32_t> m_z;
+        std::vector<std::int32_t> m_n;
+        std::vector<std::int32_t> m_a;
+        std::vector<double> m_mass;
+        std::vector<double> m_massExcess;
+        std::vector<double> m_massExcessUnc;
+        std::vector<double> m_bindingEnergy;
+        std::vector<double> m_halfLife;
+        std::vector<double> m_betaDecayEnergy;
+        std::vector<double> m_spin;
+        std::vector<std::int32_t> m_twoJ;
+        std::vector<std::int32_t> m_parity;
+        std::vector<SpeciesRecord> m_records;
+        std::vector<std::uint32_t> m_elementOffsets; ///< Rows of element Z are [m_elementOffsets[Z], m_elementOffsets[Z + 1]).
+        std::vector<DecayChannel> m_decayChannels;
+        std::vector<std::uint32_t> m_decayOffsets; ///< Channels of row i are [m_decayOffsets[i], m_decayOffsets[i + 1]).
+        std::unordered_map<std::string, SpeciesId, TransparentStringHash, std::equal_to<>> m_nameIndex;
+
+        void evaluate(std::span<const SpeciesPredicate> predicates, std::vector<std::uint8_t>& mask) const;
+    };
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+/**
+ * @file composition_c.h
+ * @brief C ABI of libcomposition for C and Fortran callers.
+ *
+ * @details A handle describes a species schema, fixed when the handle is created from Z/A
+ * arrays in the caller's own order. Abundance arrays are never copied: they are either bound
+ * to the handle once (fdst_composition_bind) or passed per call, and always follow the order
+ * used at creation. All results are written into caller-owned buffers, so no successful call
+ * allocates after creation.
+ *
+ * Two calls pass strings. fdst_composition_species_name copies a species name into a
+ * caller-owned buffer. fdst_composition_last_error returns a pointer to a message owned by the
+ * library. That pointer must not be freed, and it is only valid on the calling thread until the
+ * next failing call on that thread.
+ *
+ * Every function returning `int` returns an fdst_composition_status. On failure a description
+ * of the error is available from fdst_composition_last_error() on the same thread. No function
+ * lets a C++ exception escape.
+ *
+ * The Fortran module `fourdst_composition` (fortran/fourdst_composition.f90) binds this API
+ * with `ISO_C_BINDING`.
+ *
+ * @par Examples
+ * @code{.c}
+ * const int32_t z[] = {1, 2, 6};
+ * const int32_t a[] = {1, 4, 12};
+ * double y[] = {0.7, 0.07, 1e-3};
+ * fdst_composition* comp = NULL;
+ * if (fdst_composition_create(z, a, 3, &comp) != FDST_COMPOSITION_OK) {
+ *     fprintf(stderr, "%s\n", fdst_composition_last_error());
+ * }
+ * fdst_composition_bind(comp, y);
+ * fdst_composition_moments moments;
+ * fdst_composition_get_moments(comp, &moments);
+ * fdst_composition_destroy(comp);
+ * @endcode
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque species schema plus an optional bound abundance array.
+ */
+typedef struct fdst_composition fdst_composition;
+
+/**
+ * @brief Status codes returned by the C API.
+ */
+typedef enum fdst_composition_status {
+    FDST_COMPOSITION_OK = 0, /**< Success. */
+    FDST_COMPOSITION_INVALID_ARGUMENT = 1, /**< A required pointer was NULL or a size was invalid. */
+    FDST_COMPOSITION_UNKNOWN_SPECIES = 2, /**< A (Z, A) pair is not in the species database. */
+    FDST_COMPOSITION_NOT_BOUND = 3, /**< The call needs a bound abundance array and none is bound. */
+    FDST_COMPOSITION_ERROR = 4 /**< Any other error. */
+} fdst_composition_status;
+
+/**
+ * @brief Abundance moments of one zone.
+ *
+ * @details With molar abundances Y_i, charge Z_i, mass number A_i and atomic mass m_i:
+ * `abar = sum(Y A) / sum(Y)`, `zbar = sum(Y Z) / sum(Y)`, `z2bar = sum(Y Z^2) / sum(Y)`. For a
+ * normalised composition (`sum(Y A) = 1`) these are the usual `1 / sum(Y)`, `abar * Ye` and
+ * `abar * sum(Y Z^2)`.
+ *
+ * If every abundance of the zone is zero, `sum_y` and `ye` are zero and the four means are NaN;
+ * no error is reported, so batches with empty zones still fill every other zone.
+ */
+typedef struct fdst_composition_moments {
+    double sum_y; /**< Total molar abundance, sum(Y). */
+    double mean_particle_mass; /**< sum(Y m) / sum(Y) in u, as Composition::getMeanParticleMass. */
+    double ye; /**< Electron abundance sum(Y Z), as Composition::getElectronAbundance. */
+    double abar; /**< Mean mass number. */
+    double zbar; /**< Mean charge. */
+    double z2bar; /**< Mean squared charge. */
+} fdst_composition_moments;
+
+/**
+ * @brief Creates a handle for the species (z[i], a[i]), i < n_species, in that order.
+ * @param[in] z Charge numbers.
+ * @param[in] a Mass numbers.
+ * @param[in] n_species Number of species.
+ * @param[out] out The new handle; release it with fdst_composition_destroy.
+ * @return FDST_COMPOSITION_OK, FDST_COMPOSITION_INVALID_ARGUMENT or FDST_COMPOSITION_UNKNOWN_SPECIES.
+ */
+int fdst_composition_create(const int32_t* z, const int32_t* a, size_t n_species, fdst_composition** out);
+
+/**
+ * @brief Releases a handle. Passing NULL is a no-op. The bound array is not touched.
+ */
+void fdst_composition_destroy(fdst_composition* comp);
+
+/**
+ * @brief Gets the number of species of a handle (0 for NULL).
+ */
+size_t fdst_composition_species_count(const fdst_composition* comp);
+
+/**
+ * @brief Writes the atomic mass (u) of every species, in handle order, to `masses`.
+ */
+int fdst_composition_species_masses(const fdst_composition* comp, double* masses);
+
+/**
+ * @brief Writes the NUL-terminated name (e.g. "He-4") of species `index` into `buffer`.
+ * @details The name is copied; `buffer` stays owned by the caller and no pointer into the library is returned.
+ * @return FDST_COMPOSITION_INVALID_ARGUMENT if the index is out of range or the buffer is too small.
+ */
+int fdst_composition_species_name(const fdst_composition* comp, size_t index, char* buffer, size_t buffer_size);
+
+/**
+ * @brief Binds a caller-owned array of molar abundances, in handle order, without copying it.
+ *
+ * @details The array is read by every later call taking no explicit abundances, so updates made
+ * by the caller are seen immediately. It must stay valid until it is unbound (by binding NULL)
+ * or the handle is destroyed. Fortran callers must give the array the `TARGET` attribute.
+ */
+int fdst_composition_bind(fdst_composition* comp, const double* y);
+
+/**
+ * @brief Computes the moments of the bound abundances.
+ * @details The means are NaN if every bound abundance is zero, see fdst_composition_moments.
+ */
+int fdst_composition_get_moments(const fdst_composition* comp, fdst_composition_moments* out);
+
+/**
+ * @brief Writes the mass fractions of the bound abundances, in handle order, to `x`.
+ */
+int fdst_composition_get_mass_fractions(const fdst_composition* comp, double* x);
+
+/**
+ * @brief Writes the number fractions of the bound abundances, in handle order, to `x`.
+ */
+int fdst_composition_get_number_fractions(const fdst_composition* comp, double* x);
+
+/**
+ * @brief Computes the moments of `n_zones` zones.
+ * @param[in] comp Handle describing the species of every zone.
+ * @param[in] y Abundances; zone `k` starts at `y + k * zone_stride`. A Fortran array
+ * `y(n_species, n_zones)` has `zone_stride = n_species`.
+ * @param[in] n_zones Number of zones.
+ * @param[in] zone_stride Distance between zones in elements, at least the species count.
+ * @param[out] out `n_zones` moments. The means of zones whose abundances are all zero are NaN.
+ */
+int fdst_composition_moments_batch(
+    const fdst_composition* comp, const double* y, size_t n_zones, size_t zone_stride, fdst_composition_moments* out
+);
+
+/**
+ * @brief Computes the mass fractions of `n_zones` zones.
+ * @param[in] comp Handle describing the species of every zone.
+ * @param[in] y Abundances; zone `k` starts at `y + k * zone_stride`.
+ * @param[in] n_zones Number of zones.
+ * @param[in] zone_stride Distance between zones in elements, for both `y` and `x`.
+ * @param[out] x Mass fractions, laid out like `y`. May alias `y` for in-place conversion.
+ */
+int fdst_composition_mass_fractions_batch(
+    const fdst_composition* comp, const double* y, size_t n_zones, size_t zone_stride, double* x
+);
+
+/**
+ * @brief Gets the message of the last failed call on this thread, or "" if there was none.
+ * @return A NUL-terminated string owned by the library; do not free it. It stays valid until the
+ * next failing call on the same thread (successful calls leave it unchanged) or until the thread exits.
+ */
+const char* fdst_composition_last_error(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <set>
 
@@ -327,7 +328,7 @@ namespace fourdst::composition {
          *
          * @note upon registering a symbol, its molar abundance is initialized to 0.0.
          */
-        void registerSymbol(const std::string& symbol);
+        void registerSymbol(std::string_view symbol);
 
         /**
          * @brief Registers multiple new symbols.
@@ -404,7 +405,7 @@ namespace fourdst::composition {
          * @return True if the symbol is in the composition, false otherwise.
          * @throws exceptions::UnknownSymbolError if the symbol is not in the atomic species database.
          */
-        [[nodiscard]] bool contains(const std::string& symbol) const override;
+        [[nodiscard]] bool contains(std::string_view symbol) const override;
 
         /**
          * @brief Gets the number of registered species in the composition.
@@ -429,7 +430,7 @@ namespace fourdst::composition {
          * @endcode
          */
         void setMolarAbundance(
-            const std::string& symbol,
+            std::string_view symbol,
             const double& molar_abundance
         );
 
@@ -581,7 +582,7 @@ namespace fourdst::composition {
          * @throws exceptions::UnknownSymbolError if the symbol is not in the atomic species database.
          * @throws exceptions::UnregisteredSymbolError if the symbol is not in the composition.
          */
-        [[nodiscard]] double getMassFraction(const std::string& symbol) const override;
+        [[nodiscard]] double getMassFraction(std::string_view symbol) const override;
 
         /**
          * @brief Gets the mass fraction for a given species.
@@ -610,7 +611,7 @@ namespace fourdst::composition {
          * @throws exceptions::UnknownSymbolError if the symbol is not in the atomic species database.
          * @throws exceptions::UnregisteredSymbolError if the symbol is not in the composition.
          */
-        [[nodiscard]] double getNumberFraction(const std::string& symbol) const override;
+        [[nodiscard]] double getNumberFraction(std::string_view symbol) const override;
 
         /**
          * @brief Gets the number fraction for a given species.
@@ -648,7 +649,7 @@ namespace fourdst::composition {
          * require no computation. This overload is slightly less performant than the species-based overload since it
          * needs to validate the symbol exists in the atomic species database.
          */
-        [[nodiscard]] double getMolarAbundance(const std::string& symbol) const override;
+        [[nodiscard]] double getMolarAbundance(std::string_view symbol) const override;
 
         /**
          * @brief Gets the molar abundance for a given species.
@@ -737,7 +738,7 @@ namespace fourdst::composition {
          * @throws exceptions::UnregisteredSymbolError if the symbol is not registered in the composition
          * @return The index of the symbol in the sorted vector representation.
          */
-        [[nodiscard]] size_t getSpeciesIndex(const std::string& symbol) const override;
+        [[nodiscard]] size_t getSpeciesIndex(std::string_view symbol) const override;
 
         /**
          * @brief get the index in the sorted vector representation for a given symbol
@@ -785,7 +786,7 @@ namespace fourdst::composition {
          * seen in order from lightest to heaviest.
          */
         [[nodiscard]] iterator begin() override {
-            return {m_species.begin(), m_molarAbundances.begin()};
+            return {m_species.data(), m_molarAbundances.data()};
         }
 
         /**
@@ -806,7 +807,7 @@ namespace fourdst::composition {
          * seen in order from lightest to heaviest.
          */
         [[nodiscard]] const_iterator begin() const override {
-            return {m_species.cbegin(), m_molarAbundances.cbegin()};
+            return {m_species.data(), m_molarAbundances.data()};
         }
 
         /**
@@ -827,7 +828,7 @@ namespace fourdst::composition {
          * seen in order from lightest to heaviest.
          */
         [[nodiscard]] detail::CompositionIterator<false> end() override {
-            return {m_species.end(), m_molarAbundances.end()};
+            return {m_species.data() + m_species.size(), m_molarAbundances.data() + m_molarAbundances.size()};
         }
 
         /**
@@ -848,7 +849,7 @@ namespace fourdst::composition {
          * seen in order from lightest to heaviest.
          */
         [[nodiscard]] detail::CompositionIterator<true> end() const override {
-            return {m_species.cend(), m_molarAbundances.cend()};
+            return {m_species.data() + m_species.size(), m_molarAbundances.data() + m_molarAbundances.size()};
         }
 
         [[nodiscard]] std::size_t hash() const override;
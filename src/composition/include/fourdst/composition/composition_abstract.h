@@ -4,6 +4,7 @@
 #include "fourdst/composition/iterators/composition_abstract_iterator.h"
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <set>
 #include <vector>
@@ -54,7 +55,7 @@ namespace fourdst::composition {
          * @param symbol The symbol of the atomic species to check.
          * @return True if the species is contained, false otherwise.
          */
-        [[nodiscard]] virtual bool contains(const std::string& symbol) const = 0;
+        [[nodiscard]] virtual bool contains(std::string_view symbol) const = 0;
 
         [[nodiscard]] virtual size_t size() const noexcept = 0;
 
@@ -87,7 +88,7 @@ namespace fourdst::composition {
          * @param symbol The chemical symbol.
          * @return The mass fraction for the symbol.
          */
-        [[nodiscard]] virtual double getMassFraction(const std::string& symbol) const = 0;
+        [[nodiscard]] virtual double getMassFraction(std::string_view symbol) const = 0;
 
         /**
          * @brief Get the mass fraction for a given species.
@@ -101,7 +102,7 @@ namespace fourdst::composition {
          * @param symbol The chemical symbol.
          * @return The number fraction for the symbol.
          */
-        [[nodiscard]] virtual double getNumberFraction(const std::string& symbol) const = 0;
+        [[nodiscard]] virtual double getNumberFraction(std::string_view symbol) const = 0;
 
         /**
          * @brief Get the number fraction for a given species.
@@ -115,7 +116,7 @@ namespace fourdst::composition {
          * @param symbol The chemical symbol.
          * @return The molar abundance for the symbol.
          */
-        [[nodiscard]] virtual double getMolarAbundance(const std::string& symbol) const = 0;
+        [[nodiscard]] virtual double getMolarAbundance(std::string_view symbol) const = 0;
 
         /**
          * @brief Get the molar abundance for a given species.
@@ -159,7 +160,7 @@ namespace fourdst::composition {
          * @param symbol The chemical symbol.
          * @return The index of the species.
          */
-        [[nodiscard]] virtual size_t getSpeciesIndex(const std::string& symbol) const = 0;
+        [[nodiscard]] virtual size_t getSpeciesIndex(std::string_view symbol) const = 0;
 
         /**
          * @brief Get the index of a species.
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "fourdst/composition/composition_abstract.h"
+#include "fourdst/composition/iterators/composition_abstract_iterator.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <memory>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace fourdst::composition {
+    /**
+     * @class CompositionView
+     * @brief Read-only composition over abundances stored elsewhere.
+     *
+     * @details A CompositionView pairs a shared, sorted species list (the species schema) with a
+     * span of molar abundances which it does not own, for example a slice of a serialized buffer,
+     * a memory mapped file, or one zone of a batch. Constructing, copying and querying a view
+     * never copies the abundances, and views which share a schema share a single species list.
+     *
+     * The species list must be sorted in the same order used by Composition (see
+     * `atomic::operator<=>`) and contain no duplicates, and the abundances must be given in that
+     * order.
+     *
+     * Only the mutable iterators can write abundances. The first call to the non-const `begin()`
+     * or `end()` copies the abundances into storage owned by the view so that the backing memory
+     * is never modified; all other accessors keep reading from the original span. The backing
+     * memory must outlive the view (and all of its copies) until that happens.
+     *
+     * @par Example:
+     * @code
+     * const auto schema = std::make_shared<const std::vector<Species>>(std::vector{H_1, He_4});
+     * const std::vector<double> y = {0.7, 0.07};
+     * CompositionView view(schema, y);
+     * double X = view.getMassFraction(H_1);
+     * @endcode
+     */
+    class CompositionView final : public CompositionAbstract {
+    public:
+        using iterator = detail::CompositionIterator<false>;
+        using const_iterator = detail::CompositionIterator<true>;
+
+        /**
+         * @brief Constructs a view over externally owned abundances.
+         * @param species Shared, sorted species list.
+         * @param molarAbundances Molar abundances in the order of `species`.
+         * @throws exceptions::InvalidCompositionError if `species` is null or the sizes differ.
+         */
+        CompositionView(
+            std::shared_ptr<const std::vector<atomic::Species>> species,
+            std::span<const double> molarAbundances
+        );
+
+        /**
+         * @brief Constructs a view which owns its abundances.
+         * @details Used when the source data cannot be referenced directly (e.g. it is misaligned or
+         * has a foreign byte order).
+         * @param species Shared, sorted species list.
+         * @param molarAbundances Molar abundances in the order of `species`.
+         * @throws exceptions::InvalidCompositionError if `species` is null or the sizes differ.
+         */
+        CompositionView(
+            std::shared_ptr<const std::vector<atomic::Species>> species,
+            std::vector<double> molarAbundances
+        );
+
+        CompositionView(const CompositionView& other);
+        CompositionView& operator=(const CompositionView& other);
+        CompositionView(CompositionView&& other) noexcept;
+        CompositionView& operator=(CompositionView&& other) noexcept;
+        ~CompositionView() override = default;
+
+        [[nodiscard]] bool contains(const atomic::Species& species) const noexcept override;
+        [[nodiscard]] bool contains(std::string_view symbol) const override;
+
+        [[nodiscard]] size_t size() const noexcept override;
+
+        [[nodiscard]] std::set<std::string> getRegisteredSymbols() const noexcept override;
+        [[nodiscard]] const std::vector<atomic::Species>& getRegisteredSpecies() const noexcept override;
+
+        [[nodiscard]] std::unordered_map<atomic::Species, double> getMassFraction() const noexcept override;
+        [[nodiscard]] std::unordered_map<atomic::Species, double> getNumberFraction() const noexcept override;
+
+        [[nodiscard]] double getMassFraction(std::string_view symbol) const override;
+        [[nodiscard]] double getMassFraction(const atomic::Species& species) const override;
+        [[nodiscard]] double getNumberFraction(std::string_view symbol) const override;
+        [[nodiscard]] double getNumberFraction(const atomic::Species& species) const override;
+        [[nodiscard]] double getMolarAbundance(std::string_view symbol) const override;
+        [[nodiscard]] double getMolarAbundance(const atomic::Species& species) const override;
+
+        [[nodiscard]] double getMeanParticleMass() const noexcept override;
+        [[nodiscard]] double getElectronAbundance() const noexcept override;
+
+        [[nodiscard]] std::vector<double> getMassFractionVector() const noexcept override;
+        [[nodiscard]] std::vector<double> getNumberFractionVector() const noexcept override;
+        [[nodiscard]] std::vector<double> getMolarAbundanceVector() const noexcept override;
+
+        [[nodiscard]] size_t getSpeciesIndex(std::string_view symbol) const override;
+        [[nodiscard]] size_t getSpeciesIndex(const atomic::Species& species) const override;
+        [[nodiscard]] atomic::Species getSpeciesAtIndex(size_t index) const override;
+
+        [[nodiscard]] std::unique_ptr<CompositionAbstract> clone() const override;
+
+        [[nodiscard]] iterator begin() override;
+        [[nodiscard]] iterator end() override;
+        [[nodiscard]] const_iterator begin() const override;
+        [[nodiscard]] const_iterator end() const override;
+
+        [[nodiscard]] std::size_t hash() const override;
+
+        /**
+         * @brief Gets the molar abundances the view currently reads from.
+         * @return Span over the abundances, in species order.
+         */
+        [[nodiscard]] std::span<const double> molarAbundances() const noexcept { return m_abundances; }
+
+        /**
+         * @brief Gets the shared species list of the view.
+         * @return The shared species schema.
+         */
+        [[nodiscard]] const std::shared_ptr<const std::vector<atomic::Species>>& schema() const noexcept { return m_species; }
+
+        /**
+         * @brief Checks whether the view reads from its own copy of the abundances.
+         * @return True if the abundances are owned by the view, false if they reference external memory.
+         */
+        [[nodiscard]] bool ownsData() const noexcept { return !m_owned.empty() || m_abundances.empty(); }
+
+    private:
+        std::shared_ptr<const std::vector<atomic::Species>> m_species; ///< Shared sorted species schema.
+        std::span<const double> m_abundances; ///< Abundances currently read from (external or m_owned).
+        std::vector<double> m_owned; ///< Owned copy of the abundances, empty while referencing external memory.
+
+        [[nodiscard]] size_t findSpeciesIndex(const atomic::Species& species) const;
+        [[nodiscard]] double totalMass() const noexcept;
+        [[nodiscard]] double totalMoles() const noexcept;
+        void detach();
+    };
+}
@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "fourdst/composition/composition_abstract.h"
 #include "fourdst/composition/decorators/composition_decorator_abstract.h"
@@ -23,7 +24,7 @@ namespace fourdst::composition {
         );
 
         [[nodiscard]] bool contains(const atomic::Species &species) const noexcept override;
-        [[nodiscard]] bool contains(const std::string &symbol) const override;
+        [[nodiscard]] bool contains(std::string_view symbol) const override;
 
         [[nodiscard]] const std::vector<atomic::Species>& getRegisteredSpecies() const noexcept override;
         [[nodiscard]] std::set<std::string> getRegisteredSymbols() const noexcept override;
@@ -33,11 +34,11 @@ namespace fourdst::composition {
         [[nodiscard]] std::unordered_map<atomic::Species, double> getMassFraction() const noexcept override;
         [[nodiscard]] std::unordered_map<atomic::Species, double> getNumberFraction() const noexcept override;
 
-        [[nodiscard]] double getMassFraction(const std::string &symbol) const override;
+        [[nodiscard]] double getMassFraction(std::string_view symbol) const override;
         [[nodiscard]] double getMassFraction(const atomic::Species &species) const override;
-        [[nodiscard]] double getNumberFraction(const std::string &symbol) const override;
+        [[nodiscard]] double getNumberFraction(std::string_view symbol) const override;
         [[nodiscard]] double getNumberFraction(const atomic::Species &species) const override;
-        [[nodiscard]] double getMolarAbundance(const std::string &symbol) const override;
+        [[nodiscard]] double getMolarAbundance(std::string_view symbol) const override;
         [[nodiscard]] double getMolarAbundance(const atomic::Species &species) const override;
         [[nodiscard]] double getMeanParticleMass() const noexcept override;
 
@@ -47,7 +48,7 @@ namespace fourdst::composition {
         [[nodiscard]] std::vector<double> getNumberFractionVector() const noexcept override;
         [[nodiscard]] std::vector<double> getMolarAbundanceVector() const noexcept override;
 
-        [[nodiscard]] size_t getSpeciesIndex(const std::string &symbol) const override;
+        [[nodiscard]] size_t getSpeciesIndex(std::string_view symbol) const override;
         [[nodiscard]] size_t getSpeciesIndex(const atomic::Species &species) const override;
         [[nodiscard]] atomic::Species getSpeciesAtIndex(size_t index) const override;
 
@@ -53,6 +53,17 @@ namespace fourdst::composition::exceptions {
         using CompositionError::CompositionError;
     };
 
+    /**
+     * @class CompositionIOError
+     * @brief Exception thrown when composition data cannot be read from or written to external storage.
+     *
+     * This typically occurs when a data file cannot be opened or mapped, or when a buffer does not
+     * contain data in the expected format.
+     */
+    class CompositionIOError final : public CompositionError {
+        using CompositionError::CompositionError;
+    };
+
     /**
      * @class SpeciesError
      * @brief Base class for exceptions related to atomic species.
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/io/mapped_file.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace fourdst::composition::io {
+    /**
+     * @brief Magic number at the start of every composition archive ("FDSTARCH" read as little-endian).
+     */
+    inline constexpr std::uint64_t kCompositionArchiveMagic = 0x4843524154534446ULL;
+
+    /**
+     * @brief Current version of the composition archive format.
+     */
+    inline constexpr std::uint16_t kCompositionArchiveVersion = 1;
+
+    /**
+     * @brief Storage order of the abundance block of a composition archive.
+     */
+    enum class ArchiveLayout : std::uint16_t {
+        ROW_MAJOR = 0,   ///< One contiguous row of abundances per zone. Zone views read the file in place.
+        COLUMN_MAJOR = 1 ///< One contiguous column of abundances per species. Species scans across zones read the file in place.
+    };
+
+    /**
+     * @struct CompositionArchiveHeader
+     * @brief Fixed 64 byte header of a composition archive.
+     *
+     * @details A composition archive stores the compositions of many zones (for example every
+     * zone of a saved stellar model) over one shared species schema. Its layout is
+     *
+     * | Offset              | Contents                                                              |
+     * |---------------------|-----------------------------------------------------------------------|
+     * | 0                   | This header (all integers little-endian)                              |
+     * | 64                  | `species_count` packed (Z, A) species identifiers (`uint32_t`)        |
+     * | `zone_index_offset` | `zone_count` zone records: coordinate (`double`), abundance offset (`uint64_t`) |
+     * | `data_offset`       | Abundance block, row or column major (see ArchiveLayout)              |
+     *
+     * Every section starts on a 64 byte boundary, and so does every row (ROW_MAJOR) or column
+     * (COLUMN_MAJOR) of the abundance block; `stride` is the distance in bytes between
+     * consecutive rows or columns. For ROW_MAJOR archives the abundance offset of a zone record
+     * is the byte offset of the zone's row, for COLUMN_MAJOR archives it is the byte offset of the
+     * zone's entry in the first column.
+     */
+    struct CompositionArchiveHeader {
+        std::uint64_t magic = kCompositionArchiveMagic; ///< Must equal kCompositionArchiveMagic.
+        std::uint16_t version = kCompositionArchiveVersion; ///< Format version.
+        std::uint16_t layout = static_cast<std::uint16_t>(ArchiveLayout::ROW_MAJOR); ///< See ArchiveLayout.
+        std::uint32_t reserved = 0; ///< Always zero.
+        std::uint64_t schema_hash = 0; ///< Hash of the ordered species table.
+        std::uint64_t species_count = 0; ///< Number of species in the schema.
+        std::uint64_t zone_count = 0; ///< Number of zones.
+        std::uint64_t zone_index_offset = 0; ///< Byte offset of the zone index.
+        std::uint64_t data_offset = 0; ///< Byte offset of the abundance block.
+        std::uint64_t stride = 0; ///< Bytes between consecutive rows or columns of the abundance block.
+    };
+    static_assert(sizeof(CompositionArchiveHeader) == 64);
+
+    /**
+     * @brief Builds a composition archive in memory.
+     *
+     * @param[in] species Species schema, sorted in Composition order and without duplicates.
+     * @param[in] molarAbundances Row-major zones × species matrix of molar abundances.
+     * @param[in] coordinates Optional per-zone coordinate (e.g. mass coordinate). If empty, zone `i` gets coordinate `i`.
+     * @param[in] layout Storage order of the abundance block.
+     * @return The archive bytes.
+     * @throws exceptions::CompositionIOError If the matrix or coordinate sizes do not match the schema.
+     */
+    [[nodiscard]] std::vector<std::byte> build_composition_archive(
+        const std::vector<atomic::Species>& species,
+        std::span<const double> molarAbundances,
+        std::span<const double> coordinates = {},
+        ArchiveLayout layout = ArchiveLayout::ROW_MAJOR
+    );
+
+    /**
+     * @brief Builds a composition archive from a sequence of zone compositions.
+     *
+     * @details The archive schema is the union of the species of all zones; species missing from
+     * a zone are stored with a molar abundance of zero.
+     *
+     * @param[in] zones Compositions of the zones, in zone order.
+     * @param[in] coordinates Optional per-zone coordinate. If empty, zone `i` gets coordinate `i`.
+     * @param[in] layout Storage order of the abundance block.
+     * @return The archive bytes.
+     */
+    [[nodiscard]] std::vector<std::byte> build_composition_archive(
+        std::span<const Composition> zones,
+        std::span<const double> coordinates = {},
+        ArchiveLayout layout = ArchiveLayout::ROW_MAJOR
+    );
+
+    /**
+     * @brief Writes a composition archive to disk.
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] zones Compositions of the zones, in zone order.
+     * @param[in] coordinates Optional per-zone coordinate. If empty, zone `i` gets coordinate `i`.
+     * @param[in] layout Storage order of the abundance block.
+     * @throws exceptions::CompositionIOError If the file cannot be written.
+     */
+    void write_composition_archive(
+        const std::filesystem::path& path,
+        std::span<const Composition> zones,
+        std::span<const double> coordinates = {},
+        ArchiveLayout layout = ArchiveLayout::ROW_MAJOR
+    );
+
+    /**
+     * @brief Writes archive bytes (see build_composition_archive) to disk.
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] archive Archive bytes.
+     * @throws exceptions::CompositionIOError If the file cannot be written.
+     */
+    void write_composition_archive(const std::filesystem::path& path, std::span<const std::byte> archive);
+
+    /**
+     * @class CompositionArchive
+     * @brief Random access reader for composition archives.
+     *
+     * @details Opening an archive maps the file and validates the header and the species table;
+     * neither the zone index nor the abundance block is read until it is accessed, so the cost
+     * of visiting a handful of zones in a large archive is a handful of page faults.
+     *
+     * For ROW_MAJOR archives `zone()` returns a CompositionView which reads the zone's row in
+     * place. For COLUMN_MAJOR archives the zone's abundances are gathered into the view, while
+     * `species_column()` reads a species across all zones in place.
+     *
+     * Views returned by an archive reference its mapping and must not outlive it.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * io::CompositionArchive archive("model_0042.fdstarch");
+     * for (std::size_t i = 0; i < archive.zone_count(); i += 100) {
+     *     const CompositionView zone = archive.zone(i);
+     *     std::println("{} {}", archive.zone_coordinate(i), zone.getMassFraction("C-12"));
+     * }
+     * @endcode
+     */
+    class CompositionArchive {
+    public:
+        /**
+         * @brief Maps and opens the archive at `path`.
+         * @param[in] path Archive file.
+         * @throws exceptions::CompositionIOError If the file cannot be mapped or is not a valid archive.
+         */
+        explicit CompositionArchive(const std::filesystem::path& path);
+
+        /**
+         * @brief Opens an archive held in memory. The buffer is not copied and must outlive the archive.
+         * @param[in] buffer Archive bytes.
+         * @throws exceptions::CompositionIOError If the buffer is not a valid archive.
+         */
+        explicit CompositionArchive(std::span<const std::byte> buffer);
+
+        /**
+         * @brief Gets the number of zones in the archive.
+         */
+        [[nodiscard]] std::size_t zone_count() const noexcept { return m_header.zone_count; }
+
+        /**
+         * @brief Gets the number of species in the archive schema.
+         */
+        [[nodiscard]] std::size_t species_count() const noexcept { return m_header.species_count; }
+
+        /**
+         * @brief Gets the storage order of the abundance block.
+         */
+        [[nodiscard]] ArchiveLayout layout() const noexcept { return static_cast<ArchiveLayout>(m_header.layout); }
+
+        /**
+         * @brief Gets the shared species schema of the archive.
+         */
+        [[nodiscard]] const std::shared_ptr<const std::vector<atomic::Species>>& schema() const noexcept { return m_schema; }
+
+        /**
+         * @brief Gets the coordinate stored for a zone.
+         * @param[in] zone Zone index.
+         * @throws std::out_of_range If `zone` is out of range.
+         */
+        [[nodiscard]] double zone_coordinate(std::size_t zone) const;
+
+        /**
+         * @brief Gets a view of one zone's composition.
+         * @param[in] zone Zone index.
+         * @return A view over the zone; in place for ROW_MAJOR archives on little-endian hosts.
+         * @throws std::out_of_range If `zone` is out of range.
+         */
+        [[nodiscard]] CompositionView zone(std::size_t zone) const;
+
+        /**
+         * @brief Gets the molar abundances of one species across all zones, in place.
+         * @param[in] species A species of the archive schema.
+         * @return The column, or std::nullopt if the archive is ROW_MAJOR (or the host is big-endian).
+         * @throws exceptions::UnregisteredSymbolError If `species` is not part of the schema.
+         */
+        [[nodiscard]] std::optional<std::span<const double>> species_column(const atomic::Species& species) const;
+
+        /**
+         * @brief Gets the molar abundance of one species in one zone, regardless of layout.
+         * @param[in] zone Zone index.
+         * @param[in] species A species of the archive schema.
+         * @throws std::out_of_range If `zone` is out of range.
+         * @throws exceptions::UnregisteredSymbolError If `species` is not part of the schema.
+         */
+        [[nodiscard]] double molar_abundance(std::size_t zone, const atomic::Species& species) const;
+
+    private:
+        std::optional<MappedFile> m_file; ///< Owns the mapping when opened from a path.
+        std::span<const std::byte> m_bytes; ///< The archive bytes.
+        CompositionArchiveHeader m_header; ///< Decoded header.
+        std::shared_ptr<const std::vector<atomic::Species>> m_schema; ///< Shared species schema.
+
+        void open();
+        [[nodiscard]] std::uint64_t zone_offset(std::size_t zone) const;
+        [[nodiscard]] std::size_t species_index(const atomic::Species& species) const;
+    };
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_abstract.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace fourdst::composition::io {
+    /**
+     * @brief Magic number at the start of every serialized composition ("FDSTCOMP" read as little-endian).
+     */
+    inline constexpr std::uint64_t kCompositionBinaryMagic = 0x504D4F4354534446ULL;
+
+    /**
+     * @brief Current version of the binary composition format.
+     */
+    inline constexpr std::uint16_t kCompositionBinaryVersion = 1;
+
+    /**
+     * @brief Alignment, in bytes, of the header and of the abundance block.
+     */
+    inline constexpr std::size_t kCompositionBinaryAlignment = 64;
+
+    /**
+     * @brief Encoding used for the species table of a serialized composition.
+     */
+    enum class SpeciesEncoding : std::uint16_t {
+        PACKED_ZA = 0 ///< One little-endian `uint32_t` per species, `(Z << 16) | A`.
+    };
+
+    /**
+     * @struct CompositionBinaryHeader
+     * @brief Fixed 64 byte header of a serialized composition.
+     *
+     * @details The layout of a serialized composition is
+     *
+     * | Offset                | Contents                                                |
+     * |-----------------------|---------------------------------------------------------|
+     * | 0                     | This header (all integers little-endian)                |
+     * | 64                    | `species_count` packed (Z, A) identifiers (`uint32_t`)  |
+     * | `abundance_offset`    | `species_count` molar abundances (IEEE-754 `double`)    |
+     *
+     * `abundance_offset` is a multiple of 64 so that a buffer which is itself 64 byte aligned
+     * (for example a memory mapping) can be read in place with aligned vector loads. Species
+     * are written in the canonical order of Composition, and the schema hash is
+     * CompositionHash::hash_species_ids over the species table.
+     */
+    struct CompositionBinaryHeader {
+        std::uint64_t magic = kCompositionBinaryMagic; ///< Must equal kCompositionBinaryMagic.
+        std::uint16_t version = kCompositionBinaryVersion; ///< Format version.
+        std::uint16_t species_encoding = static_cast<std::uint16_t>(SpeciesEncoding::PACKED_ZA); ///< See SpeciesEncoding.
+        std::uint32_t reserved = 0; ///< Always zero.
+        std::uint64_t schema_hash = 0; ///< Hash of the ordered species table.
+        std::uint64_t species_count = 0; ///< Number of species (and abundances).
+        std::uint64_t abundance_offset = 0; ///< Byte offset of the first abundance.
+        std::uint64_t total_size = 0; ///< Total size of the serialized composition in bytes.
+        std::uint64_t padding[2] = {0, 0}; ///< Pads the header to 64 bytes.
+    };
+    static_assert(sizeof(CompositionBinaryHeader) == kCompositionBinaryAlignment);
+
+    /**
+     * @brief Computes the number of bytes needed to serialize a composition with `speciesCount` species.
+     * @param[in] speciesCount Number of species in the composition.
+     * @return Size of the serialized composition in bytes (always a multiple of 64).
+     */
+    [[nodiscard]] constexpr std::size_t serialized_size(const std::size_t speciesCount) noexcept {
+        const std::size_t speciesEnd = sizeof(CompositionBinaryHeader) + speciesCount * sizeof(std::uint32_t);
+        const std::size_t abundanceOffset = (speciesEnd + kCompositionBinaryAlignment - 1) / kCompositionBinaryAlignment * kCompositionBinaryAlignment;
+        const std::size_t end = abundanceOffset + speciesCount * sizeof(double);
+        return (end + kCompositionBinaryAlignment - 1) / kCompositionBinaryAlignment * kCompositionBinaryAlignment;
+    }
+
+    /**
+     * @brief Computes the number of bytes needed to serialize `composition`.
+     * @param[in] composition The composition to be serialized.
+     * @return Size of the serialized composition in bytes.
+     */
+    [[nodiscard]] std::size_t serialized_size(const CompositionAbstract& composition) noexcept;
+
+    /**
+     * @brief Serializes a composition into a caller provided buffer.
+     *
+     * @details No memory is allocated. The header, species table and abundances are written
+     * with little-endian byte order regardless of the host; on little-endian hosts the abundance
+     * block is a single `memcpy`. Padding bytes are zeroed so that the output is deterministic.
+     *
+     * @param[in] composition The composition to serialize.
+     * @param[out] buffer Destination buffer, at least serialized_size(composition) bytes long.
+     * @return Number of bytes written.
+     * @throws exceptions::CompositionIOError If `buffer` is too small.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * std::vector<std::byte> buffer(io::serialized_size(comp));
+     * io::serialize(comp, buffer);
+     * @endcode
+     */
+    std::size_t serialize(const CompositionAbstract& composition, std::span<std::byte> buffer);
+
+    /**
+     * @brief Serializes a composition into a newly allocated buffer.
+     * @param[in] composition The composition to serialize.
+     * @return The serialized composition.
+     */
+    [[nodiscard]] std::vector<std::byte> serialize(const CompositionAbstract& composition);
+
+    /**
+     * @brief Reads and validates the header of a serialized composition.
+     * @param[in] buffer Serialized composition.
+     * @return The decoded header (converted to host byte order).
+     * @throws exceptions::CompositionIOError If the magic number, version, species encoding or sizes are invalid.
+     */
+    [[nodiscard]] CompositionBinaryHeader read_header(std::span<const std::byte> buffer);
+
+    /**
+     * @brief Deserializes a composition into an owning Composition.
+     * @param[in] buffer Serialized composition, as written by serialize.
+     * @return A Composition with the serialized species and molar abundances.
+     * @throws exceptions::CompositionIOError If the buffer is malformed, the schema hash does not match,
+     * or a species is unknown to the species database.
+     */
+    [[nodiscard]] Composition deserialize(std::span<const std::byte> buffer);
+
+    /**
+     * @brief Deserializes a composition as a CompositionView.
+     *
+     * @details On little-endian hosts, when the abundance block of `buffer` is suitably aligned
+     * for `double`, the returned view reads the abundances directly from `buffer` and nothing
+     * but the (cached) species schema is allocated. Otherwise the abundances are copied into
+     * the view. In the zero-copy case `buffer` must outlive the view.
+     *
+     * Species schemas are cached by schema hash, so repeatedly deserializing compositions which
+     * share a species list resolves the species only once.
+     *
+     * @param[in] buffer Serialized composition, as written by serialize.
+     * @return A view of the serialized composition.
+     * @throws exceptions::CompositionIOError If the buffer is malformed, the schema hash does not match,
+     * or a species is unknown to the species database.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * io::MappedFile file("zone.fdstcomp");
+     * CompositionView view = io::deserialize_view(file.bytes());
+     * double X = view.getMassFraction("H-1");
+     * @endcode
+     */
+    [[nodiscard]] CompositionView deserialize_view(std::span<const std::byte> buffer);
+
+    /**
+     * @brief Resolves an ordered list of packed (Z, A) identifiers into a shared species schema.
+     *
+     * @details Results are cached process wide by CompositionHash::hash_species_ids, so every
+     * caller asking for the same species list receives the same schema object.
+     *
+     * @param[in] ids Packed species identifiers, strictly increasing in Composition order.
+     * @return The shared, sorted species list.
+     * @throws exceptions::CompositionIOError If an identifier does not name a known species or the list is not sorted.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<atomic::Species>> species_schema_from_ids(std::span<const std::uint32_t> ids);
+
+    /**
+     * @brief Looks up a schema already resolved by species_schema_from_ids.
+     * @param[in] schemaHash CompositionHash::hash_species_ids of the species list.
+     * @return The shared schema, or nullptr if no schema with this hash (or more than one) has been resolved.
+     */
+    [[nodiscard]] std::shared_ptr<const std::vector<atomic::Species>> find_species_schema(std::uint64_t schemaHash);
+}
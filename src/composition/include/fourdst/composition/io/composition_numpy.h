@@ -0,0 +1,308 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_abstract.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/io/mapped_file.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fourdst::composition::io {
+    /**
+     * @brief Gets the NumPy dtype descriptor (e.g. `"<f8"`) of a native arithmetic type.
+     * @tparam T `double`, `float`, or a fixed width integer type.
+     */
+    template <typename T>
+    constexpr std::string_view npy_descr() noexcept {
+        constexpr bool little = std::endian::native == std::endian::little;
+        if constexpr (std::is_same_v<T, double>) { return little ? "<f8" : ">f8"; }
+        else if constexpr (std::is_same_v<T, float>) { return little ? "<f4" : ">f4"; }
+        else if constexpr (std::is_same_v<T, std::int64_t>) { return little ? "<i8" : ">i8"; }
+        else if constexpr (std::is_same_v<T, std::int32_t>) { return little ? "<i4" : ">i4"; }
+        else if constexpr (std::is_same_v<T, std::uint64_t>) { return little ? "<u8" : ">u8"; }
+        else if constexpr (std::is_same_v<T, std::uint32_t>) { return little ? "<u4" : ">u4"; }
+        else { static_assert(sizeof(T) == 0, "Unsupported NumPy element type"); return ""; }
+    }
+
+    /**
+     * @class NpyArray
+     * @brief Non-owning view of an array in NumPy `.npy` format.
+     *
+     * @details Parses the `.npy` header (format versions 1.0, 2.0 and 3.0) and exposes the
+     * element data in place. The bytes must outlive the view.
+     */
+    class NpyArray {
+    public:
+        /**
+         * @brief Parses a `.npy` buffer.
+         * @param[in] bytes Contents of a `.npy` file.
+         * @throws exceptions::CompositionIOError If the buffer is not a valid `.npy` array.
+         */
+        explicit NpyArray(std::span<const std::byte> bytes);
+
+        /**
+         * @brief Gets the dtype descriptor, e.g. `"<f8"` or `"<U8"`.
+         */
+        [[nodiscard]] const std::string& descr() const noexcept { return m_descr; }
+
+        /**
+         * @brief Gets whether the data is stored in Fortran (column-major) order.
+         */
+        [[nodiscard]] bool fortran_order() const noexcept { return m_fortranOrder; }
+
+        /**
+         * @brief Gets the array shape.
+         */
+        [[nodiscard]] const std::vector<std::size_t>& shape() const noexcept { return m_shape; }
+
+        /**
+         * @brief Gets the number of elements (the product of the shape).
+         * @details The constructor rejects shapes whose product overflows, so this cannot wrap.
+         */
+        [[nodiscard]] std::size_t element_count() const noexcept;
+
+        /**
+         * @brief Gets the raw element data.
+         */
+        [[nodiscard]] std::span<const std::byte> data() const noexcept { return m_data; }
+
+        /**
+         * @brief Gets the elements in place, without copying.
+         * @tparam T Element type, must match descr() exactly.
+         * @return The elements in storage order.
+         * @throws exceptions::CompositionIOError If the dtype differs or the data is not aligned for `T`.
+         */
+        template <typename T>
+        [[nodiscard]] std::span<const T> values() const {
+            check_descr(npy_descr<T>(), sizeof(T));
+            if (reinterpret_cast<std::uintptr_t>(m_data.data()) % alignof(T) != 0) {
+                throw_misaligned();
+            }
+            return {reinterpret_cast<const T*>(m_data.data()), element_count()};
+        }
+
+        /**
+         * @brief Copies the elements, tolerating misaligned data.
+         * @tparam T Element type, must match descr() exactly.
+         * @throws exceptions::CompositionIOError If the dtype differs.
+         */
+        template <typename T>
+        [[nodiscard]] std::vector<T> copy_values() const {
+            check_descr(npy_descr<T>(), sizeof(T));
+            std::vector<T> out(element_count());
+            std::memcpy(out.data(), m_data.data(), out.size() * sizeof(T));
+            return out;
+        }
+
+        /**
+         * @brief Decodes a fixed width string array (`<U` or `|S` dtypes).
+         * @return The strings with trailing NUL padding removed. Non-ASCII code points are replaced by `?`.
+         * @throws exceptions::CompositionIOError If the dtype is not a string type.
+         */
+        [[nodiscard]] std::vector<std::string> strings() const;
+
+    private:
+        std::string m_descr;
+        bool m_fortranOrder = false;
+        std::vector<std::size_t> m_shape;
+        std::span<const std::byte> m_data;
+
+        void check_descr(std::string_view expected, std::size_t itemSize) const;
+        [[noreturn]] static void throw_misaligned();
+    };
+
+    /**
+     * @class NpyFile
+     * @brief Memory mapped `.npy` file.
+     *
+     * @details The file is mapped read-only and its data is accessed in place, so loading a
+     * `.npy` file costs only the page faults of the elements that are touched. Files written by
+     * NumPy or by write_npy place the data on a 64 byte boundary, so `array().values<double>()`
+     * is always zero-copy for them.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * io::NpyFile file("abundances.npy");
+     * std::span<const double> y = file.array().values<double>();
+     * @endcode
+     */
+    class NpyFile {
+    public:
+        /**
+         * @brief Maps and parses a `.npy` file.
+         * @param[in] path File to map.
+         * @throws exceptions::CompositionIOError If the file cannot be mapped or is not a valid `.npy` array.
+         */
+        explicit NpyFile(const std::filesystem::path& path);
+
+        /**
+         * @brief Gets the array view over the mapping.
+         */
+        [[nodiscard]] const NpyArray& array() const noexcept { return m_array; }
+
+    private:
+        MappedFile m_file;
+        NpyArray m_array;
+    };
+
+    /**
+     * @class NpzFile
+     * @brief Memory mapped `.npz` archive (as written by `numpy.savez` or write_composition_npz).
+     *
+     * @details Only uncompressed (stored) members are supported; archives written with
+     * `numpy.savez_compressed` are rejected. Member arrays reference the mapping directly.
+     */
+    class NpzFile {
+    public:
+        /**
+         * @brief Maps a `.npz` archive and parses every member array.
+         * @param[in] path Archive to map.
+         * @throws exceptions::CompositionIOError If the file is not a readable `.npz` archive.
+         */
+        explicit NpzFile(const std::filesystem::path& path);
+
+        /**
+         * @brief Checks whether the archive holds an array named `name` (without the `.npy` suffix).
+         */
+        [[nodiscard]] bool contains(const std::string& name) const { return m_arrays.contains(name); }
+
+        /**
+         * @brief Gets the array named `name` (without the `.npy` suffix).
+         * @throws exceptions::CompositionIOError If there is no such array.
+         */
+        [[nodiscard]] const NpyArray& at(const std::string& name) const;
+
+        /**
+         * @brief Gets the names of all arrays in the archive.
+         */
+        [[nodiscard]] std::vector<std::string> names() const;
+
+    private:
+        MappedFile m_file;
+        std::map<std::string, NpyArray> m_arrays;
+    };
+
+    /**
+     * @brief Writes a C-ordered `.npy` array straight from contiguous storage.
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] data Elements in C (row-major) order.
+     * @param[in] shape Array shape; its product must equal `data.size()`.
+     * @throws exceptions::CompositionIOError If the shape does not match or the file cannot be written.
+     */
+    template <typename T>
+    void write_npy(const std::filesystem::path& path, std::span<const T> data, const std::vector<std::size_t>& shape);
+
+    extern template void write_npy<double>(const std::filesystem::path&, std::span<const double>, const std::vector<std::size_t>&);
+    extern template void write_npy<float>(const std::filesystem::path&, std::span<const float>, const std::vector<std::size_t>&);
+    extern template void write_npy<std::int32_t>(const std::filesystem::path&, std::span<const std::int32_t>, const std::vector<std::size_t>&);
+    extern template void write_npy<std::int64_t>(const std::filesystem::path&, std::span<const std::int64_t>, const std::vector<std::size_t>&);
+    extern template void write_npy<std::uint32_t>(const std::filesystem::path&, std::span<const std::uint32_t>, const std::vector<std::size_t>&);
+    extern template void write_npy<std::uint64_t>(const std::filesystem::path&, std::span<const std::uint64_t>, const std::vector<std::size_t>&);
+
+    /**
+     * @brief Writes a batch of compositions as a `.npz` archive.
+     *
+     * @details The archive holds the arrays
+     * - `molar_abundances`: zones × species `float64` matrix,
+     * - `z`, `a`: `int32` charge and mass numbers per species,
+     * - `mass`: `float64` atomic mass per species (u),
+     * - `names`: species names (`<U` strings).
+     *
+     * Every member is stored uncompressed with its data 64 byte aligned, so it can be loaded
+     * with `numpy.load(path, mmap_mode='r')`-style tooling or with CompositionNpz without copying.
+     *
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] species Species schema in Composition order.
+     * @param[in] molarAbundances Row-major zones × species matrix.
+     * @throws exceptions::CompositionIOError If the matrix is not a whole number of zones or the file cannot be written.
+     *
+     * @par Examples
+     * @code{.py}
+     * data = numpy.load("model.npz")
+     * X = data["molar_abundances"] * data["mass"]
+     * @endcode
+     */
+    void write_composition_npz(
+        const std::filesystem::path& path,
+        const std::vector<atomic::Species>& species,
+        std::span<const double> molarAbundances
+    );
+
+    /**
+     * @brief Writes a batch of compositions as a `.npz` archive over the union of their species.
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] zones Compositions in zone order; missing species are written as zero.
+     * @throws exceptions::CompositionIOError If the file cannot be written.
+     */
+    void write_composition_npz(const std::filesystem::path& path, std::span<const Composition> zones);
+
+    /**
+     * @brief Writes a single composition as a one-zone `.npz` archive.
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] composition The composition to write.
+     * @throws exceptions::CompositionIOError If the file cannot be written.
+     */
+    void write_composition_npz(const std::filesystem::path& path, const CompositionAbstract& composition);
+
+    /**
+     * @class CompositionNpz
+     * @brief Loads a composition batch from a `.npz` archive.
+     *
+     * @details Species are resolved from the `z` and `a` arrays. When the species are already in
+     * Composition order and the abundance matrix is aligned (always the case for archives written
+     * by write_composition_npz), zone views read the mapped file in place; otherwise the matrix
+     * is copied once, reordered into Composition order.
+     */
+    class CompositionNpz {
+    public:
+        /**
+         * @brief Maps and validates a composition `.npz` archive.
+         * @param[in] path Archive to load.
+         * @throws exceptions::CompositionIOError If required arrays are missing or inconsistent, or a species is unknown.
+         */
+        explicit CompositionNpz(const std::filesystem::path& path);
+
+        CompositionNpz(const CompositionNpz&) = delete;
+        CompositionNpz& operator=(const CompositionNpz&) = delete;
+
+        /**
+         * @brief Gets the number of zones.
+         */
+        [[nodiscard]] std::size_t zone_count() const noexcept { return m_zones; }
+
+        /**
+         * @brief Gets the shared species schema.
+         */
+        [[nodiscard]] const std::shared_ptr<const std::vector<atomic::Species>>& schema() const noexcept { return m_schema; }
+
+        /**
+         * @brief Gets the row-major zones × species matrix, in schema order.
+         */
+        [[nodiscard]] std::span<const double> molar_abundances() const noexcept { return m_abundances; }
+
+        /**
+         * @brief Gets a view of one zone. The view must not outlive this object.
+         * @throws std::out_of_range If `zone` is out of range.
+         */
+        [[nodiscard]] CompositionView zone(std::size_t zone) const;
+
+    private:
+        NpzFile m_npz;
+        std::shared_ptr<const std::vector<atomic::Species>> m_schema;
+        std::vector<double> m_owned; ///< Reordered copy of the matrix, empty when reading in place.
+        std::span<const double> m_abundances;
+        std::size_t m_zones = 0;
+    };
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_abstract.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace fourdst::composition::io {
+    /**
+     * @brief Magic number at the start of every packed composition message ("FDPK" read as little-endian).
+     */
+    inline constexpr std::uint32_t kCompositionPackMagic = 0x4B504446U;
+
+    /**
+     * @brief Current version of the packed message format.
+     */
+    inline constexpr std::uint16_t kCompositionPackVersion = 1;
+
+    /**
+     * @brief How a packed message describes its species.
+     */
+    enum class PackSchema : std::uint16_t {
+        ID_ONLY = 0, ///< Only the 64 bit schema ID; the receiver must already know the schema.
+        INLINE = 1   ///< The schema ID plus the packed (Z, A) species table; the receiver learns the schema.
+    };
+
+    /**
+     * @struct CompositionPackHeader
+     * @brief Fixed 32 byte header of a packed composition message.
+     *
+     * @details Packed messages carry one or more zones over a single species schema, for example
+     * the halo zones exchanged between two ranks of a domain decomposed run. Their layout is
+     *
+     * | Offset | Contents                                                                        |
+     * |--------|---------------------------------------------------------------------------------|
+     * | 0      | This header (all integers little-endian)                                        |
+     * | 32     | INLINE messages only: `species_count` packed (Z, A) identifiers (`uint32_t`)    |
+     * | next multiple of 8 | `zone_count` × `species_count` molar abundances, zone by zone (`double`) |
+     *
+     * The schema ID is CompositionHash::hash_species_ids over the species table in Composition
+     * order, the same value stored as the schema hash of the binary and archive formats.
+     */
+    struct CompositionPackHeader {
+        std::uint32_t magic = kCompositionPackMagic; ///< Must equal kCompositionPackMagic.
+        std::uint16_t version = kCompositionPackVersion; ///< Format version.
+        std::uint16_t schema = static_cast<std::uint16_t>(PackSchema::ID_ONLY); ///< See PackSchema.
+        std::uint64_t schema_id = 0; ///< Hash of the ordered species table.
+        std::uint64_t species_count = 0; ///< Number of species per zone.
+        std::uint64_t zone_count = 0; ///< Number of zones.
+    };
+    static_assert(sizeof(CompositionPackHeader) == 32);
+
+    /**
+     * @brief Registers a species schema so that ID_ONLY messages over it can be unpacked.
+     *
+     * @details Every rank which builds the same reaction network at startup can register its
+     * species once; messages between such ranks then never need to carry the species table.
+     * Unpacking an INLINE message registers its schema as well.
+     *
+     * @param[in] species Species in Composition order, without duplicates.
+     * @return The schema ID.
+     * @throws exceptions::CompositionIOError If the species are not sorted or unknown to the species database.
+     */
+    std::uint64_t register_species_schema(const std::vector<atomic::Species>& species);
+
+    /**
+     * @brief Computes the size of the message packing a single composition.
+     * @param[in] composition The composition.
+     * @param[in] schema How the message describes its species.
+     * @return Size in bytes.
+     */
+    [[nodiscard]] std::size_t packed_size(const CompositionAbstract& composition, PackSchema schema = PackSchema::ID_ONLY) noexcept;
+
+    /**
+     * @brief Computes the size of the message packing a contiguous range of zones.
+     * @param[in] zones The zones; all of them must share one species schema.
+     * @param[in] schema How the message describes its species.
+     * @return Size in bytes.
+     */
+    [[nodiscard]] std::size_t packed_size(std::span<const Composition> zones, PackSchema schema = PackSchema::ID_ONLY) noexcept;
+
+    /**
+     * @brief Packs a single composition into a caller provided buffer.
+     *
+     * @details Nothing is allocated. Abundances are written raw (little-endian IEEE-754), so on
+     * little-endian hosts packing is a header, an optional species table and one `memcpy`.
+     *
+     * @param[in] composition The composition.
+     * @param[out] buffer Destination, at least packed_size(composition, schema) bytes long.
+     * @param[in] schema How the message describes its species.
+     * @return Number of bytes written.
+     * @throws exceptions::CompositionIOError If `buffer` is too small.
+     */
+    std::size_t pack_into(const CompositionAbstract& composition, std::span<std::byte> buffer, PackSchema schema = PackSchema::ID_ONLY);
+
+    /**
+     * @brief Packs a contiguous range of zones into one message.
+     *
+     * @param[in] zones The zones; all of them must share one species schema.
+     * @param[out] buffer Destination, at least packed_size(zones, schema) bytes long.
+     * @param[in] schema How the message describes its species.
+     * @return Number of bytes written.
+     * @throws exceptions::CompositionIOError If `buffer` is too small or the zones do not share a schema.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * // Rank A
+     * std::vector<std::byte> message(io::packed_size(halo));
+     * io::pack_into(halo, message);
+     * MPI_Send(message.data(), message.size(), MPI_BYTE, neighbour, tag, comm);
+     * // Rank B, after io::register_species_schema(network_species) at startup
+     * io::unpack_into(message, ghost_zones);
+     * @endcode
+     */
+    std::size_t pack_into(std::span<const Composition> zones, std::span<std::byte> buffer, PackSchema schema = PackSchema::ID_ONLY);
+
+    /**
+     * @brief Reads and validates the header of a packed message.
+     * @param[in] buffer Packed message.
+     * @return The decoded header.
+     * @throws exceptions::CompositionIOError If the header or the message size is invalid.
+     */
+    [[nodiscard]] CompositionPackHeader read_pack_header(std::span<const std::byte> buffer);
+
+    /**
+     * @brief Unpacks a message holding a single composition.
+     * @param[in] buffer Packed message with exactly one zone.
+     * @return The composition.
+     * @throws exceptions::CompositionIOError If the message is malformed, does not hold exactly one
+     * zone, or is ID_ONLY and its schema has not been registered.
+     */
+    [[nodiscard]] Composition unpack_from(std::span<const std::byte> buffer);
+
+    /**
+     * @brief Unpacks every zone of a message.
+     * @param[in] buffer Packed message.
+     * @return One composition per zone, in message order.
+     * @throws exceptions::CompositionIOError If the message is malformed or is ID_ONLY and its
+     * schema has not been registered.
+     */
+    [[nodiscard]] std::vector<Composition> unpack_zones_from(std::span<const std::byte> buffer);
+
+    /**
+     * @brief Unpacks every zone of a message into existing compositions.
+     *
+     * @details This is the steady state path of a halo exchange: when a target composition
+     * already has the message schema only its abundances are replaced, without allocating. Other
+     * targets are rebuilt over the message schema.
+     *
+     * @param[in] buffer Packed message.
+     * @param[in,out] zones Targets; must hold exactly as many compositions as the message has zones.
+     * @throws exceptions::CompositionIOError If the message is malformed, the zone counts differ,
+     * or the message is ID_ONLY and its schema has not been registered.
+     * @throws exceptions::InvalidCompositionError If an abundance is negative.
+     */
+    void unpack_into(std::span<const std::byte> buffer, std::span<Composition> zones);
+}
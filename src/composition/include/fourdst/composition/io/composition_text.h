@@ -0,0 +1,97 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_abstract.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fourdst::composition::io {
+    /**
+     * @brief First line of every composition text file.
+     */
+    inline constexpr std::string_view kCompositionTextHeader = "fourdst-composition 1";
+
+    /**
+     * @struct TextParseOptions
+     * @brief Tuning parameters of parse_composition_text.
+     */
+    struct TextParseOptions {
+        std::size_t threads = 0; ///< Maximum number of parser threads; 0 uses `std::thread::hardware_concurrency()`.
+        std::size_t min_chunk_bytes = std::size_t{1} << 20; ///< Inputs are only split into chunks of at least this many bytes.
+    };
+
+    /**
+     * @brief Appends one composition as a text zone block to `out`.
+     *
+     * @details The block is a `zone <n>` line followed by one `symbol  y` line per species, in
+     * Composition order. Molar abundances are written with `std::to_chars` in their shortest
+     * round-trippable form, so parsing the text restores every abundance bit for bit (NaN
+     * payloads excepted, which `utils::CompositionHash::hash_exact` ignores).
+     *
+     * @param[in,out] out String the block is appended to.
+     * @param[in] composition The composition to write.
+     */
+    void append_composition_text(std::string& out, const CompositionAbstract& composition);
+
+    /**
+     * @brief Formats compositions as a complete text file (header line plus one zone block each).
+     *
+     * @par Examples
+     * @code
+     * fourdst-composition 1
+     * zone 2
+     * H-1     0.7
+     * He-4    0.075
+     * @endcode
+     *
+     * @param[in] zones The compositions to write.
+     * @return The text.
+     */
+    [[nodiscard]] std::string to_composition_text(std::span<const Composition> zones);
+
+    /**
+     * @brief Formats a single composition as a complete text file.
+     * @param[in] composition The composition to write.
+     * @return The text.
+     */
+    [[nodiscard]] std::string to_composition_text(const CompositionAbstract& composition);
+
+    /**
+     * @brief Writes compositions to a text file.
+     * @param[in] path Destination file, replaced if it exists.
+     * @param[in] zones The compositions to write.
+     * @throws exceptions::CompositionIOError If the file cannot be written.
+     */
+    void write_composition_text(const std::filesystem::path& path, std::span<const Composition> zones);
+
+    /**
+     * @brief Parses composition text.
+     *
+     * @details Blank lines and lines starting with `#` are ignored. Large inputs are split at line
+     * boundaries into chunks which are parsed concurrently; species symbols are resolved once per
+     * chunk and abundances are read with `std::from_chars`.
+     *
+     * @param[in] text Text starting with kCompositionTextHeader.
+     * @param[in] options Parallelism of the parser.
+     * @return One composition per zone block, in file order.
+     * @throws exceptions::CompositionIOError If the text is malformed or a zone holds the wrong
+     * number of species. The message names the offending line.
+     * @throws exceptions::UnknownSymbolError If a symbol is not a known species.
+     */
+    [[nodiscard]] std::vector<Composition> parse_composition_text(std::string_view text, const TextParseOptions& options = {});
+
+    /**
+     * @brief Memory maps and parses a composition text file.
+     * @param[in] path File to read.
+     * @param[in] options Parallelism of the parser.
+     * @return One composition per zone block, in file order.
+     * @throws exceptions::CompositionIOError If the file cannot be mapped or is malformed.
+     * @throws exceptions::UnknownSymbolError If a symbol is not a known species.
+     */
+    [[nodiscard]] std::vector<Composition> read_composition_text(const std::filesystem::path& path, const TextParseOptions& options = {});
+}
@@ -0,0 +1,324 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_abstract.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/io/mapped_file.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace fourdst::composition::io {
+    /**
+     * @brief Magic number at the start of every composition time series ("FDSTSERI" read as little-endian).
+     */
+    inline constexpr std::uint64_t kCompositionTimeSeriesMagic = 0x4952455354534446ULL;
+
+    /**
+     * @brief Current version of the composition time series format.
+     */
+    inline constexpr std::uint16_t kCompositionTimeSeriesVersion = 1;
+
+    /**
+     * @struct CompositionTimeSeriesHeader
+     * @brief Fixed 64 byte header of a composition time series.
+     *
+     * @details The header (all integers little-endian) is followed by `species_count` packed
+     * (Z, A) species identifiers (`uint32_t`) and then by the frame records, see
+     * CompositionTimeSeriesWriter.
+     */
+    struct CompositionTimeSeriesHeader {
+        std::uint64_t magic = kCompositionTimeSeriesMagic; ///< Must equal kCompositionTimeSeriesMagic.
+        std::uint16_t version = kCompositionTimeSeriesVersion; ///< Format version.
+        std::uint16_t reserved[3] = {0, 0, 0}; ///< Always zero.
+        std::uint64_t schema_hash = 0; ///< Hash of the ordered species table.
+        std::uint64_t species_count = 0; ///< Number of species in the schema.
+        std::uint64_t keyframe_interval = 0; ///< Frames between consecutive keyframes.
+        std::uint64_t padding[3] = {0, 0, 0}; ///< Pads the header to 64 bytes.
+    };
+    static_assert(sizeof(CompositionTimeSeriesHeader) == 64);
+
+    /**
+     * @struct TimeSeriesOptions
+     * @brief Tuning parameters of a CompositionTimeSeriesWriter.
+     */
+    struct TimeSeriesOptions {
+        std::size_t keyframe_interval = 64; ///< A full snapshot is stored every this many frames; all other frames are deltas.
+        std::size_t max_pending = 16; ///< Maximum number of frames buffered for the background writer.
+    };
+
+    /**
+     * @class CompositionTimeSeriesWriter
+     * @brief Streams composition snapshots to disk as keyframes plus compressed deltas.
+     *
+     * @details Every `keyframe_interval` frames a keyframe holding all molar abundances is
+     * written. Every other frame is stored as a delta against the previous frame: a bitmap marks
+     * the species whose abundance changed (bit-for-bit), and the changed abundances are encoded
+     * as the XOR of their bit patterns with the previous value, storing only the meaningful bits
+     * (Gorilla encoding, Pelkonen et al. 2015). Slowly evolving abundances therefore cost a few
+     * bits each and frozen abundances cost one bitmap bit. Decoding is bit-exact.
+     *
+     * `append` only copies the abundances into a recycled buffer; encoding and file output happen
+     * on a background thread. At most `max_pending` frames are buffered. When the buffer is full
+     * `append` waits for the writer thread while `try_append` returns immediately, so a caller
+     * which must never block can use `try_append` and decide itself whether to drop or retry.
+     *
+     * Errors raised on the background thread are rethrown by the next call to `append`,
+     * `try_append`, `flush` or `close`.
+     *
+     * @par File layout
+     * A 64 byte CompositionTimeSeriesHeader, the packed (Z, A) species table, then one record per frame: `uint32_t` record length,
+     * `uint8_t` kind (0 keyframe, 1 delta), `double` time, and the payload. All values are
+     * little-endian.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * io::CompositionTimeSeriesWriter writer("burn.fdstseri", comp);
+     * for (std::size_t step = 0; step < nSteps; ++step) {
+     *     integrate(comp);
+     *     if (step % 10 == 0) writer.append(t, comp);
+     * }
+     * writer.close();
+     * @endcode
+     */
+    class CompositionTimeSeriesWriter {
+    public:
+        /**
+         * @brief Creates a time series over an explicit species schema.
+         * @param[in] path Output file, replaced if it exists.
+         * @param[in] species Species schema in Composition order; appended abundances must follow this order.
+         * @param[in] options Keyframe interval and buffering.
+         * @throws exceptions::CompositionIOError If the file cannot be created or the options are invalid.
+         */
+        CompositionTimeSeriesWriter(
+            const std::filesystem::path& path,
+            const std::vector<atomic::Species>& species,
+            TimeSeriesOptions options = {}
+        );
+
+        /**
+         * @brief Creates a time series over the species of `schema`.
+         * @param[in] path Output file, replaced if it exists.
+         * @param[in] schema Composition whose registered species form the schema. No frame is written.
+         * @param[in] options Keyframe interval and buffering.
+         * @throws exceptions::CompositionIOError If the file cannot be created or the options are invalid.
+         */
+        CompositionTimeSeriesWriter(
+            const std::filesystem::path& path,
+            const CompositionAbstract& schema,
+            TimeSeriesOptions options = {}
+        );
+
+        /**
+         * @brief Flushes all pending frames and closes the file.
+         * @note Errors are swallowed here; call close() to observe them.
+         */
+        ~CompositionTimeSeriesWriter();
+
+        CompositionTimeSeriesWriter(const CompositionTimeSeriesWriter&) = delete;
+        CompositionTimeSeriesWriter& operator=(const CompositionTimeSeriesWriter&) = delete;
+
+        /**
+         * @brief Queues a frame, waiting if the buffer is full.
+         * @param[in] time Time stamp of the frame.
+         * @param[in] molarAbundances Molar abundances in schema order.
+         * @throws exceptions::InvalidCompositionError If the number of abundances does not match the schema.
+         * @throws exceptions::CompositionIOError If the writer is closed or the background thread failed.
+         */
+        void append(double time, std::span<const double> molarAbundances);
+
+        /**
+         * @brief Queues a frame, waiting if the buffer is full.
+         * @param[in] time Time stamp of the frame.
+         * @param[in] composition Composition with exactly the schema species.
+         * @throws exceptions::InvalidCompositionError If the species of `composition` differ from the schema.
+         * @throws exceptions::CompositionIOError If the writer is closed or the background thread failed.
+         */
+        void append(double time, const CompositionAbstract& composition);
+
+        /**
+         * @brief Queues a frame if there is room in the buffer, never waiting.
+         * @param[in] time Time stamp of the frame.
+         * @param[in] molarAbundances Molar abundances in schema order.
+         * @return True if the frame was queued, false if the buffer was full.
+         * @throws exceptions::InvalidCompositionError If the number of abundances does not match the schema.
+         * @throws exceptions::CompositionIOError If the writer is closed or the background thread failed.
+         */
+        [[nodiscard]] bool try_append(double time, std::span<const double> molarAbundances);
+
+        /**
+         * @brief Waits until every queued frame has been written to the file.
+         * @throws exceptions::CompositionIOError If the background thread failed.
+         */
+        void flush();
+
+        /**
+         * @brief Writes all queued frames, stops the background thread and closes the file. Idempotent.
+         * @throws exceptions::CompositionIOError If the background thread failed.
+         */
+        void close();
+
+        /**
+         * @brief Gets the number of frames queued so far.
+         */
+        [[nodiscard]] std::size_t frames_appended() const noexcept { return m_appended; }
+
+        /**
+         * @brief Gets the species schema of the time series.
+         */
+        [[nodiscard]] const std::vector<atomic::Species>& species() const noexcept { return m_species; }
+
+    private:
+        struct Frame {
+            double time = 0.0;
+            std::vector<double> abundances;
+        };
+
+        std::vector<atomic::Species> m_species; ///< Species schema.
+        TimeSeriesOptions m_options; ///< Writer options.
+        std::ofstream m_out; ///< Output stream, only touched by the worker after construction.
+        std::size_t m_appended = 0; ///< Frames queued by the producer.
+
+        std::mutex m_mutex; ///< Guards everything below.
+        std::condition_variable m_notEmpty; ///< Signalled when a frame is queued or the writer is closing.
+        std::condition_variable m_notFull; ///< Signalled when a frame has been consumed.
+        std::deque<Frame> m_pending; ///< Frames waiting to be encoded.
+        std::vector<std::vector<double>> m_freeBuffers; ///< Recycled abundance buffers.
+        std::size_t m_inFlight = 0; ///< Frames taken by the worker but not yet written.
+        bool m_closing = false; ///< Set once close() has been requested.
+        std::exception_ptr m_error; ///< First error raised by the worker.
+
+        std::jthread m_worker; ///< Background encoder; declared last so it starts after (and stops before) the state above.
+
+        void start(const std::filesystem::path& path);
+        [[nodiscard]] bool enqueue(double time, std::span<const double> molarAbundances, bool wait);
+        void run();
+        void rethrow_error();
+    };
+
+    /**
+     * @class CompositionTimeSeriesReader
+     * @brief Replays a composition time series written by CompositionTimeSeriesWriter.
+     *
+     * @details The file is memory mapped. Opening it walks the record length prefixes to index
+     * every frame (without decoding any abundances), after which frames can be replayed
+     * sequentially with `next()` or reached directly with `seek()`, which decodes from the nearest
+     * preceding keyframe.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * io::CompositionTimeSeriesReader reader("burn.fdstseri");
+     * reader.seek_time(1.0e9);
+     * do {
+     *     std::println("{} {}", reader.time(), reader.view().getMassFraction("C-12"));
+     * } while (reader.next());
+     * @endcode
+     */
+    class CompositionTimeSeriesReader {
+    public:
+        /**
+         * @brief Opens and indexes a time series. No frame is current until next() or seek() is called.
+         * @param[in] path Time series file.
+         * @throws exceptions::CompositionIOError If the file cannot be mapped or is malformed.
+         */
+        explicit CompositionTimeSeriesReader(const std::filesystem::path& path);
+
+        /**
+         * @brief Gets the number of frames in the file.
+         */
+        [[nodiscard]] std::size_t frame_count() const noexcept { return m_records.size(); }
+
+        /**
+         * @brief Gets the frame indices of all keyframes.
+         */
+        [[nodiscard]] std::vector<std::size_t> keyframes() const;
+
+        /**
+         * @brief Gets the shared species schema.
+         */
+        [[nodiscard]] const std::shared_ptr<const std::vector<atomic::Species>>& schema() const noexcept { return m_schema; }
+
+        /**
+         * @brief Advances to the next frame.
+         * @return False (and leaves the current frame unchanged) if the last frame is current.
+         * @throws exceptions::CompositionIOError If the frame is malformed.
+         */
+        bool next();
+
+        /**
+         * @brief Makes `frame` the current frame, decoding forward from the nearest keyframe at or before it.
+         * @param[in] frame Frame index.
+         * @throws std::out_of_range If `frame` is out of range.
+         * @throws exceptions::CompositionIOError If a frame is malformed.
+         */
+        void seek(std::size_t frame);
+
+        /**
+         * @brief Makes the last frame with a time stamp at or before `time` current (or the first frame if there is none).
+         * @param[in] time Time to seek to. Frame time stamps are assumed to be non-decreasing.
+         * @return Index of the new current frame.
+         * @throws std::out_of_range If the file has no frames.
+         */
+        std::size_t seek_time(double time);
+
+        /**
+         * @brief Gets the index of the current frame.
+         * @throws std::logic_error If no frame is current.
+         */
+        [[nodiscard]] std::size_t position() const;
+
+        /**
+         * @brief Gets the time stamp of the current frame.
+         * @throws std::logic_error If no frame is current.
+         */
+        [[nodiscard]] double time() const;
+
+        /**
+         * @brief Gets the molar abundances of the current frame. Invalidated by next() and seek().
+         * @throws std::logic_error If no frame is current.
+         */
+        [[nodiscard]] std::span<const double> molar_abundances() const;
+
+        /**
+         * @brief Gets a view of the current frame. The view is invalidated by next() and seek().
+         * @throws std::logic_error If no frame is current.
+         */
+        [[nodiscard]] CompositionView view() const;
+
+    private:
+        struct Record {
+            std::size_t offset = 0; ///< Offset of the payload.
+            std::size_t length = 0; ///< Payload length in bytes.
+            bool keyframe = false;
+            double time = 0.0;
+        };
+
+        struct Window {
+            unsigned leading = 0;
+            unsigned trailing = 0;
+            bool valid = false;
+        };
+
+        MappedFile m_file; ///< Mapping of the time series.
+        std::shared_ptr<const std::vector<atomic::Species>> m_schema; ///< Shared species schema.
+        std::vector<Record> m_records; ///< Index of every frame.
+        std::vector<double> m_current; ///< Abundances of the current frame.
+        std::vector<Window> m_windows; ///< Per-species XOR windows of the delta decoder.
+        std::size_t m_position = 0; ///< Index of the current frame (valid when m_started).
+        bool m_started = false; ///< Whether a frame is current.
+
+        void decode(std::size_t frame);
+        void require_frame() const;
+    };
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace fourdst::composition::io {
+    /**
+     * @class MappedFile
+     * @brief RAII owner of a read-only memory mapping of a file.
+     *
+     * The whole file is mapped with `mmap` when the object is constructed and unmapped when it
+     * is destroyed. The contents are exposed as spans which reference the mapping directly, so
+     * parsers and views built on top of a `MappedFile` never copy the file into memory; pages
+     * are faulted in by the kernel as they are touched.
+     *
+     * The mapping is private and read-only, therefore the file on disk is never modified.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * fourdst::composition::io::MappedFile file("my_abundances.dat");
+     * fourdst::composition::io::ChemicalFileParser parser(file.chars());
+     * @endcode
+     */
+    class MappedFile {
+    public:
+        /**
+         * @brief Maps the file at `path` into memory.
+         * @param[in] path Path to the file to map.
+         * @throws exceptions::CompositionIOError If the file cannot be opened, inspected, or mapped.
+         */
+        explicit MappedFile(const std::filesystem::path& path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * @brief Gets the mapped file contents as raw bytes.
+         * @return Non-owning view over the mapping. Empty for empty files.
+         */
+        [[nodiscard]] std::span<const std::byte> bytes() const noexcept {
+            return {static_cast<const std::byte*>(m_data), m_size};
+        }
+
+        /**
+         * @brief Gets the mapped file contents as characters.
+         * @return Non-owning view over the mapping. Empty for empty files.
+         */
+        [[nodiscard]] std::span<const char> chars() const noexcept {
+            return {static_cast<const char*>(m_data), m_size};
+        }
+
+        /**
+         * @brief Gets the size of the mapped file.
+         * @return The size in bytes.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_size;
+        }
+
+    private:
+        void* m_data = nullptr; ///< Start of the mapping (nullptr for empty files).
+        std::size_t m_size = 0; ///< Size of the mapping in bytes.
+
+        void release() noexcept;
+    };
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "fourdst/composition/composition.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/io/composition_archive.h"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace fourdst::composition::io {
+    /**
+     * @class SharedCompositionSegment
+     * @brief A composition batch in a POSIX shared-memory segment, shared read-only between processes.
+     *
+     * @details The segment holds a composition archive (see CompositionArchiveHeader): the species
+     * schema, the zone index and the abundance matrix, all addressed by offsets from the start of
+     * the segment, so every process can map it at a different address. One process creates the
+     * segment; any number of worker processes attach to it and read zones as CompositionView
+     * objects straight from the shared pages. Memory use therefore stays flat with the number of
+     * workers, and attaching costs one `mmap` plus the decoding of the species table.
+     *
+     * The archive is published by writing its magic number last, so a segment which is still being
+     * filled cannot be attached. The creating process removes the segment name when its
+     * SharedCompositionSegment is destroyed (unless `release_name()` was called); processes which
+     * are already attached keep their mapping until they detach.
+     *
+     * Segment names follow `shm_open`: a leading `/` followed by up to 254 characters other than `/`.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * // Parent
+     * auto segment = io::SharedCompositionSegment::create("/model_0042", zones);
+     * // Each worker
+     * const auto shared = io::SharedCompositionSegment::attach("/model_0042");
+     * const CompositionView zone = shared.zone(17);
+     * @endcode
+     */
+    class SharedCompositionSegment {
+    public:
+        /**
+         * @brief Creates a segment holding the archive of `zones`.
+         * @param[in] name Segment name. A segment with this name must not exist.
+         * @param[in] zones Compositions of the zones, in zone order.
+         * @param[in] coordinates Optional per-zone coordinate. If empty, zone `i` gets coordinate `i`.
+         * @param[in] layout Storage order of the abundance block.
+         * @return The owning segment.
+         * @throws exceptions::CompositionIOError If the name is invalid or the segment cannot be created.
+         */
+        [[nodiscard]] static SharedCompositionSegment create(
+            const std::string& name,
+            std::span<const Composition> zones,
+            std::span<const double> coordinates = {},
+            ArchiveLayout layout = ArchiveLayout::ROW_MAJOR
+        );
+
+        /**
+         * @brief Creates a segment holding a copy of prebuilt archive bytes (see build_composition_archive).
+         * @param[in] name Segment name. A segment with this name must not exist.
+         * @param[in] archive Archive bytes.
+         * @return The owning segment.
+         * @throws exceptions::CompositionIOError If the name is invalid, the bytes are not a valid
+         * archive or the segment cannot be created.
+         */
+        [[nodiscard]] static SharedCompositionSegment create(const std::string& name, std::span<const std::byte> archive);
+
+        /**
+         * @brief Maps an existing segment read-only.
+         * @param[in] name Segment name.
+         * @return The attached segment.
+         * @throws exceptions::CompositionIOError If the segment does not exist, is not yet published
+         * or does not hold a valid archive.
+         */
+        [[nodiscard]] static SharedCompositionSegment attach(const std::string& name);
+
+        /**
+         * @brief Removes a segment name, e.g. one left behind by a crashed process.
+         * @param[in] name Segment name.
+         * @return True if a segment was removed.
+         */
+        static bool remove(const std::string& name) noexcept;
+
+        ~SharedCompositionSegment();
+
+        SharedCompositionSegment(const SharedCompositionSegment&) = delete;
+        SharedCompositionSegment& operator=(const SharedCompositionSegment&) = delete;
+
+        SharedCompositionSegment(SharedCompositionSegment&& other) noexcept;
+        SharedCompositionSegment& operator=(SharedCompositionSegment&& other) noexcept;
+
+        /**
+         * @brief Gets the segment name.
+         */
+        [[nodiscard]] const std::string& name() const noexcept { return m_name; }
+
+        /**
+         * @brief Gets the size of the mapping in bytes.
+         */
+        [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+        /**
+         * @brief Checks whether this object created the segment and will remove its name.
+         */
+        [[nodiscard]] bool owns_name() const noexcept { return m_ownsName; }
+
+        /**
+         * @brief Keeps the segment name alive after this object is destroyed.
+         */
+        void release_name() noexcept { m_ownsName = false; }
+
+        /**
+         * @brief Gets the archive reader over the mapping. Views it returns must not outlive the segment.
+         */
+        [[nodiscard]] const CompositionArchive& archive() const noexcept { return *m_archive; }
+
+        /**
+         * @brief Gets the number of zones in the segment.
+         */
+        [[nodiscard]] std::size_t zone_count() const noexcept { return m_archive->zone_count(); }
+
+        /**
+         * @brief Gets a read-only view of one zone, reading the shared pages in place for ROW_MAJOR segments.
+         * @param[in] zone Zone index.
+         * @throws std::out_of_range If `zone` is out of range.
+         */
+        [[nodiscard]] CompositionView zone(const std::size_t zone) const { return m_archive->zone(zone); }
+
+    private:
+        SharedCompositionSegment(std::string name, void* data, std::size_t size, bool ownsName);
+
+        std::string m_name; ///< Segment name.
+        void* m_data = nullptr; ///< Start of the mapping.
+        std::size_t m_size = 0; ///< Size of the mapping in bytes.
+        bool m_ownsName = false; ///< Remove the name on destruction.
+        std::optional<CompositionArchive> m_archive; ///< Reader over the mapping.
+
+        void release() noexcept;
+    };
+}
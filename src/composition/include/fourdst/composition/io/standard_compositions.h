@@ -6,7 +6,12 @@
 
 #include "quill/Logger.h"
 
+#include <filesystem>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace fourdst::composition::io  {
@@ -87,16 +92,85 @@ namespace fourdst::composition::io  {
      * Reads data buffers that contain one or more named blocks delimited by
      * `BEGIN <scheme>` / `END <scheme>` sentinels and extracts either bulk metal
      * composition records or per-isotope percentage tables.
+     *
+     * A parser constructed over a buffer indexes every block in a single pass and
+     * keeps only `std::string_view`s into the buffer, so repeated scheme lookups do not
+     * rescan the data. Fields are tokenised in place and numbers are converted with
+     * `std::from_chars`; the buffer is never copied. The buffer must outlive the parser.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * fourdst::composition::io::MappedFile file("my_abundances.dat");
+     * fourdst::composition::io::ChemicalFileParser parser(file.chars());
+     *
+     * if (const auto comp = parser.composition_data("MY_SCHEME")) {
+     *     std::println("{} elements", comp->elements.size());
+     * }
+     * @endcode
      */
     class ChemicalFileParser {
     private:
+        /**
+         * @brief A named `BEGIN`/`END` block located in the indexed buffer.
+         */
+        struct Block {
+            std::string_view name; ///< Block tag (text following `BEGIN `).
+            std::string_view body; ///< Lines strictly between the `BEGIN` and `END` sentinels.
+        };
+
+        std::vector<Block> m_blocks; ///< Index of every block in the buffer, in file order.
+
+        [[nodiscard]] const Block* find_block(std::string_view scheme) const noexcept;
 
     public:
+        /**
+         * @brief Constructs a parser with an empty index.
+         */
+        ChemicalFileParser() = default;
+
+        /**
+         * @brief Constructs a parser and indexes every `BEGIN`/`END` block in `data`.
+         *
+         * @param[in] data Raw character buffer (in memory or from a `MappedFile`). Must
+         *            outlive the parser.
+         */
+        explicit ChemicalFileParser(std::span<const char> data);
+
+        /**
+         * @brief Checks whether a block with the given tag was indexed.
+         * @param[in] scheme Block tag (e.g., `"GS98"`, `"L03_data"`).
+         * @return `true` if a block named `scheme` exists in the buffer.
+         */
+        [[nodiscard]] bool contains(std::string_view scheme) const noexcept;
+
+        /**
+         * @brief Lists the tags of every indexed block, in file order.
+         * @return Views of the block tags, referencing the parsed buffer.
+         */
+        [[nodiscard]] std::vector<std::string_view> schemes() const;
+
+        /**
+         * @brief Parses an indexed composition block.
+         * @param[in] scheme Block tag to extract (e.g., `"GS98"`).
+         * @return `CompositionData` for the block, or `std::nullopt` if it is not indexed.
+         * @throws std::invalid_argument If a numeric field cannot be parsed.
+         * @throws std::out_of_range If a numeric field value is out of `double` range.
+         */
+        [[nodiscard]] std::optional<CompositionData> composition_data(std::string_view scheme) const;
+
+        /**
+         * @brief Parses an indexed isotopic-percentage block.
+         * @param[in] scheme Block tag to extract (e.g., `"L03_data"`).
+         * @return `IsotopicPercentage` for the block, or `std::nullopt` if it is not indexed.
+         * @throws std::invalid_argument If an integer or double field cannot be parsed.
+         * @throws std::out_of_range If any parsed value exceeds its target type range.
+         */
+        [[nodiscard]] std::optional<IsotopicPercentage> isotopic_percentage(std::string_view scheme) const;
 
         /**
          * @brief Parses a named composition block from a tagged flat-text data buffer.
          *
-         * Scans the buffer line by line for `BEGIN {scheme}`, then extracts five
+         * Locates the `BEGIN {scheme}` block, then extracts five
          * fixed-position fields (comment, He abundance, atomic-weight flag, element
          * list, log10 abundance list) until `END {scheme}` is reached.  He abundance
          * and metal abundances are converted from log10 to linear scale via
@@ -106,11 +180,10 @@ namespace fourdst::composition::io  {
          *                   `get_raw_standard_solar_composition_data()`).
          * @param[in] scheme Block tag to extract (e.g., `"GS98"`, `"AGSS09"`).
          *
-         * @return `CompositionData` Populated struct; default-initialized if the
+         * @return `CompositionData` Populated struct; value-initialized if the
          *         scheme is not found.
          *
-         * @throws std::invalid_argument If a numeric field cannot be parsed by
-         *         `std::stod`.
+         * @throws std::invalid_argument If a numeric field cannot be parsed.
          * @throws std::out_of_range If a numeric field value is out of `double` range.
          *
          * @par Examples
@@ -128,10 +201,21 @@ namespace fourdst::composition::io  {
          */
         [[nodiscard]] static CompositionData parse_composition_data(const std::vector<char>& data, const std::string& scheme);
 
+        /**
+         * @brief Zero-copy overload of `parse_composition_data()` for spans.
+         *
+         * @param[in] data   Raw character buffer (in memory or from a `MappedFile`).
+         * @param[in] scheme Block tag to extract.
+         *
+         * @return `CompositionData` Populated struct; value-initialized if the
+         *         scheme is not found.
+         */
+        [[nodiscard]] static CompositionData parse_composition_data(std::span<const char> data, std::string_view scheme);
+
         /**
          * @brief Parses a named isotopic-percentage block from a tagged flat-text data buffer.
          *
-         * Scans the buffer for `BEGIN {scheme}`, then extracts five fixed-position
+         * Locates the `BEGIN {scheme}` block, then extracts five fixed-position
          * fields (comment, atomic numbers, element symbols, mass numbers, isotopic
          * percentages) until `END {scheme}` is reached.  Percentages are stored on
          * the 0-100 scale.
@@ -142,8 +226,7 @@ namespace fourdst::composition::io  {
          * @return `IsotopicPercentage` Populated struct; default-initialized if the
          *         scheme is not found.
          *
-         * @throws std::invalid_argument If an integer or double field cannot be
-         *         parsed by `std::stoi` / `std::stod`.
+         * @throws std::invalid_argument If an integer or double field cannot be parsed.
          * @throws std::out_of_range If any parsed value exceeds its target type range.
          *
          * @par Examples
@@ -161,8 +244,56 @@ namespace fourdst::composition::io  {
          * @endcode
          */
         [[nodiscard]] static IsotopicPercentage parse_isotopic_percentage(const std::vector<char>& data, const std::string& scheme);
+
+        /**
+         * @brief Zero-copy overload of `parse_isotopic_percentage()` for spans.
+         *
+         * @param[in] data   Raw character buffer (in memory or from a `MappedFile`).
+         * @param[in] scheme Block tag to extract.
+         *
+         * @return `IsotopicPercentage` Populated struct; default-initialized if the
+         *         scheme is not found.
+         */
+        [[nodiscard]] static IsotopicPercentage parse_isotopic_percentage(std::span<const char> data, std::string_view scheme);
     };
 
+    /**
+     * @brief Registers a user supplied abundance data file for use by `get_composition_record()`.
+     *
+     * The file must use the same tagged flat-text format as the embedded solar data. It is
+     * memory mapped and indexed once; subsequent lookups parse only the requested block.
+     * Schemes in registered sources shadow identically named schemes in sources registered
+     * earlier and in the embedded data.
+     *
+     * @param[in] path Path to the abundance file.
+     *
+     * @throws exceptions::CompositionIOError If the file cannot be mapped.
+     *
+     * @note Registration is thread safe and may happen at any point during the run.
+     *
+     * @par Examples
+     * @code{.cpp}
+     * fourdst::composition::io::register_abundance_file("my_abundances.dat");
+     * auto comp = fourdst::composition::get_composition_record("MY_SCHEME", "L09_data", 0.014, 0.27);
+     * @endcode
+     */
+    void register_abundance_file(const std::filesystem::path& path);
+
+    /**
+     * @brief Registers an in-memory abundance data buffer for use by `get_composition_record()`.
+     *
+     * Identical to `register_abundance_file()` except that the data are taken from (and owned
+     * by the registry after) the supplied buffer.
+     *
+     * @param[in] data Buffer in the tagged flat-text format.
+     */
+    void register_abundance_data(std::vector<char> data);
+
+    /**
+     * @brief Removes every user registered abundance source. The embedded data are unaffected.
+     */
+    void clear_registered_abundance_data();
+
 
 }
 
@@ -189,9 +320,10 @@ namespace fourdst::composition {
      *  - `L09_data` (Lodders 2009)
      *
      * **Algorithm:**
-     * 1. **Data loading** — The embedded binary `StandardMetalFractions` is copied
-     *    into a `std::vector<char>` and parsed twice: once for `metal_fraction_scheme`
-     *    and once for `isotopic_percentage_scheme`.
+     * 1. **Data loading** — Each scheme is looked up first in the user sources added
+     *    with `io::register_abundance_file()` / `io::register_abundance_data()` (most
+     *    recent first) and then in the embedded `StandardMetalFractions` data, whose
+     *    block index is built once per process. Only the two requested blocks are parsed.
      * 2. **Species list** — The isotope table is iterated; any isotope whose element
      *    appears in the metals list or is `"H"` / `"He"` is looked up in the global
      *    `atomic::species` registry by `"<Element>-<A>"` and added to the list.
@@ -217,7 +349,7 @@ namespace fourdst::composition {
      *
      * @param[in] metal_fraction_scheme      Block tag of the desired solar metal
      *            composition (e.g., `"GS98"`, `"AGSS09"`).  Case-sensitive; must
-     *            match a `BEGIN`/`END` tag in the embedded data exactly.
+     *            match a `BEGIN`/`END` tag in a registered source or the embedded data exactly.
      * @param[in] isotopic_percentage_scheme Block tag of the isotopic percentage
      *            table (e.g., `"L03_data"`, `"L09_data"`).
      * @param[in] initial_z                  Total metal mass fraction Z (0 <= Z < 1).
@@ -232,7 +364,7 @@ namespace fourdst::composition {
      *         is absent from `atomic::species`, or if either scheme tag is not
      *         present in the embedded data.
      * @throws std::invalid_argument If numeric fields in the embedded data are
-     *         malformed (propagated from `std::stod` / `std::stoi`).
+     *         malformed.
      *
      * @par Examples
      * @code{.cpp}
@@ -31,13 +31,13 @@ namespace fourdst::composition::detail {
         using pointer = ArrowProxy;
 
     private:
-        using SpecIt = std::vector<atomic::Species>::const_iterator;
-        using AbunIt = std::conditional_t<IsConst,
-                                          std::vector<double>::const_iterator,
-                                          std::vector<double>::iterator>;
+        // Raw pointers (rather than std::vector iterators) so that compositions backed by external
+        // contiguous storage (e.g. memory mapped or serialized buffers) can share this iterator.
+        using SpecIt = const atomic::Species*;
+        using AbunIt = std::conditional_t<IsConst, const double*, double*>;
 
-        SpecIt m_sIt;
-        AbunIt m_aIt;
+        SpecIt m_sIt = nullptr;
+        AbunIt m_aIt = nullptr;
 
     public:
         CompositionIterator() = default;
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "fourdst/composition/composition_abstract.h"
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace fourdst::composition::utils {
+    /**
+     * @brief Quantity printed for every species when formatting a composition.
+     */
+    enum class FormatQuantity : char {
+        MASS_FRACTION = 'X', ///< Mass fractions, the default.
+        NUMBER_FRACTION = 'n', ///< Number fractions.
+        MOLAR_ABUNDANCE = 'Y' ///< Molar abundances, as stored.
+    };
+
+    /**
+     * @brief Text layout of a formatted composition.
+     */
+    enum class FormatLayout {
+        COMPACT, ///< `Composition(Mass Fractions => [H-1: 0.7, He-4: 0.3])`, the default.
+        JSON ///< `{"H-1": 0.7, "He-4": 0.3}`; non-finite values are written as `null`.
+    };
+
+    /**
+     * @struct CompositionFormatSpec
+     * @brief Parsed format specification of a composition.
+     */
+    struct CompositionFormatSpec {
+        FormatQuantity quantity = FormatQuantity::MASS_FRACTION; ///< Quantity to print.
+        FormatLayout layout = FormatLayout::COMPACT; ///< Text layout.
+        int precision = -1; ///< Digits passed to `std::to_chars`, or -1 for the shortest round-trippable representation.
+        std::chars_format style = std::chars_format::general; ///< Floating point notation.
+    };
+
+    /**
+     * @brief Largest precision accepted in a composition format spec.
+     */
+    inline constexpr int kMaxFormatPrecision = 100;
+
+    /**
+     * @brief Parses a composition format spec of the form `[X|n|Y][c|j][.precision][e|f|g]`.
+     *
+     * @details
+     * - `X` mass fractions (default), `n` number fractions, `Y` molar abundances.
+     * - `c` compact layout (default), `j` JSON layout.
+     * - `.precision` digits for `std::to_chars`; without it values are written in their shortest
+     *   round-trippable form.
+     * - `e` scientific, `f` fixed, `g` general (default) notation.
+     *
+     * @param[in] spec The text between `:` and `}` of a replacement field.
+     * @param[out] out The parsed spec.
+     * @return The number of characters consumed (`spec.size()` on success), or `std::string_view::npos`
+     * if the precision is missing or larger than kMaxFormatPrecision.
+     */
+    constexpr std::size_t parse_composition_format_spec(const std::string_view spec, CompositionFormatSpec& out) noexcept {
+        std::size_t pos = 0;
+        if (pos < spec.size() && (spec[pos] == 'X' || spec[pos] == 'n' || spec[pos] == 'Y')) {
+            out.quantity = static_cast<FormatQuantity>(spec[pos++]);
+        }
+        if (pos < spec.size() && (spec[pos] == 'c' || spec[pos] == 'j')) {
+            out.layout = spec[pos++] == 'j' ? FormatLayout::JSON : FormatLayout::COMPACT;
+        }
+        if (pos < spec.size() && spec[pos] == '.') {
+            ++pos;
+            const std::size_t digitsStart = pos;
+            int precision = 0;
+            while (pos < spec.size() && spec[pos] >= '0' && spec[pos] <= '9' && precision <= kMaxFormatPrecision) {
+                precision = precision * 10 + (spec[pos++] - '0');
+            }
+            if (pos == digitsStart || precision > kMaxFormatPrecision) {
+                return std::string_view::npos;
+            }
+            out.precision = precision;
+        }
+        if (pos < spec.size() && (spec[pos] == 'e' || spec[pos] == 'f' || spec[pos] == 'g')) {
+            out.style = spec[pos] == 'e' ? std::chars_format::scientific : spec[pos] == 'f' ? std::chars_format::fixed : std::chars_format::general;
+            ++pos;
+        }
+        return pos;
+    }
+
+    /**
+     * @brief Appends the text of a composition to `out`.
+     *
+     * @details The totals needed for mass or number fractions are computed in one pass over the
+     * abundances and every value is written with `std::to_chars`, so formatting is linear in the
+     * number of species.
+     *
+     * @param[in,out] out String the text is appended to.
+     * @param[in] composition The composition to format.
+     * @param[in] spec Quantity, layout and number format.
+     */
+    void format_composition(std::string& out, const CompositionAbstract& composition, const CompositionFormatSpec& spec);
+
+    /**
+     * @brief Formats a composition into a new string.
+     * @param[in] composition The composition to format.
+     * @param[in] spec Quantity, layout and number format.
+     * @return The formatted text.
+     */
+    [[nodiscard]] std::string format_composition(const CompositionAbstract& composition, const CompositionFormatSpec& spec = {});
+
+    /**
+     * @brief `std::formatter` implementation shared by every composition type.
+     */
+    struct CompositionFormatter {
+        CompositionFormatSpec spec;
+
+        constexpr std::format_parse_context::iterator parse(std::format_parse_context& ctx) {
+            const auto end = std::find(ctx.begin(), ctx.end(), '}');
+            const std::string_view text(ctx.begin(), end);
+            if (parse_composition_format_spec(text, spec) != text.size()) {
+                throw std::format_error("Invalid composition format spec; expected [X|n|Y][c|j][.precision][e|f|g].");
+            }
+            return end;
+        }
+
+        template <typename FormatContext>
+        typename FormatContext::iterator format(const CompositionAbstract& composition, FormatContext& ctx) const {
+            const std::string text = format_composition(composition, spec);
+            return std::ranges::copy(text, ctx.out()).out;
+        }
+    };
+}
+
+/**
+ * @brief Specialization of `std::formatter` for every composition type (Composition,
+ * CompositionView, MaskedComposition, ...).
+ *
+ * @par Examples
+ * @code{.cpp}
+ * std::println("{}", comp);      // Composition(Mass Fractions => [H-1: 0.7, He-4: 0.3])
+ * std::println("{:Yj.6e}", comp); // {"H-1": 7.000000e-01, "He-4": 7.500000e-02}
+ * @endcode
+ */
+template <typename CompositionT>
+    requires std::is_base_of_v<fourdst::composition::CompositionAbstract, CompositionT>
+struct std::formatter<CompositionT, char> : fourdst::composition::utils::CompositionFormatter {};
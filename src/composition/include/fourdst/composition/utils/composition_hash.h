@@ -3,6 +3,7 @@
 #include <cstring>
 #include <vector>
 #include <bit>
+#include <span>
 
 #include "xxhash64.h"
 #include "fourdst/composition/composition.h"
@@ -69,6 +70,55 @@ namespace fourdst::composition::utils {
             return mum(h0 ^ h1 ^ h2 ^ h3, kPrime3);
         }
 
+        /**
+         * @brief Hashes an ordered list of packed species identifiers.
+         * @details Two species lists hash equal only if they contain the same species in the same
+         * order. Used to tag serialized data with the species schema it was written with.
+         * @param ids Packed species identifiers, see pack_species_id.
+         * @return 64-bit schema hash.
+         */
+        static uint64_t hash_species_ids(const std::span<const uint32_t> ids) noexcept {
+            uint64_t h = kSeed ^ ids.size();
+            for (const uint32_t id : ids) {
+                h ^= id;
+                h = mix(h);
+            }
+            return mum(h, kPrime3);
+        }
+
+        /**
+         * @brief Hashes an ordered species list without materialising its packed identifiers.
+         * @param species A species list, e.g. CompositionAbstract::getRegisteredSpecies().
+         * @return The same hash as hash_species_ids over the packed identifiers of `species`.
+         */
+        static uint64_t hash_species_schema(const std::vector<atomic::Species>& species) noexcept {
+            uint64_t h = kSeed ^ species.size();
+            for (const auto& sp : species) {
+                h ^= pack_species_id(sp);
+                h = mix(h);
+            }
+            return mum(h, kPrime3);
+        }
+
+        /**
+         * @brief Packs the charge and mass numbers of a species into a single 32-bit identifier.
+         * @param s Any type exposing `z()` and `a()`.
+         * @return `(Z << 16) | A`.
+         */
+        static inline uint32_t pack_species_id(const auto& s) noexcept {
+            return pack_species_id(s.z(), s.a());
+        }
+
+        /**
+         * @brief Packs a charge and mass number into a single 32-bit identifier.
+         * @param z Charge number.
+         * @param a Mass number.
+         * @return `(Z << 16) | A`.
+         */
+        static constexpr uint32_t pack_species_id(const int z, const int a) noexcept {
+            return (static_cast<uint32_t>(static_cast<uint16_t>(z)) << 16) | static_cast<uint32_t>(static_cast<uint16_t>(a));
+        }
+
     private:
         static constexpr uint64_t kSeed = 0xC04D5EEDBEEFull;
         static constexpr uint64_t kPrime1 = 0xa0761d6478bd642fULL;
@@ -93,12 +143,6 @@ namespace fourdst::composition::utils {
             }
             return std::bit_cast<uint64_t>(v);
         }
-
-        static inline uint32_t pack_species_id(const auto& s) noexcept {
-            const auto z = static_cast<uint16_t>(s.z());
-            const auto a = static_cast<uint16_t>(s.a());
-            return (static_cast<uint32_t>(z) << 16) | static_cast<uint32_t>(a);
-        }
     };
 }
 
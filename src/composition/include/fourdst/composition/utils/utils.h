@@ -4,10 +4,34 @@
 #include "fourdst/atomic/atomicSpecies.h"
 
 #include <vector>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+
+namespace fourdst::atomic {
+    class SpeciesTable;
+}
 
 namespace fourdst::composition {
+    /**
+     * @struct SpeciesHandle
+     * @brief Species of the species database found by findSpecies(), referenced without copying it.
+     *
+     * @details The species lives in the compiled-in database, or in the installed species table
+     * which the handle keeps alive, so the reference stays valid for the lifetime of the handle
+     * even if another table is installed meanwhile.
+     */
+    struct SpeciesHandle {
+        const atomic::Species* species = nullptr; ///< The species; nullptr if the symbol is unknown.
+        std::shared_ptr<const atomic::SpeciesTable> table; ///< Owner of `species` if it comes from an installed table.
+
+        [[nodiscard]] explicit operator bool() const noexcept { return species != nullptr; }
+        [[nodiscard]] const atomic::Species& operator*() const noexcept { return *species; }
+        [[nodiscard]] const atomic::Species* operator->() const noexcept { return species; }
+    };
+
     /**
      * @brief Build a Composition object from symbols and their corresponding mass fractions.
      * @param symbols The symbols to register.
@@ -35,6 +59,21 @@ namespace fourdst::composition {
         const std::vector<double>& massFractions
     );
 
+    /**
+     * @brief Build a Composition object from symbols viewed in a caller's buffer and their corresponding mass fractions.
+     * @details Meant for symbols parsed out of a file: every symbol is looked up once, without copying it into a `std::string`.
+     * @param symbols The symbols to register.
+     * @param massFractions The corresponding mass fractions for each symbol.
+     * @return A Composition object constructed from the provided symbols and mass fractions.
+     * @throws exceptions::UnknownSymbolError if any symbol is not in the species database.
+     * @throws exceptions::InvalidCompositionError if the provided mass fractions do not sum to within one part in 10^10 of 1.0.
+     * @throws exceptions::InvalidCompositionError if the number of symbols does not match the number of mass fractions.
+     */
+    Composition buildCompositionFromMassFractions(
+        std::span<const std::string_view> symbols,
+        std::span<const double> massFractions
+    );
+
     /**
      * @brief Build a Composition object from species in a set and their corresponding mass fractions.
      * @param species The species to register.
@@ -90,5 +129,40 @@ namespace fourdst::composition {
         std::map<std::string, double> massFractions
     );
 
-    std::optional<fourdst::atomic::Species> getSpecies(const std::string& symbol);
+    /**
+     * @brief Look up a species by its symbol (e.g. "Fe-56", or any notation accepted by atomic::parse_nuclide()).
+     * @param symbol The species symbol.
+     * @return The matching species, or std::nullopt if the symbol is unknown.
+     * @note Uses the table set with atomic::SpeciesTable::install() if there is one, and the
+     * compiled-in species database otherwise.
+     */
+    std::optional<fourdst::atomic::Species> getSpecies(std::string_view symbol);
+
+    /**
+     * @brief Look up a species by its symbol (e.g. "Fe-56") without copying it.
+     * @details Canonical names ("Fe-56") take a single hash probe into the installed table or the
+     * compiled-in species database. Other notations ("fe56", "56Fe", "p", "alpha") are decoded by
+     * atomic::parse_nuclide() and looked up by (Z, A). Neither the symbol nor the species is
+     * copied. The composition methods taking a symbol use this lookup, so they accept every such notation.
+     * @param symbol The species symbol.
+     * @return A handle to the matching species; empty if the symbol is unknown.
+     *
+     * @par Example
+     * @code
+     * if (const auto fe56 = fourdst::composition::findSpecies("Fe-56")) {
+     *     const double mass = fe56->mass();
+     * }
+     * @endcode
+     */
+    [[nodiscard]] SpeciesHandle findSpecies(std::string_view symbol) noexcept;
+
+    /**
+     * @brief Look up a species by its charge and mass numbers.
+     * @param z The charge number (number of protons).
+     * @param a The mass number (number of nucleons).
+     * @return The matching species, or std::nullopt if no species with this (Z, A) is known.
+     * @note Uses the table set with atomic::SpeciesTable::install() if there is one, and the
+     * compiled-in species database otherwise.
+     */
+    std::optional<fourdst::atomic::Species> getSpecies(int z, int a);
 }
\ No newline at end of file
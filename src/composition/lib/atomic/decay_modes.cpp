@@ -0,0 +1,207 @@
+#include "fourdst/atomic/decay_modes.h"
+#include "fourdst/atomic/elements.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <utility>
+
+namespace {
+    using fourdst::atomic::DecayBranch;
+    using fourdst::atomic::DecayMode;
+
+    constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+    /**
+     * β-delayed modes are part of the β branch of their family; PARENT marks the β branch itself.
+     */
+    enum class Family : std::uint8_t { NONE, BETA_MINUS_PARENT, BETA_MINUS_DELAYED, BETA_PLUS_PARENT, BETA_PLUS_DELAYED };
+
+    struct ModeInfo {
+        std::string_view token;
+        DecayMode mode;
+        int dz;
+        int da;
+        bool fission;
+        Family family;
+    };
+
+    // Indexed by DecayMode; the daughter is (Z + dz, A + da)
+    constexpr std::array<ModeInfo, 31> kModes{{
+        {"B-", DecayMode::BETA_MINUS, 1, 0, false, Family::BETA_MINUS_PARENT},
+        {"B-n", DecayMode::BETA_MINUS_NEUTRON, 1, -1, false, Family::BETA_MINUS_DELAYED},
+        {"B-2n", DecayMode::BETA_MINUS_TWO_NEUTRON, 1, -2, false, Family::BETA_MINUS_DELAYED},
+        {"B-3n", DecayMode::BETA_MINUS_THREE_NEUTRON, 1, -3, false, Family::BETA_MINUS_DELAYED},
+        {"B-4n", DecayMode::BETA_MINUS_FOUR_NEUTRON, 1, -4, false, Family::BETA_MINUS_DELAYED},
+        {"B-p", DecayMode::BETA_MINUS_PROTON, 0, -1, false, Family::BETA_MINUS_DELAYED},
+        {"B-d", DecayMode::BETA_MINUS_DEUTERON, 0, -2, false, Family::BETA_MINUS_DELAYED},
+        {"B-t", DecayMode::BETA_MINUS_TRITON, 0, -3, false, Family::BETA_MINUS_DELAYED},
+        {"B-A", DecayMode::BETA_MINUS_ALPHA, -1, -4, false, Family::BETA_MINUS_DELAYED},
+        {"B-SF", DecayMode::BETA_MINUS_FISSION, 0, 0, true, Family::BETA_MINUS_DELAYED},
+        {"2B-", DecayMode::DOUBLE_BETA_MINUS, 2, 0, false, Family::NONE},
+        {"B+", DecayMode::BETA_PLUS, -1, 0, false, Family::BETA_PLUS_PARENT},
+        {"EC", DecayMode::ELECTRON_CAPTURE, -1, 0, false, Family::BETA_PLUS_PARENT},
+        {"e+", DecayMode::POSITRON_EMISSION, -1, 0, false, Family::BETA_PLUS_PARENT},
+        {"B+p", DecayMode::BETA_PLUS_PROTON, -2, -1, false, Family::BETA_PLUS_DELAYED},
+        {"B+2p", DecayMode::BETA_PLUS_TWO_PROTON, -3, -2, false, Family::BETA_PLUS_DELAYED},
+        {"B+3p", DecayMode::BETA_PLUS_THREE_PROTON, -4, -3, false, Family::BETA_PLUS_DELAYED},
+        {"B+A", DecayMode::BETA_PLUS_ALPHA, -3, -4, false, Family::BETA_PLUS_DELAYED},
+        {"B+pA", DecayMode::BETA_PLUS_PROTON_ALPHA, -4, -5, false, Family::BETA_PLUS_DELAYED},
+        {"B+SF", DecayMode::BETA_PLUS_FISSION, 0, 0, true, Family::BETA_PLUS_DELAYED},
+        {"2B+", DecayMode::DOUBLE_BETA_PLUS, -2, 0, false, Family::NONE},
+        {"A", DecayMode::ALPHA, -2, -4, false, Family::NONE},
+        {"p", DecayMode::PROTON, -1, -1, false, Family::NONE},
+        {"2p", DecayMode::TWO_PROTON, -2, -2, false, Family::NONE},
+        {"3p", DecayMode::THREE_PROTON, -3, -3, false, Family::NONE},
+        {"n", DecayMode::NEUTRON, 0, -1, false, Family::NONE},
+        {"2n", DecayMode::TWO_NEUTRON, 0, -2, false, Family::NONE},
+        {"3n", DecayMode::THREE_NEUTRON, 0, -3, false, Family::NONE},
+        {"IT", DecayMode::ISOMERIC_TRANSITION, 0, 0, false, Family::NONE},
+        {"SF", DecayMode::SPONTANEOUS_FISSION, 0, 0, true, Family::NONE},
+        {"cluster", DecayMode::CLUSTER, 0, 0, false, Family::NONE},
+    }};
+    static_assert(std::ranges::all_of(std::views::iota(std::size_t{0}, kModes.size()), [](const std::size_t i) {
+        return static_cast<std::size_t>(kModes[i].mode) == i;
+    }));
+
+    const ModeInfo& info(const DecayMode mode) noexcept {
+        return kModes[static_cast<std::size_t>(mode)];
+    }
+
+    std::string_view trim(std::string_view s) noexcept {
+        while (!s.empty() && s.front() == ' ') {
+            s.remove_prefix(1);
+        }
+        while (!s.empty() && s.back() == ' ') {
+            s.remove_suffix(1);
+        }
+        return s;
+    }
+
+    /**
+     * Decodes a cluster token such as "14C" into the charge and mass numbers of the cluster. Of
+     * mixed clusters ("24Ne+26Ne") the first is taken.
+     */
+    bool parse_cluster(std::string_view token, int& z, int& a) {
+        const char* end = token.data() + token.size();
+        const auto [ptr, ec] = std::from_chars(token.data(), end, a);
+        if (ec != std::errc{} || ptr == token.data()) {
+            return false;
+        }
+        std::string_view symbol(ptr, static_cast<std::size_t>(end - ptr));
+        symbol = symbol.substr(0, symbol.find('+'));
+        const auto it = fourdst::atomic::symbol_element_map.find(symbol);
+        if (it == fourdst::atomic::symbol_element_map.end()) {
+            return false;
+        }
+        z = it->second;
+        return true;
+    }
+
+    /**
+     * Reads the intensity after the relation of an entry, in percent; NaN for "?" or a missing value.
+     */
+    double parse_intensity(std::string_view rest) noexcept {
+        rest = trim(rest);
+        if (!rest.empty() && (rest.front() == '=' || rest.front() == '~' || rest.front() == '<' || rest.front() == '>')) {
+            rest = trim(rest.substr(1));
+        }
+        double percent = kNaN;
+        const auto [ptr, ec] = std::from_chars(rest.data(), rest.data() + rest.size(), percent);
+        if (ec != std::errc{}) {
+            return kNaN;
+        }
+        return percent / 100.0;
+    }
+}
+
+namespace fourdst::atomic {
+    std::string_view toString(const DecayMode mode) noexcept {
+        return info(mode).token;
+    }
+
+    std::vector<DecayBranch> parseDecayModes(const std::string_view decayModes, const int z, const int a) {
+        std::vector<DecayBranch> branches;
+        std::size_t pos = 0;
+        while (pos <= decayModes.size()) {
+            std::size_t end = decayModes.find(';', pos);
+            if (end == std::string_view::npos) {
+                end = decayModes.size();
+            }
+            const std::string_view entry = trim(decayModes.substr(pos, end - pos));
+            pos = end + 1;
+
+            const std::size_t split = entry.find_first_of("=~<> ?");
+            const std::string_view token = entry.substr(0, split);
+            const std::string_view rest = split == std::string_view::npos ? std::string_view{} : entry.substr(split);
+            if (token.empty() || token == "IS") {
+                continue;
+            }
+
+            const ModeInfo* mode = nullptr;
+            for (const ModeInfo& candidate : kModes) {
+                if (candidate.token == token) {
+                    mode = &candidate;
+                    break;
+                }
+            }
+            if (token == "EC+B+") {
+                mode = &info(DecayMode::BETA_PLUS);
+            }
+
+            DecayBranch branch{};
+            branch.branchingRatio = parse_intensity(rest);
+            if (mode != nullptr && mode->mode != DecayMode::CLUSTER) {
+                branch.mode = mode->mode;
+                branch.daughterZ = mode->fission ? -1 : z + mode->dz;
+                branch.daughterA = mode->fission ? -1 : a + mode->da;
+            } else if (int clusterZ = 0, clusterA = 0; parse_cluster(token, clusterZ, clusterA)) {
+                branch.mode = DecayMode::CLUSTER;
+                branch.daughterZ = z - clusterZ;
+                branch.daughterA = a - clusterA;
+            } else {
+                continue;
+            }
+            branches.push_back(branch);
+        }
+
+        // Make the channels exclusive: the parent of a β family is B+ if present, otherwise EC or e+
+        auto parent_of = [&branches](const Family family) -> DecayBranch* {
+            DecayBranch* parent = nullptr;
+            for (DecayBranch& branch : branches) {
+                if (info(branch.mode).family != family) {
+                    continue;
+                }
+                if (branch.mode == DecayMode::BETA_PLUS || branch.mode == DecayMode::BETA_MINUS) {
+                    return &branch;
+                }
+                if (parent == nullptr) {
+                    parent = &branch;
+                }
+            }
+            return parent;
+        };
+        const bool hasBetaPlus = std::ranges::any_of(branches, [](const DecayBranch& b) { return b.mode == DecayMode::BETA_PLUS; });
+        if (hasBetaPlus) {
+            std::erase_if(branches, [](const DecayBranch& b) {
+                return b.mode == DecayMode::ELECTRON_CAPTURE || b.mode == DecayMode::POSITRON_EMISSION;
+            });
+        }
+        for (const auto& [delayed, parentFamily] : {std::pair{Family::BETA_MINUS_DELAYED, Family::BETA_MINUS_PARENT}, std::pair{Family::BETA_PLUS_DELAYED, Family::BETA_PLUS_PARENT}}) {
+            DecayBranch* parent = parent_of(parentFamily);
+            if (parent == nullptr || std::isnan(parent->branchingRatio)) {
+                continue;
+            }
+            for (const DecayBranch& branch : branches) {
+                if (info(branch.mode).family == delayed && !std::isnan(branch.branchingRatio)) {
+                    parent->branchingRatio = std::max(0.0, parent->branchingRatio - branch.branchingRatio);
+                }
+            }
+        }
+        return branches;
+    }
+}
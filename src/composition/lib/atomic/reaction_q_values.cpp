@@ -0,0 +1,162 @@
+#include "fourdst/atomic/reaction_q_values.h"
+
+#include "species_table_cache.h"
+
+#include "xxhash64.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    using fourdst::atomic::ReactionQValues;
+    using fourdst::atomic::ReactionTerm;
+    using fourdst::atomic::SpeciesTable;
+
+    void check_network(const SpeciesTable& table, const std::span<const std::uint32_t> offsets, const std::span<const ReactionTerm> terms) {
+        if (offsets.empty() || offsets.front() != 0 || offsets.back() != terms.size() || !std::ranges::is_sorted(offsets)) {
+            throw std::invalid_argument(
+                "Reaction offsets must start at 0, be non-decreasing and end at the number of terms (" + std::to_string(terms.size()) + ")."
+            );
+        }
+        for (const ReactionTerm& term : terms) {
+            if (term.species >= table.size()) {
+                throw std::out_of_range("Species id " + std::to_string(term.species) + " is out of range for a table of " + std::to_string(table.size()) + " species.");
+            }
+        }
+    }
+
+    // Bound on the number of cached networks (one per network definition and table)
+    constexpr std::size_t kMaxCachedNetworks = 1024;
+
+    struct QValueCacheEntry {
+        std::shared_ptr<const SpeciesTable> table;
+        std::vector<std::uint32_t> offsets;
+        std::vector<ReactionTerm> terms;
+        std::shared_ptr<const ReactionQValues> values;
+    };
+
+    struct QValueCache {
+        std::mutex mutex;
+        std::unordered_multimap<std::uint64_t, QValueCacheEntry> entries;
+    };
+
+    QValueCache& q_value_cache() {
+        static QValueCache cache;
+        return cache;
+    }
+
+    std::uint64_t hash_network(const std::span<const std::uint32_t> offsets, const std::span<const ReactionTerm> terms) noexcept {
+        const std::uint64_t termHash = XXHash64::hash(terms.data(), terms.size_bytes(), 0);
+        return XXHash64::hash(offsets.data(), offsets.size_bytes(), termHash);
+    }
+
+    bool same_network(
+        const QValueCacheEntry& entry,
+        const SpeciesTable* table,
+        const std::span<const std::uint32_t> offsets,
+        const std::span<const ReactionTerm> terms
+    ) noexcept {
+        return entry.table.get() == table
+            && std::ranges::equal(entry.offsets, offsets)
+            && std::ranges::equal(entry.terms, terms, [](const ReactionTerm& a, const ReactionTerm& b) {
+                return a.species == b.species && a.stoichiometry == b.stoichiometry;
+            });
+    }
+}
+
+namespace fourdst::atomic {
+    void computeQValues(
+        const SpeciesTable& table,
+        const std::span<const std::uint32_t> offsets,
+        const std::span<const ReactionTerm> terms,
+        const std::span<double> qValues,
+        const std::span<double> uncertainties
+    ) {
+        check_network(table, offsets, terms);
+        const std::size_t reactions = offsets.size() - 1;
+        if (qValues.size() != reactions || (!uncertainties.empty() && uncertainties.size() != reactions)) {
+            throw std::invalid_argument("Q-value outputs must hold one value per reaction (" + std::to_string(reactions) + ").");
+        }
+
+        const double* excess = table.massExcess().data();
+        for (std::size_t r = 0; r < reactions; ++r) {
+            double q = 0.0;
+            for (std::uint32_t t = offsets[r]; t < offsets[r + 1]; ++t) {
+                q -= terms[t].stoichiometry * excess[terms[t].species];
+            }
+            qValues[r] = q;
+        }
+        if (uncertainties.empty()) {
+            return;
+        }
+        const double* sigma = table.massExcessUnc().data();
+        for (std::size_t r = 0; r < reactions; ++r) {
+            double variance = 0.0;
+            for (std::uint32_t t = offsets[r]; t < offsets[r + 1]; ++t) {
+                const double s = terms[t].stoichiometry * sigma[terms[t].species];
+                variance += s * s;
+            }
+            uncertainties[r] = std::sqrt(variance);
+        }
+    }
+
+    ReactionQValues::ReactionQValues(const SpeciesTable& table, const std::span<const std::uint32_t> offsets, const std::span<const ReactionTerm> terms) {
+        const std::size_t reactions = offsets.empty() ? 0 : offsets.size() - 1;
+        m_qValues.resize(reactions);
+        m_uncertainties.resize(reactions);
+        computeQValues(table, offsets, terms, m_qValues, m_uncertainties);
+    }
+
+    std::shared_ptr<const ReactionQValues> ReactionQValues::cached(const std::span<const std::uint32_t> offsets, const std::span<const ReactionTerm> terms) {
+        if (auto installed = SpeciesTable::installed()) {
+            return cached(std::move(installed), offsets, terms);
+        }
+        // The builtin table lives for the whole program, so it is referenced without an owner count
+        return cached(std::shared_ptr<const SpeciesTable>{std::shared_ptr<const SpeciesTable>{}, &SpeciesTable::builtin()}, offsets, terms);
+    }
+
+    std::shared_ptr<const ReactionQValues> ReactionQValues::cached(
+        std::shared_ptr<const SpeciesTable> table,
+        const std::span<const std::uint32_t> offsets,
+        const std::span<const ReactionTerm> terms
+    ) {
+        if (table == nullptr) {
+            throw std::invalid_argument("Cannot compute Q-values over a null species table.");
+        }
+        const std::uint64_t networkHash = hash_network(offsets, terms);
+
+        QValueCache& cache = q_value_cache();
+        {
+            std::scoped_lock lock(cache.mutex);
+            const auto [first, last] = cache.entries.equal_range(networkHash);
+            for (auto it = first; it != last; ++it) {
+                if (same_network(it->second, table.get(), offsets, terms)) {
+                    return it->second.values;
+                }
+            }
+        }
+
+        auto values = std::make_shared<const ReactionQValues>(*table, offsets, terms);
+        std::scoped_lock lock(cache.mutex);
+        const auto [first, last] = cache.entries.equal_range(networkHash);
+        for (auto it = first; it != last; ++it) { // Another thread may have computed the same network meanwhile
+            if (same_network(it->second, table.get(), offsets, terms)) {
+                return it->second.values;
+            }
+        }
+        // Drop values of tables which are no longer referenced outside the cache
+        detail::prune_table_cache(cache.entries, kMaxCachedNetworks);
+        cache.entries.emplace(networkHash, QValueCacheEntry{
+            std::move(table),
+            std::vector(offsets.begin(), offsets.end()),
+            std::vector(terms.begin(), terms.end()),
+            values
+        });
+        return values;
+    }
+}
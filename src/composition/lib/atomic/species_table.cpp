@@ -0,0 +1,238 @@
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/atomic/species.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+    /**
+     * Clears the mask of every row whose value lies outside [min, max]. Written without branches
+     * so that the compiler vectorises the loop.
+     */
+    template <typename T>
+    void apply_range(const std::span<const T> column, const T min, const T max, std::uint8_t* mask) noexcept {
+        const std::size_t n = column.size();
+        const T* values = column.data();
+        for (std::size_t i = 0; i < n; ++i) {
+            mask[i] &= static_cast<std::uint8_t>((values[i] >= min) & (values[i] <= max));
+        }
+    }
+
+    /**
+     * Integer columns hold exact values, so the bounds are rounded inwards and clamped to int32.
+     */
+    void apply_range(const std::span<const std::int32_t> column, const double min, const double max, std::uint8_t* mask) noexcept {
+        constexpr double lowest = std::numeric_limits<std::int32_t>::lowest();
+        constexpr double highest = std::numeric_limits<std::int32_t>::max();
+        const double lo = std::ceil(min);
+        const double hi = std::floor(max);
+        if (std::isnan(lo) || std::isnan(hi) || lo > hi || lo > highest || hi < lowest) {
+            std::fill_n(mask, column.size(), std::uint8_t{0});
+            return;
+        }
+        apply_range<std::int32_t>(
+            column,
+            static_cast<std::int32_t>(std::max(lo, lowest)),
+            static_cast<std::int32_t>(std::min(hi, highest)),
+            mask
+        );
+    }
+
+    std::atomic<std::shared_ptr<const fourdst::atomic::SpeciesTable>>& installed_table() noexcept {
+        static std::atomic<std::shared_ptr<const fourdst::atomic::SpeciesTable>> table;
+        return table;
+    }
+
+    bool za_less(const fourdst::atomic::Species& lhs, const fourdst::atomic::Species& rhs) noexcept {
+        return std::pair(lhs.z(), lhs.a()) < std::pair(rhs.z(), rhs.a());
+    }
+}
+
+namespace fourdst::atomic {
+    SpeciesTable::SpeciesTable(std::vector<Species> species) : m_species(std::move(species)) {
+        std::ranges::stable_sort(m_species, za_less);
+
+        const std::size_t n = m_species.size();
+        m_z.reserve(n);
+        m_n.reserve(n);
+        m_a.reserve(n);
+        m_mass.reserve(n);
+        m_massExcess.reserve(n);
+        m_massExcessUnc.reserve(n);
+        m_bindingEnergy.reserve(n);
+        m_halfLife.reserve(n);
+        m_betaDecayEnergy.reserve(n);
+        m_spin.reserve(n);
+        m_twoJ.reserve(n);
+        m_parity.reserve(n);
+        m_records.reserve(n);
+        m_nameIndex.reserve(n);
+        for (const auto& sp : m_species) {
+            m_z.push_back(sp.z());
+            m_n.push_back(sp.n());
+            m_a.push_back(sp.a());
+            m_mass.push_back(sp.mass());
+            m_massExcess.push_back((sp.mass() - sp.a()) * kAtomicMassUnitMeV);
+            m_massExcessUnc.push_back(sp.massUnc() * 1.0e-6 * kAtomicMassUnitMeV); // massUnc is in micro-u
+            m_bindingEnergy.push_back(sp.bindingEnergy());
+            m_halfLife.push_back(sp.halfLife());
+            m_betaDecayEnergy.push_back(sp.betaDecayEnergy());
+            m_spin.push_back(sp.spin());
+            m_twoJ.push_back(sp.twoJ());
+            m_parity.push_back(static_cast<std::int32_t>(sp.parity()));
+            m_nameIndex.emplace(sp.name(), static_cast<SpeciesId>(m_records.size()));
+            m_records.push_back({static_cast<SpeciesId>(m_records.size()), sp.z(), sp.n(), sp.a(), sp.mass(), sp.halfLife()});
+        }
+
+        // CSR index over the (Z, A) ordered rows; elements without isotopes get empty blocks
+        const std::int32_t maxZ = m_z.empty() ? -1 : std::max(m_z.back(), -1);
+        m_elementOffsets.resize(static_cast<std::size_t>(maxZ) + 2);
+        for (std::int32_t z = 0; z <= maxZ + 1; ++z) {
+            m_elementOffsets[z] = static_cast<std::uint32_t>(std::ranges::lower_bound(m_z, z) - m_z.begin());
+        }
+
+        // CSR table of decay channels, with daughters resolved to rows
+        m_decayOffsets.reserve(n + 1);
+        m_decayOffsets.push_back(0);
+        for (const auto& sp : m_species) {
+            for (const auto& [mode, ratio, daughterZ, daughterA] : parseDecayModes(sp.decayModes(), sp.z(), sp.a())) {
+                const SpeciesId daughter = daughterZ < 0 ? kNoSpecies : find(daughterZ, daughterA).value_or(kNoSpecies);
+                m_decayChannels.push_back({ratio, daughter, mode});
+            }
+            m_decayOffsets.push_back(static_cast<std::uint32_t>(m_decayChannels.size()));
+        }
+    }
+
+    const SpeciesTable& SpeciesTable::builtin() {
+        static const SpeciesTable table = [] {
+            std::vector<Species> all;
+            all.reserve(fourdst::atomic::species.size());
+            for (const auto& sp : fourdst::atomic::species | std::views::values) {
+                all.push_back(sp);
+            }
+            return SpeciesTable(std::move(all));
+        }();
+        return table;
+    }
+
+    void SpeciesTable::install(std::shared_ptr<const SpeciesTable> table) noexcept {
+        installed_table().store(std::move(table), std::memory_order_release);
+    }
+
+    std::shared_ptr<const SpeciesTable> SpeciesTable::installed() noexcept {
+        return installed_table().load(std::memory_order_acquire);
+    }
+
+    const Species& SpeciesTable::operator[](const SpeciesId id) const {
+        if (id >= m_species.size()) {
+            throw std::out_of_range("Species id " + std::to_string(id) + " is out of range for a table of " + std::to_string(m_species.size()) + " species.");
+        }
+        return m_species[id];
+    }
+
+    std::span<const DecayChannel> SpeciesTable::decayChannels(const SpeciesId id) const {
+        if (id >= m_species.size()) {
+            throw std::out_of_range("Species id " + std::to_string(id) + " is out of range for a table of " + std::to_string(m_species.size()) + " species.");
+        }
+        return std::span(m_decayChannels).subspan(m_decayOffsets[id], m_decayOffsets[id + 1] - m_decayOffsets[id]);
+    }
+
+    std::span<const SpeciesRecord> SpeciesTable::element(const int z) const noexcept {
+        if (z < 0 || static_cast<std::size_t>(z) + 1 >= m_elementOffsets.size()) {
+            return {};
+        }
+        const std::uint32_t begin = m_elementOffsets[z];
+        return std::span(m_records).subspan(begin, m_elementOffsets[z + 1] - begin);
+    }
+
+    std::optional<int> SpeciesTable::lightestA(const int z) const noexcept {
+        const auto isotopes = element(z);
+        if (isotopes.empty()) {
+            return std::nullopt;
+        }
+        return isotopes.front().a;
+    }
+
+    std::optional<int> SpeciesTable::heaviestA(const int z) const noexcept {
+        const auto isotopes = element(z);
+        if (isotopes.empty()) {
+            return std::nullopt;
+        }
+        return isotopes.back().a;
+    }
+
+    std::optional<SpeciesId> SpeciesTable::find(const int z, const int a) const noexcept {
+        const auto isotopes = element(z);
+        const auto it = std::ranges::lower_bound(isotopes, a, {}, &SpeciesRecord::a);
+        if (it == isotopes.end() || it->a != a) {
+            return std::nullopt;
+        }
+        return it->id;
+    }
+
+    std::optional<SpeciesId> SpeciesTable::find(const std::string_view name) const noexcept {
+        const auto it = m_nameIndex.find(name);
+        if (it == m_nameIndex.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::vector<SpeciesId> SpeciesTable::select(const std::span<const SpeciesPredicate> predicates) const {
+        std::vector<std::uint8_t> mask;
+        evaluate(predicates, mask);
+
+        std::vector<SpeciesId> ids;
+        ids.reserve(static_cast<std::size_t>(std::ranges::count(mask, std::uint8_t{1})));
+        for (std::size_t i = 0; i < mask.size(); ++i) {
+            if (mask[i] != 0) {
+                ids.push_back(static_cast<SpeciesId>(i));
+            }
+        }
+        return ids;
+    }
+
+    std::size_t SpeciesTable::count(const std::span<const SpeciesPredicate> predicates) const {
+        std::vector<std::uint8_t> mask;
+        evaluate(predicates, mask);
+        std::size_t total = 0;
+        for (const std::uint8_t m : mask) {
+            total += m;
+        }
+        return total;
+    }
+
+    std::vector<Species> SpeciesTable::species(const std::span<const SpeciesId> ids) const {
+        std::vector<Species> out;
+        out.reserve(ids.size());
+        for (const SpeciesId id : ids) {
+            out.push_back((*this)[id]);
+        }
+        return out;
+    }
+
+    void SpeciesTable::evaluate(const std::span<const SpeciesPredicate> predicates, std::vector<std::uint8_t> &mask) const {
+        mask.assign(m_species.size(), 1);
+        for (const auto& [column, min, max] : predicates) {
+            switch (column) {
+                case SpeciesColumn::Z: apply_range(z(), min, max, mask.data()); break;
+                case SpeciesColumn::N: apply_range(n(), min, max, mask.data()); break;
+                case SpeciesColumn::A: apply_range(a(), min, max, mask.data()); break;
+                case SpeciesColumn::MASS: apply_range(mass(), min, max, mask.data()); break;
+                case SpeciesColumn::MASS_EXCESS: apply_range(massExcess(), min, max, mask.data()); break;
+                case SpeciesColumn::BINDING_ENERGY: apply_range(bindingEnergy(), min, max, mask.data()); break;
+                case SpeciesColumn::HALF_LIFE: apply_range(halfLife(), min, max, mask.data()); break;
+                case SpeciesColumn::BETA_DECAY_ENERGY: apply_range(betaDecayEnergy(), min, max, mask.data()); break;
+                case SpeciesColumn::SPIN: apply_range(spin(), min, max, mask.data()); break;
+                case SpeciesColumn::TWO_J: apply_range(twoJ(), min, max, mask.data()); break;
+                case SpeciesColumn::PARITY: apply_range(parity(), min, max, mask.data()); break;
+            }
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "fourdst/atomic/species_table.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+
+// Eviction shared by the caches of values derived from a SpeciesTable (decay networks, reaction
+// Q-values). Entries are assumed to hold their table in a `std::shared_ptr<const SpeciesTable>
+// table` member; the builtin table is held without an owner count and is never evicted.
+namespace fourdst::atomic::detail {
+    /**
+     * @brief Removes the entries of every table which is referenced by nothing but the cache.
+     *
+     * @details Each entry holds its own reference, so a table is unreferenced outside the cache
+     * when its use count equals the number of entries holding it. If the cache still holds
+     * `maxEntries` or more entries afterwards it is cleared; values handed out earlier stay
+     * valid through their own shared pointers. Call with the cache's mutex held.
+     *
+     * @param[in,out] entries Map whose values have a `table` member.
+     * @param[in] maxEntries Bound on the number of entries left for the caller to insert into.
+     */
+    template <typename Map>
+    void prune_table_cache(Map& entries, const std::size_t maxEntries) {
+        std::unordered_map<const SpeciesTable*, long> holders;
+        for (const auto& entry : entries) {
+            if (entry.second.table.use_count() != 0) {
+                ++holders[entry.second.table.get()];
+            }
+        }
+        // Decide before erasing anything: every erased entry lowers the use count of its table
+        std::unordered_set<const SpeciesTable*> unreferenced;
+        for (const auto& entry : entries) {
+            const auto& table = entry.second.table;
+            if (table.use_count() != 0 && table.use_count() == holders.at(table.get())) {
+                unreferenced.insert(table.get());
+            }
+        }
+        std::erase_if(entries, [&](const auto& entry) { return unreferenced.contains(entry.second.table.get()); });
+        if (entries.size() >= maxEntries) {
+            entries.clear();
+        }
+    }
+}
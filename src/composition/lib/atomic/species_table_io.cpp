@@ -0,0 +1,387 @@
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/composition/io/mapped_file.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+
+#include "../io/binary_layout.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    using fourdst::atomic::Species;
+    using fourdst::composition::exceptions::CompositionIOError;
+    using namespace fourdst::composition::io::detail;
+
+    constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+    /**
+     * Iterates over the lines of a text buffer; `\r\n` line endings are accepted.
+     */
+    class LineReader {
+    public:
+        explicit LineReader(const std::span<const char> data) : m_text(data.data(), data.size()) {}
+
+        bool next(std::string_view& line) noexcept {
+            if (m_pos >= m_text.size()) {
+                return false;
+            }
+            std::size_t end = m_text.find('\n', m_pos);
+            if (end == std::string_view::npos) {
+                end = m_text.size();
+            }
+            line = m_text.substr(m_pos, end - m_pos);
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            m_pos = end + 1;
+            ++m_lineNumber;
+            return true;
+        }
+
+        [[nodiscard]] std::size_t line_number() const noexcept { return m_lineNumber; }
+
+    private:
+        std::string_view m_text;
+        std::size_t m_pos = 0;
+        std::size_t m_lineNumber = 0;
+    };
+
+    std::string_view trim(std::string_view s) noexcept {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+            s.remove_prefix(1);
+        }
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) {
+            s.remove_suffix(1);
+        }
+        return s;
+    }
+
+    /**
+     * Trimmed contents of the 0-based column range [begin, end) of a fixed-width line; lines
+     * shorter than `end` yield whatever part of the field they contain.
+     */
+    std::string_view field(const std::string_view line, const std::size_t begin, const std::size_t end) noexcept {
+        if (begin >= line.size()) {
+            return {};
+        }
+        return trim(line.substr(begin, std::min(end, line.size()) - begin));
+    }
+
+    std::optional<int> parse_int(const std::string_view token) noexcept {
+        int value = 0;
+        const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (ec != std::errc{} || ptr != token.data() + token.size() || token.empty()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    /**
+     * Parses a fixed-width real. Values derived from systematics are marked with `#`, either in
+     * place of the decimal point (AME) or appended to the value (NUBASE).
+     */
+    std::optional<double> parse_double(const std::string_view token) noexcept {
+        std::array<char, 32> buffer{};
+        if (token.empty() || token.size() > buffer.size()) {
+            return std::nullopt;
+        }
+        const bool hasPoint = token.find('.') != std::string_view::npos;
+        std::size_t n = 0;
+        for (const char c : token) {
+            if (c == '#') {
+                if (hasPoint) {
+                    continue;
+                }
+                buffer[n++] = '.';
+            } else {
+                buffer[n++] = c;
+            }
+        }
+        double value = 0.0;
+        const auto [ptr, ec] = std::from_chars(buffer.data(), buffer.data() + n, value);
+        if (ec != std::errc{} || ptr != buffer.data() + n) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    double half_life_unit(const std::string_view unit) noexcept {
+        static constexpr std::array<std::pair<std::string_view, double>, 19> units = {{
+            {"ys", 1e-24}, {"zs", 1e-21}, {"as", 1e-18}, {"fs", 1e-15},
+            {"ps", 1e-12}, {"ns", 1e-9}, {"us", 1e-6}, {"ms", 1e-3},
+            {"s", 1.0}, {"m", 60.0}, {"h", 3600.0}, {"d", 86400.0},
+            {"y", 3.15576e7}, {"ky", 3.15576e10}, {"My", 3.15576e13}, {"Gy", 3.15576e16},
+            {"Ty", 3.15576e19}, {"Py", 3.15576e22}, {"Ey", 3.15576e25}
+        }};
+        for (const auto& [name, factor] : units) {
+            if (name == unit) {
+                return factor;
+            }
+        }
+        return 0.0;
+    }
+
+    double parse_half_life(std::string_view value, const std::string_view unit) noexcept {
+        if (value == "stbl") {
+            return std::numeric_limits<double>::infinity();
+        }
+        // Limits ("<", ">") and approximations ("~") are kept at their bound
+        while (!value.empty() && (value.front() == '<' || value.front() == '>' || value.front() == '~')) {
+            value.remove_prefix(1);
+        }
+        const auto parsed = parse_double(value);
+        return parsed ? *parsed * half_life_unit(unit) : 0.0;
+    }
+
+    struct NubaseEntry {
+        double halfLife;
+        std::string_view spinParity;
+        std::string_view decayModes;
+    };
+
+    // NUBASE2020 columns (1-based, from the file header): A 1:3, ZZZi 5:8, half-life 70:78,
+    // unit 79:80, Jpi 89:102, decay modes 120:209
+    std::unordered_map<std::uint32_t, NubaseEntry> parse_nubase(const std::span<const char> nubase) {
+        std::unordered_map<std::uint32_t, NubaseEntry> entries;
+        LineReader reader(nubase);
+        std::string_view line;
+        bool inTable = false;
+        while (reader.next(line)) {
+            if (line.starts_with('#')) {
+                if (inTable) { // Some distributions append the table a second time in an older layout
+                    break;
+                }
+                continue;
+            }
+            if (trim(line).empty()) {
+                continue;
+            }
+            inTable = true;
+
+            const std::string_view zzzi = field(line, 4, 8);
+            const auto a = parse_int(field(line, 0, 3));
+            const auto z = zzzi.size() == 4 ? parse_int(zzzi.substr(0, 3)) : std::nullopt;
+            if (!a || !z) {
+                throw CompositionIOError("Malformed NUBASE line " + std::to_string(reader.line_number()) + ": " + std::string(line));
+            }
+            if (zzzi[3] != '0') { // Isomers, levels and resonances
+                continue;
+            }
+            entries.try_emplace(
+                fourdst::composition::utils::CompositionHash::pack_species_id(*z, *a),
+                NubaseEntry{
+                    parse_half_life(field(line, 69, 78), field(line, 78, 80)),
+                    field(line, 88, 102),
+                    field(line, 119, 209)
+                }
+            );
+        }
+        return entries;
+    }
+
+    // AME2020 mass_1.mas20 format: a1,i3,i5,i5,i5,1x,a3,a4,1x,f14.6,f12.6,f13.5,1x,f10.5,1x,a2,f13.5,f11.5,1x,i3,1x,f13.6,f12.6
+    std::vector<Species> parse_ame(const std::span<const char> ame, const std::unordered_map<std::uint32_t, NubaseEntry>& nubase) {
+        std::vector<Species> species;
+        LineReader reader(ame);
+        std::string_view line;
+        bool inTable = false;
+        while (reader.next(line)) {
+            if (!inTable) { // The table starts below the line of units which closes the header
+                inTable = line.find("micro-u") != std::string_view::npos;
+                continue;
+            }
+            if (trim(line).empty()) {
+                continue;
+            }
+
+            const auto nz = parse_int(field(line, 1, 4));
+            const auto n = parse_int(field(line, 4, 9));
+            const auto z = parse_int(field(line, 9, 14));
+            const auto a = parse_int(field(line, 14, 19));
+            const std::string_view el = field(line, 20, 23);
+            const auto bindingEnergy = parse_double(field(line, 54, 67));
+            const auto massInt = parse_int(field(line, 106, 109));
+            const auto massFrac = parse_double(field(line, 110, 123));
+            const auto massUnc = parse_double(field(line, 123, 135));
+            if (!nz || !n || !z || !a || el.empty() || !bindingEnergy || !massInt || !massFrac || !massUnc) {
+                throw CompositionIOError("Malformed AME line " + std::to_string(reader.line_number()) + ": " + std::string(line));
+            }
+            // "*" marks beta decay energies which cannot be calculated
+            const double betaDecayEnergy = parse_double(field(line, 81, 94)).value_or(kNaN);
+
+            NubaseEntry properties{kNaN, {}, {}};
+            if (const auto it = nubase.find(fourdst::composition::utils::CompositionHash::pack_species_id(*z, *a)); it != nubase.end()) {
+                properties = it->second;
+            }
+
+            species.emplace_back(
+                std::string(el) + "-" + std::to_string(*a), el,
+                *nz, *n, *z, *a,
+                *bindingEnergy, field(line, 79, 81), betaDecayEnergy,
+                properties.halfLife, properties.spinParity, properties.decayModes,
+                *massInt + *massFrac / 1e6, *massUnc
+            );
+        }
+        return species;
+    }
+
+    // Cache layout: header, int32 columns (nz, n, z, a), padding to 8, double columns (binding
+    // energy, beta decay energy, half-life, atomic mass, atomic mass uncertainty), then per row the
+    // element symbol, beta code, spin-parity and decay modes, each as a uint16 length and its bytes.
+    struct CacheHeader {
+        std::uint32_t magic;
+        std::uint16_t version;
+        std::uint16_t reserved;
+        std::uint64_t rowCount;
+        std::uint64_t stringBytes;
+        std::uint64_t reserved2;
+    };
+    static_assert(sizeof(CacheHeader) == 32);
+
+    constexpr std::size_t kIntColumns = 4;
+    constexpr std::size_t kDoubleColumns = 5;
+    constexpr std::size_t kStringsPerRow = 4;
+
+    std::size_t double_offset(const std::size_t rows) noexcept {
+        return align_up(sizeof(CacheHeader) + kIntColumns * rows * sizeof(std::int32_t), sizeof(double));
+    }
+
+    std::size_t string_offset(const std::size_t rows) noexcept {
+        return double_offset(rows) + kDoubleColumns * rows * sizeof(double);
+    }
+}
+
+namespace fourdst::atomic {
+    SpeciesTable SpeciesTable::fromNuclearData(const std::span<const char> ame, const std::span<const char> nubase) {
+        return SpeciesTable(parse_ame(ame, parse_nubase(nubase)));
+    }
+
+    SpeciesTable SpeciesTable::load(const std::filesystem::path &ame, const std::filesystem::path &nubase) {
+        const composition::io::MappedFile ameFile(ame);
+        const composition::io::MappedFile nubaseFile(nubase);
+        return fromNuclearData(ameFile.chars(), nubaseFile.chars());
+    }
+
+    std::vector<std::byte> SpeciesTable::toCache() const {
+        const std::size_t rows = m_species.size();
+        std::size_t stringBytes = 0;
+        for (const auto& sp : m_species) {
+            for (const std::string_view s : {sp.el(), sp.betaCode(), sp.spinParity(), sp.decayModes()}) {
+                if (s.size() > std::numeric_limits<std::uint16_t>::max()) {
+                    throw composition::exceptions::CompositionIOError("Species " + std::string(sp.name()) + " has a field too long for the species table cache.");
+                }
+                stringBytes += sizeof(std::uint16_t) + s.size();
+            }
+        }
+
+        std::vector<std::byte> cache(string_offset(rows) + stringBytes);
+        std::byte* out = cache.data();
+        store_le<std::uint32_t>(out + offsetof(CacheHeader, magic), kSpeciesTableCacheMagic);
+        store_le<std::uint16_t>(out + offsetof(CacheHeader, version), kSpeciesTableCacheVersion);
+        store_le<std::uint64_t>(out + offsetof(CacheHeader, rowCount), rows);
+        store_le<std::uint64_t>(out + offsetof(CacheHeader, stringBytes), stringBytes);
+
+        std::byte* ints = out + sizeof(CacheHeader);
+        std::byte* doubles = out + double_offset(rows);
+        std::byte* strings = out + string_offset(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            const Species& sp = m_species[i];
+            const std::array<std::int32_t, kIntColumns> intValues = {sp.nz(), sp.n(), sp.z(), sp.a()};
+            for (std::size_t c = 0; c < kIntColumns; ++c) {
+                store_le<std::int32_t>(ints + (c * rows + i) * sizeof(std::int32_t), intValues[c]);
+            }
+            const std::array<double, kDoubleColumns> doubleValues = {sp.bindingEnergy(), sp.betaDecayEnergy(), sp.halfLife(), sp.mass(), sp.massUnc()};
+            for (std::size_t c = 0; c < kDoubleColumns; ++c) {
+                store_le<double>(doubles + (c * rows + i) * sizeof(double), doubleValues[c]);
+            }
+            for (const std::string_view s : {sp.el(), sp.betaCode(), sp.spinParity(), sp.decayModes()}) {
+                store_le<std::uint16_t>(strings, static_cast<std::uint16_t>(s.size()));
+                std::memcpy(strings + sizeof(std::uint16_t), s.data(), s.size());
+                strings += sizeof(std::uint16_t) + s.size();
+            }
+        }
+        return cache;
+    }
+
+    SpeciesTable SpeciesTable::fromCache(const std::span<const std::byte> cache) {
+        using composition::exceptions::CompositionIOError;
+        if (cache.size() < sizeof(CacheHeader)) {
+            throw CompositionIOError("Species table cache of " + std::to_string(cache.size()) + " bytes is too small to hold its header.");
+        }
+        const std::byte* data = cache.data();
+        if (load_le<std::uint32_t>(data + offsetof(CacheHeader, magic)) != kSpeciesTableCacheMagic) {
+            throw CompositionIOError("Buffer does not contain a species table cache (bad magic number).");
+        }
+        if (const auto version = load_le<std::uint16_t>(data + offsetof(CacheHeader, version)); version != kSpeciesTableCacheVersion) {
+            throw CompositionIOError("Unsupported species table cache version " + std::to_string(version) + ".");
+        }
+        const auto rows = load_le<std::uint64_t>(data + offsetof(CacheHeader, rowCount));
+        const auto stringBytes = load_le<std::uint64_t>(data + offsetof(CacheHeader, stringBytes));
+        // Bound both counts by the buffer first so that the size computation cannot overflow
+        if (rows > cache.size() / sizeof(double) || stringBytes > cache.size() || string_offset(rows) + stringBytes != cache.size()) {
+            throw CompositionIOError("Species table cache of " + std::to_string(cache.size()) + " bytes does not match its header.");
+        }
+
+        const std::byte* ints = data + sizeof(CacheHeader);
+        const std::byte* doubles = data + double_offset(rows);
+        const std::byte* strings = data + string_offset(rows);
+        const std::byte* end = data + cache.size();
+        const auto column_int = [&](const std::size_t c, const std::size_t i) { return load_le<std::int32_t>(ints + (c * rows + i) * sizeof(std::int32_t)); };
+        const auto column_double = [&](const std::size_t c, const std::size_t i) { return load_le<double>(doubles + (c * rows + i) * sizeof(double)); };
+        const auto next_string = [&]() {
+            if (end - strings < static_cast<std::ptrdiff_t>(sizeof(std::uint16_t))) {
+                throw CompositionIOError("Species table cache ends inside its string table.");
+            }
+            const auto length = load_le<std::uint16_t>(strings);
+            strings += sizeof(std::uint16_t);
+            if (end - strings < length) {
+                throw CompositionIOError("Species table cache ends inside its string table.");
+            }
+            const std::string_view s(reinterpret_cast<const char*>(strings), length);
+            strings += length;
+            return s;
+        };
+
+        std::vector<Species> species;
+        species.reserve(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            const std::string_view el = next_string();
+            const std::string_view betaCode = next_string();
+            const std::string_view spinParity = next_string();
+            const std::string_view decayModes = next_string();
+            const int a = column_int(3, i);
+            species.emplace_back(
+                std::string(el) + "-" + std::to_string(a), el,
+                column_int(0, i), column_int(1, i), column_int(2, i), a,
+                column_double(0, i), betaCode, column_double(1, i),
+                column_double(2, i), spinParity, decayModes,
+                column_double(3, i), column_double(4, i)
+            );
+        }
+        return SpeciesTable(std::move(species));
+    }
+
+    SpeciesTable SpeciesTable::loadCache(const std::filesystem::path &path) {
+        const composition::io::MappedFile file(path);
+        return fromCache(file.bytes());
+    }
+
+    void SpeciesTable::writeCache(const std::filesystem::path &path) const {
+        const std::vector<std::byte> cache = toCache();
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(cache.data()), static_cast<std::streamsize>(cache.size()));
+        if (!out) {
+            throw composition::exceptions::CompositionIOError("Unable to write species table cache " + path.string() + ".");
+        }
+    }
+}
@@ -0,0 +1,239 @@
+#include "fourdst/composition/c/composition_c.h"
+#include "fourdst/composition/utils/utils.h"
+#include "fourdst/atomic/atomicSpecies.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * Species schema of a C handle, in the caller's order, with the per-species constants the
+ * kernels need stored as contiguous doubles.
+ */
+struct fdst_composition {
+    std::vector<fourdst::atomic::Species> species;
+    std::vector<double> mass;
+    std::vector<double> z;
+    std::vector<double> a;
+    const double* bound = nullptr; ///< Caller-owned abundances, not owned.
+};
+
+namespace {
+    thread_local std::string lastError;
+
+    int fail(const int status, std::string message) noexcept {
+        try {
+            lastError = std::move(message);
+        } catch (...) {
+            lastError.clear();
+        }
+        return status;
+    }
+
+    int ok() noexcept {
+        return FDST_COMPOSITION_OK;
+    }
+
+    int fail_current_exception() noexcept {
+        try {
+            throw;
+        } catch (const std::bad_alloc&) {
+            return fail(FDST_COMPOSITION_ERROR, "Out of memory.");
+        } catch (const std::exception& e) {
+            return fail(FDST_COMPOSITION_ERROR, e.what());
+        } catch (...) {
+            return fail(FDST_COMPOSITION_ERROR, "Unknown error.");
+        }
+    }
+
+    int require_bound(const fdst_composition* comp) noexcept {
+        if (!comp) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "Composition handle is NULL.");
+        }
+        if (!comp->bound && !comp->species.empty()) {
+            return fail(FDST_COMPOSITION_NOT_BOUND, "No abundance array is bound to the composition handle.");
+        }
+        return FDST_COMPOSITION_OK;
+    }
+
+    // All sums in one pass over the zone
+    fdst_composition_moments zone_moments(const fdst_composition& comp, const double* y) noexcept {
+        double sumY = 0.0;
+        double sumYM = 0.0;
+        double sumYZ = 0.0;
+        double sumYA = 0.0;
+        double sumYZ2 = 0.0;
+        const std::size_t n = comp.species.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            const double yi = y[i];
+            const double zi = comp.z[i];
+            sumY += yi;
+            sumYM += yi * comp.mass[i];
+            sumYZ += yi * zi;
+            sumYA += yi * comp.a[i];
+            sumYZ2 += yi * zi * zi;
+        }
+        return {
+            sumY,
+            sumYM / sumY,
+            sumYZ,
+            sumYA / sumY,
+            sumYZ / sumY,
+            sumYZ2 / sumY
+        };
+    }
+
+    void zone_mass_fractions(const fdst_composition& comp, const double* y, double* x) noexcept {
+        const std::size_t n = comp.species.size();
+        double totalMass = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            totalMass += y[i] * comp.mass[i];
+        }
+        const double inverseTotal = 1.0 / totalMass;
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = y[i] * comp.mass[i] * inverseTotal;
+        }
+    }
+}
+
+extern "C" {
+    int fdst_composition_create(const int32_t* z, const int32_t* a, const size_t n_species, fdst_composition** out) {
+        if (!out || (n_species > 0 && (!z || !a))) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_create needs non-NULL z, a and out.");
+        }
+        *out = nullptr;
+        try {
+            auto comp = std::make_unique<fdst_composition>();
+            comp->species.reserve(n_species);
+            comp->mass.reserve(n_species);
+            comp->z.reserve(n_species);
+            comp->a.reserve(n_species);
+            for (std::size_t i = 0; i < n_species; ++i) {
+                auto species = fourdst::composition::getSpecies(z[i], a[i]);
+                if (!species) {
+                    return fail(
+                        FDST_COMPOSITION_UNKNOWN_SPECIES,
+                        "Species " + std::to_string(i) + " (Z=" + std::to_string(z[i]) + ", A=" + std::to_string(a[i]) + ") is not in the species database."
+                    );
+                }
+                comp->mass.push_back(species->mass());
+                comp->z.push_back(static_cast<double>(species->z()));
+                comp->a.push_back(static_cast<double>(species->a()));
+                comp->species.push_back(std::move(*species));
+            }
+            *out = comp.release();
+            return ok();
+        } catch (...) {
+            return fail_current_exception();
+        }
+    }
+
+    void fdst_composition_destroy(fdst_composition* comp) {
+        delete comp;
+    }
+
+    size_t fdst_composition_species_count(const fdst_composition* comp) {
+        return comp ? comp->species.size() : 0;
+    }
+
+    int fdst_composition_species_masses(const fdst_composition* comp, double* masses) {
+        if (!comp || !masses) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_species_masses needs a handle and an output buffer.");
+        }
+        std::ranges::copy(comp->mass, masses);
+        return ok();
+    }
+
+    int fdst_composition_species_name(const fdst_composition* comp, const size_t index, char* buffer, const size_t buffer_size) {
+        if (!comp || !buffer || index >= comp->species.size()) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_species_name needs a handle, a valid index and an output buffer.");
+        }
+        const std::string_view name = comp->species[index].name();
+        if (buffer_size <= name.size()) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "Buffer of " + std::to_string(buffer_size) + " bytes is too small for species name " + std::string(name) + ".");
+        }
+        std::memcpy(buffer, name.data(), name.size());
+        buffer[name.size()] = '\0';
+        return ok();
+    }
+
+    int fdst_composition_bind(fdst_composition* comp, const double* y) {
+        if (!comp) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "Composition handle is NULL.");
+        }
+        comp->bound = y;
+        return ok();
+    }
+
+    int fdst_composition_get_moments(const fdst_composition* comp, fdst_composition_moments* out) {
+        if (const int status = require_bound(comp); status != FDST_COMPOSITION_OK) {
+            return status;
+        }
+        if (!out) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_get_moments needs an output struct.");
+        }
+        *out = zone_moments(*comp, comp->bound);
+        return ok();
+    }
+
+    int fdst_composition_get_mass_fractions(const fdst_composition* comp, double* x) {
+        if (const int status = require_bound(comp); status != FDST_COMPOSITION_OK) {
+            return status;
+        }
+        if (!x) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_get_mass_fractions needs an output buffer.");
+        }
+        zone_mass_fractions(*comp, comp->bound, x);
+        return ok();
+    }
+
+    int fdst_composition_get_number_fractions(const fdst_composition* comp, double* x) {
+        if (const int status = require_bound(comp); status != FDST_COMPOSITION_OK) {
+            return status;
+        }
+        if (!x) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_get_number_fractions needs an output buffer.");
+        }
+        const std::size_t n = comp->species.size();
+        double totalMoles = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            totalMoles += comp->bound[i];
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = comp->bound[i] / totalMoles;
+        }
+        return ok();
+    }
+
+    int fdst_composition_moments_batch(
+        const fdst_composition* comp, const double* y, const size_t n_zones, const size_t zone_stride, fdst_composition_moments* out
+    ) {
+        if (!comp || (n_zones > 0 && (!y || !out)) || zone_stride < comp->species.size()) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_moments_batch needs a handle, buffers and a zone stride of at least the species count.");
+        }
+        for (std::size_t k = 0; k < n_zones; ++k) {
+            out[k] = zone_moments(*comp, y + k * zone_stride);
+        }
+        return ok();
+    }
+
+    int fdst_composition_mass_fractions_batch(
+        const fdst_composition* comp, const double* y, const size_t n_zones, const size_t zone_stride, double* x
+    ) {
+        if (!comp || (n_zones > 0 && (!y || !x)) || zone_stride < comp->species.size()) {
+            return fail(FDST_COMPOSITION_INVALID_ARGUMENT, "fdst_composition_mass_fractions_batch needs a handle, buffers and a zone stride of at least the species count.");
+        }
+        for (std::size_t k = 0; k < n_zones; ++k) {
+            zone_mass_fractions(*comp, y + k * zone_stride, x + k * zone_stride);
+        }
+        return ok();
+    }
+
+    const char* fdst_composition_last_error(void) {
+        return lastError.c_str();
+    }
+}
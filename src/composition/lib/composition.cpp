@@ -27,6 +27,7 @@
 #include <algorithm>
 #include <set>
 #include <string>
+#include <string_view>
 
 
 #include <utility>
@@ -38,14 +39,15 @@
 #include <numeric>
 
 #include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/utils/composition_format.h"
 #include "../include/fourdst/composition/utils/utils.h"
 
 #include "fourdst/composition/exceptions/exceptions_composition.h"
 
 namespace {
-    void throw_unknown_symbol(quill::Logger* logger, const std::string& symbol) {
+    [[noreturn]] void throw_unknown_symbol(quill::Logger* logger, const std::string_view symbol) {
         LOG_ERROR(logger, "Symbol {} is not a valid species symbol (not in the species database)", symbol);
-        throw fourdst::composition::exceptions::UnknownSymbolError("Symbol " + symbol + " is not a valid species symbol (not in the species database)");
+        throw fourdst::composition::exceptions::UnknownSymbolError("Symbol " + std::string(symbol) + " is not a valid species symbol (not in the species database)");
     }
 
     void throw_unregistered_symbol(quill::Logger* logger, const std::string& symbol) {
@@ -232,14 +234,14 @@ namespace fourdst::composition {
     //------------------------------------------
 
     void Composition::registerSymbol(
-        const std::string& symbol
+        const std::string_view symbol
     ) {
-        const auto result = getSpecies(symbol);
-        if (!result) {
+        const auto species = findSpecies(symbol);
+        if (!species) {
             throw_unknown_symbol(getLogger(), symbol);
         }
 
-        registerSpecies(result.value());
+        registerSpecies(*species);
     }
 
     void Composition::registerSymbol(
@@ -319,15 +321,15 @@ namespace fourdst::composition {
     //------------------------------------------
 
     void Composition::setMolarAbundance(
-        const std::string &symbol,
+        const std::string_view symbol,
         const double &molar_abundance
     ) {
-        const auto species = getSpecies(symbol);
+        const auto species = findSpecies(symbol);
         if (__builtin_expect(!species, 0)) {
             throw_unknown_symbol(getLogger(), symbol);
         }
 
-        setMolarAbundance(species.value(), molar_abundance);
+        setMolarAbundance(*species, molar_abundance);
     }
 
     void Composition::setMolarAbundance(
@@ -429,12 +431,12 @@ namespace fourdst::composition {
     // Fraction and abundance getters
     //------------------------------------------
 
-    double Composition::getMassFraction(const std::string& symbol) const {
-        const auto species = getSpecies(symbol);
+    double Composition::getMassFraction(const std::string_view symbol) const {
+        const auto species = findSpecies(symbol);
         if (!species) {
             throw_unknown_symbol(getLogger(), symbol);
         }
-        return getMassFraction(species.value());
+        return getMassFraction(*species);
     }
 
     double Composition::getMassFraction(
@@ -467,13 +469,13 @@ namespace fourdst::composition {
 
 
     double Composition::getNumberFraction(
-        const std::string& symbol
+        const std::string_view symbol
     ) const {
-        const auto species = getSpecies(symbol);
+        const auto species = findSpecies(symbol);
         if (!species) {
             throw_unknown_symbol(getLogger(), symbol);
         }
-        return getNumberFraction(species.value());
+        return getNumberFraction(*species);
     }
 
     double Composition::getNumberFraction(
@@ -502,13 +504,13 @@ namespace fourdst::composition {
     }
 
     double Composition::getMolarAbundance(
-        const std::string &symbol
+        const std::string_view symbol
     ) const {
-        const auto species = getSpecies(symbol);
+        const auto species = findSpecies(symbol);
         if (!species) {
             throw_unknown_symbol(getLogger(), symbol);
         }
-        return getMolarAbundance(species.value());
+        return getMolarAbundance(*species);
 
     }
 
@@ -637,14 +639,14 @@ namespace fourdst::composition {
     //------------------------------------------
 
     size_t Composition::getSpeciesIndex(
-        const std::string &symbol
+        const std::string_view symbol
     ) const {
-        const auto species = getSpecies(symbol);
+        const auto species = findSpecies(symbol);
         if (!species) {
             throw_unknown_symbol(getLogger(), symbol);
         }
 
-        return getSpeciesIndex(species.value());
+        return getSpeciesIndex(*species);
     }
 
     size_t Composition::getSpeciesIndex(
@@ -697,13 +699,13 @@ namespace fourdst::composition {
     }
 
     bool Composition::contains(
-        const std::string &symbol
+        const std::string_view symbol
     ) const {
-        const auto species = getSpecies(symbol);
+        const auto species = findSpecies(symbol);
         if (!species) {
             throw_unknown_symbol(getLogger(), symbol);
         }
-        return contains(species.value());
+        return contains(*species);
     }
 
     size_t Composition::size() const noexcept {
@@ -728,11 +730,11 @@ namespace fourdst::composition {
 
 
         for (const auto& symbol : symbols) {
-            const auto speciesResult = getSpecies(symbol);
+            const auto speciesResult = findSpecies(symbol);
             if (!speciesResult) {
                 throw_unknown_symbol(getLogger(), symbol);
             }
-            species.push_back(speciesResult.value());
+            species.push_back(*speciesResult);
         }
 
         return species;
@@ -747,16 +749,14 @@ namespace fourdst::composition {
         std::ostream& os,
         const Composition& composition
     ) {
-        os << "Composition(Mass Fractions => [";
-        size_t count = 0;
-        for (const auto &species : composition.m_species) {
-            os << species << ": " << composition.getMassFraction(species);
-            if (count < composition.size() - 1) {
-                os << ", ";
-            }
-            count++;
-        }
-        os << "])";
+        utils::CompositionFormatSpec spec;
+        spec.precision = static_cast<int>(std::min<std::streamsize>(os.precision(), utils::kMaxFormatPrecision));
+        switch (os.flags() & std::ios_base::floatfield) {
+            case std::ios_base::fixed: spec.style = std::chars_format::fixed; break;
+            case std::ios_base::scientific: spec.style = std::chars_format::scientific; break;
+            default: break;
+        }
+        os << utils::format_composition(composition, spec);
         return os;
     }
 
@@ -0,0 +1,267 @@
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/utils/utils.h"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    fourdst::composition::SpeciesHandle lookup_symbol(const std::string_view symbol) {
+        auto species = fourdst::composition::findSpecies(symbol);
+        if (!species) {
+            throw fourdst::composition::exceptions::UnknownSymbolError("Symbol " + std::string(symbol) + " is not a valid species symbol (not in the species database)");
+        }
+        return species;
+    }
+
+    void check_schema(const std::shared_ptr<const std::vector<fourdst::atomic::Species>>& species, const size_t abundanceCount) {
+        if (species == nullptr) {
+            throw fourdst::composition::exceptions::InvalidCompositionError("CompositionView requires a species schema, got nullptr.");
+        }
+        if (species->size() != abundanceCount) {
+            throw fourdst::composition::exceptions::InvalidCompositionError(
+                "The number of species and molar abundances must be equal. Got " +
+                std::to_string(species->size()) + " species and " +
+                std::to_string(abundanceCount) + " molar abundances."
+            );
+        }
+    }
+}
+
+namespace fourdst::composition {
+    CompositionView::CompositionView(
+        std::shared_ptr<const std::vector<atomic::Species>> species,
+        const std::span<const double> molarAbundances
+    ) :
+    m_species(std::move(species)),
+    m_abundances(molarAbundances) {
+        check_schema(m_species, m_abundances.size());
+    }
+
+    CompositionView::CompositionView(
+        std::shared_ptr<const std::vector<atomic::Species>> species,
+        std::vector<double> molarAbundances
+    ) :
+    m_species(std::move(species)),
+    m_owned(std::move(molarAbundances)) {
+        check_schema(m_species, m_owned.size());
+        m_abundances = m_owned;
+    }
+
+    CompositionView::CompositionView(const CompositionView &other) :
+    m_species(other.m_species),
+    m_abundances(other.m_abundances),
+    m_owned(other.m_owned) {
+        if (!m_owned.empty()) { // Rebind to our own copy rather than the source view's storage
+            m_abundances = m_owned;
+        }
+    }
+
+    CompositionView & CompositionView::operator=(const CompositionView &other) {
+        if (this != &other) {
+            m_species = other.m_species;
+            m_owned = other.m_owned;
+            m_abundances = m_owned.empty() ? other.m_abundances : std::span<const double>(m_owned);
+        }
+        return *this;
+    }
+
+    // Moving a std::vector keeps its buffer, so a span into m_owned stays valid after the move.
+    CompositionView::CompositionView(CompositionView &&other) noexcept :
+    m_species(std::move(other.m_species)),
+    m_abundances(std::exchange(other.m_abundances, {})),
+    m_owned(std::move(other.m_owned)) {}
+
+    CompositionView & CompositionView::operator=(CompositionView &&other) noexcept {
+        if (this != &other) {
+            m_species = std::move(other.m_species);
+            m_abundances = std::exchange(other.m_abundances, {});
+            m_owned = std::move(other.m_owned);
+        }
+        return *this;
+    }
+
+    bool CompositionView::contains(const atomic::Species &species) const noexcept {
+        return std::ranges::binary_search(*m_species, species);
+    }
+
+    bool CompositionView::contains(const std::string_view symbol) const {
+        return contains(*lookup_symbol(symbol));
+    }
+
+    size_t CompositionView::size() const noexcept {
+        return m_species->size();
+    }
+
+    std::set<std::string> CompositionView::getRegisteredSymbols() const noexcept {
+        std::set<std::string> symbols;
+        for (const auto& species : *m_species) {
+            symbols.insert(std::string(species.name()));
+        }
+        return symbols;
+    }
+
+    const std::vector<atomic::Species> & CompositionView::getRegisteredSpecies() const noexcept {
+        return *m_species;
+    }
+
+    std::unordered_map<atomic::Species, double> CompositionView::getMassFraction() const noexcept {
+        const double total = totalMass();
+        std::unordered_map<atomic::Species, double> massFractions;
+        massFractions.reserve(m_species->size());
+        for (size_t i = 0; i < m_species->size(); ++i) {
+            massFractions.emplace((*m_species)[i], m_abundances[i] * (*m_species)[i].mass() / total);
+        }
+        return massFractions;
+    }
+
+    std::unordered_map<atomic::Species, double> CompositionView::getNumberFraction() const noexcept {
+        const double total = totalMoles();
+        std::unordered_map<atomic::Species, double> numberFractions;
+        numberFractions.reserve(m_species->size());
+        for (size_t i = 0; i < m_species->size(); ++i) {
+            numberFractions.emplace((*m_species)[i], m_abundances[i] / total);
+        }
+        return numberFractions;
+    }
+
+    double CompositionView::getMassFraction(const std::string_view symbol) const {
+        return getMassFraction(*lookup_symbol(symbol));
+    }
+
+    double CompositionView::getMassFraction(const atomic::Species &species) const {
+        const size_t index = findSpeciesIndex(species);
+        return m_abundances[index] * species.mass() / totalMass();
+    }
+
+    double CompositionView::getNumberFraction(const std::string_view symbol) const {
+        return getNumberFraction(*lookup_symbol(symbol));
+    }
+
+    double CompositionView::getNumberFraction(const atomic::Species &species) const {
+        const size_t index = findSpeciesIndex(species);
+        return m_abundances[index] / totalMoles();
+    }
+
+    double CompositionView::getMolarAbundance(const std::string_view symbol) const {
+        return getMolarAbundance(*lookup_symbol(symbol));
+    }
+
+    double CompositionView::getMolarAbundance(const atomic::Species &species) const {
+        return m_abundances[findSpeciesIndex(species)];
+    }
+
+    double CompositionView::getMeanParticleMass() const noexcept {
+        return totalMass() / totalMoles();
+    }
+
+    double CompositionView::getElectronAbundance() const noexcept {
+        double Ye = 0.0;
+        for (size_t i = 0; i < m_species->size(); ++i) {
+            Ye += (*m_species)[i].z() * m_abundances[i];
+        }
+        return Ye;
+    }
+
+    std::vector<double> CompositionView::getMassFractionVector() const noexcept {
+        const double total = totalMass();
+        std::vector<double> massFractions(m_species->size());
+        for (size_t i = 0; i < m_species->size(); ++i) {
+            massFractions[i] = m_abundances[i] * (*m_species)[i].mass() / total;
+        }
+        return massFractions;
+    }
+
+    std::vector<double> CompositionView::getNumberFractionVector() const noexcept {
+        const double total = totalMoles();
+        std::vector<double> numberFractions(m_species->size());
+        for (size_t i = 0; i < m_species->size(); ++i) {
+            numberFractions[i] = m_abundances[i] / total;
+        }
+        return numberFractions;
+    }
+
+    std::vector<double> CompositionView::getMolarAbundanceVector() const noexcept {
+        return {m_abundances.begin(), m_abundances.end()};
+    }
+
+    size_t CompositionView::getSpeciesIndex(const std::string_view symbol) const {
+        return findSpeciesIndex(*lookup_symbol(symbol));
+    }
+
+    size_t CompositionView::getSpeciesIndex(const atomic::Species &species) const {
+        return findSpeciesIndex(species);
+    }
+
+    atomic::Species CompositionView::getSpeciesAtIndex(const size_t index) const {
+        if (index >= m_species->size()) {
+            throw std::out_of_range("Index " + std::to_string(index) + " is out of bounds for composition view of size " + std::to_string(m_species->size()) + ".");
+        }
+        return (*m_species)[index];
+    }
+
+    std::unique_ptr<CompositionAbstract> CompositionView::clone() const {
+        return std::make_unique<CompositionView>(*this);
+    }
+
+    CompositionView::iterator CompositionView::begin() {
+        detach();
+        return {m_species->data(), m_owned.data()};
+    }
+
+    CompositionView::iterator CompositionView::end() {
+        detach();
+        return {m_species->data() + m_species->size(), m_owned.data() + m_owned.size()};
+    }
+
+    CompositionView::const_iterator CompositionView::begin() const {
+        return {m_species->data(), m_abundances.data()};
+    }
+
+    CompositionView::const_iterator CompositionView::end() const {
+        return {m_species->data() + m_species->size(), m_abundances.data() + m_abundances.size()};
+    }
+
+    std::size_t CompositionView::hash() const {
+        return utils::CompositionHash::hash_exact<CompositionView>(*this);
+    }
+
+    size_t CompositionView::findSpeciesIndex(const atomic::Species &species) const {
+        const auto it = std::ranges::lower_bound(*m_species, species);
+        if (it == m_species->end() || *it != species) {
+            throw exceptions::UnregisteredSymbolError("Species '" + std::string(species.name()) + "' is not registered in the composition view.");
+        }
+        return static_cast<size_t>(std::distance(m_species->begin(), it));
+    }
+
+    double CompositionView::totalMass() const noexcept {
+        double total = 0.0;
+        for (size_t i = 0; i < m_species->size(); ++i) {
+            total += m_abundances[i] * (*m_species)[i].mass();
+        }
+        return total;
+    }
+
+    double CompositionView::totalMoles() const noexcept {
+        double total = 0.0;
+        for (const double y : m_abundances) {
+            total += y;
+        }
+        return total;
+    }
+
+    void CompositionView::detach() {
+        if (m_owned.empty() && !m_abundances.empty()) {
+            m_owned.assign(m_abundances.begin(), m_abundances.end());
+            m_abundances = m_owned;
+        }
+    }
+}
@@ -1,16 +1,27 @@
 #include "fourdst/composition/decorators/composition_masked.h"
 #include "fourdst/composition/exceptions/exceptions_composition.h"
-#include "fourdst/atomic/species.h"
+#include "fourdst/composition/utils/utils.h"
 
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 #include <unordered_map>
 
 #include "fourdst/composition/utils/composition_hash.h"
 
+namespace {
+    fourdst::composition::SpeciesHandle lookup_symbol(const std::string_view symbol) {
+        auto species = fourdst::composition::findSpecies(symbol);
+        if (!species) {
+            throw fourdst::composition::exceptions::UnknownSymbolError("Cannot find species '" + std::string(symbol) + "' in base composition");
+        }
+        return species;
+    }
+}
+
 namespace fourdst::composition {
     MaskedComposition::MaskedComposition(
         const CompositionAbstract& baseComposition,
@@ -35,15 +46,11 @@ namespace fourdst::composition {
     }
 
     bool MaskedComposition::contains(const atomic::Species &species) const noexcept{
-        return std::ranges::contains(m_activeSpecies, species);
+        return std::ranges::binary_search(m_activeSpecies, species); // Sorted in the constructor
     }
 
-    bool MaskedComposition::contains(const std::string &symbol) const {
-        if (!atomic::species.contains(symbol)) {
-            throw exceptions::UnknownSymbolError("Cannot find species '" + symbol + "' in base composition");
-        }
-        const atomic::Species& species = atomic::species.at(symbol);
-        return contains(species);
+    bool MaskedComposition::contains(const std::string_view symbol) const {
+        return contains(*lookup_symbol(symbol));
     }
 
     const std::vector<atomic::Species>& MaskedComposition::getRegisteredSpecies() const noexcept {
@@ -86,13 +93,8 @@ namespace fourdst::composition {
         return numberFractions;
     }
 
-    double MaskedComposition::getMassFraction(const std::string &symbol) const  {
-        if (!contains(symbol)) {
-            throw exceptions::UnregisteredSymbolError("Species '" + symbol + "' is not part of the active species in the MaskedComposition.");
-        }
-        if (CompositionDecorator::contains(symbol)) {
-            return CompositionDecorator::getMassFraction(symbol);
-        } return 0.0;
+    double MaskedComposition::getMassFraction(const std::string_view symbol) const {
+        return getMassFraction(*lookup_symbol(symbol));
     }
     double MaskedComposition::getMassFraction(const atomic::Species &species) const {
         if (!contains(species)) {
@@ -102,13 +104,8 @@ namespace fourdst::composition {
             return CompositionDecorator::getMassFraction(species);
         } return 0.0;
     }
-    double MaskedComposition::getNumberFraction(const std::string &symbol) const {
-        if (!contains(symbol)) {
-            throw exceptions::UnregisteredSymbolError("Species '" + symbol + "' is not part of the active species in the MaskedComposition.");
-        }
-        if (CompositionDecorator::contains(symbol)) {
-            return CompositionDecorator::getNumberFraction(symbol);
-        } return 0.0;
+    double MaskedComposition::getNumberFraction(const std::string_view symbol) const {
+        return getNumberFraction(*lookup_symbol(symbol));
     }
     double MaskedComposition::getNumberFraction(const atomic::Species &species) const {
         if (!contains(species)) {
@@ -118,13 +115,8 @@ namespace fourdst::composition {
             return CompositionDecorator::getNumberFraction(species);
         } return 0.0;
     }
-    double MaskedComposition::getMolarAbundance(const std::string &symbol) const {
-        if (!contains(symbol)) {
-            throw exceptions::UnregisteredSymbolError("Species '" + symbol + "' is not part of the active species in the MaskedComposition.");
-        }
-        if (CompositionDecorator::contains(symbol)) {
-            return CompositionDecorator::getMolarAbundance(symbol);
-        } return 0.0;
+    double MaskedComposition::getMolarAbundance(const std::string_view symbol) const {
+        return getMolarAbundance(*lookup_symbol(symbol));
     }
     double MaskedComposition::getMolarAbundance(const atomic::Species &species) const {
         if (!contains(species)) {
@@ -183,16 +175,12 @@ namespace fourdst::composition {
         return molarAbundances;
     }
 
-    size_t MaskedComposition::getSpeciesIndex(const std::string &symbol) const {
-        if (!contains(symbol)) {
-            throw exceptions::UnregisteredSymbolError("Species '" + symbol + "' is not part of the active species in the MaskedComposition.");
+    size_t MaskedComposition::getSpeciesIndex(const std::string_view symbol) const {
+        const auto species = lookup_symbol(symbol);
+        if (!contains(*species)) {
+            throw exceptions::UnregisteredSymbolError("Species '" + std::string(symbol) + "' is not part of the active species in the MaskedComposition.");
         }
-        return std::distance(
-            m_activeSpecies.begin(),
-            std::ranges::find_if(m_activeSpecies,
-            [&symbol](const atomic::Species& sp) {
-                    return std::string(sp.name()) == symbol;
-        }));
+        return getSpeciesIndex(*species);
     }
 
     size_t MaskedComposition::getSpeciesIndex(const atomic::Species &species) const {
@@ -216,19 +204,19 @@ namespace fourdst::composition {
     }
 
     MaskedComposition::iterator MaskedComposition::begin() {
-        return {m_activeSpecies.begin(), m_molarAbundances.begin()};
+        return {m_activeSpecies.data(), m_molarAbundances.data()};
     }
 
     MaskedComposition::iterator MaskedComposition::end() {
-        return  {m_activeSpecies.end(), m_molarAbundances.end()};
+        return {m_activeSpecies.data() + m_activeSpecies.size(), m_molarAbundances.data() + m_molarAbundances.size()};
     }
 
     MaskedComposition::const_iterator MaskedComposition::begin() const {
-        return {m_activeSpecies.cbegin(), m_molarAbundances.cbegin()};
+        return {m_activeSpecies.data(), m_molarAbundances.data()};
     }
 
     MaskedComposition::const_iterator MaskedComposition::end() const {
-        return {m_activeSpecies.cend(), m_molarAbundances.cend()};
+        return {m_activeSpecies.data() + m_activeSpecies.size(), m_molarAbundances.data() + m_molarAbundances.size()};
     }
 
     size_t MaskedComposition::hash() const {
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/composition/utils/composition_hash.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Byte order and alignment helpers shared by the binary composition formats. All multi-byte values in
+// these formats are little-endian; on little-endian hosts the conversions compile away.
+namespace fourdst::composition::io::detail {
+    inline constexpr std::size_t kBlockAlignment = 64;
+
+    constexpr std::size_t align_up(const std::size_t offset, const std::size_t alignment = kBlockAlignment) noexcept {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    template <typename T>
+    void store_le(std::byte* dst, T value) noexcept {
+        if constexpr (std::endian::native == std::endian::big) {
+            if constexpr (std::is_floating_point_v<T>) {
+                value = std::bit_cast<T>(std::byteswap(std::bit_cast<std::uint64_t>(value)));
+            } else {
+                value = std::byteswap(value);
+            }
+        }
+        std::memcpy(dst, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T load_le(const std::byte* src) noexcept {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big) {
+            if constexpr (std::is_floating_point_v<T>) {
+                value = std::bit_cast<T>(std::byteswap(std::bit_cast<std::uint64_t>(value)));
+            } else {
+                value = std::byteswap(value);
+            }
+        }
+        return value;
+    }
+
+    inline void store_doubles_le(std::byte* dst, const std::span<const double> values) noexcept {
+        if constexpr (std::endian::native == std::endian::little) {
+            if (!values.empty()) {
+                std::memcpy(dst, values.data(), values.size_bytes());
+            }
+        } else {
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                store_le<double>(dst + i * sizeof(double), values[i]);
+            }
+        }
+    }
+
+    inline void load_doubles_le(const std::byte* src, const std::span<double> values) noexcept {
+        if constexpr (std::endian::native == std::endian::little) {
+            if (!values.empty()) {
+                std::memcpy(values.data(), src, values.size_bytes());
+            }
+        } else {
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                values[i] = load_le<double>(src + i * sizeof(double));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns `src` as a span of doubles if it can be read in place (little-endian host, aligned data).
+     * @return The in-place span, or an empty span if the data has to be copied.
+     */
+    inline std::span<const double> doubles_in_place(const std::byte* src, const std::size_t count) noexcept {
+        if constexpr (std::endian::native == std::endian::little) {
+            if (reinterpret_cast<std::uintptr_t>(src) % alignof(double) == 0) {
+                return {reinterpret_cast<const double*>(src), count};
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Writes the packed (Z, A) identifiers of `species` to `dst`.
+     * @return The schema hash of the written table.
+     */
+    inline std::uint64_t store_species_table(std::byte* dst, const std::vector<atomic::Species>& species) noexcept {
+        for (std::size_t i = 0; i < species.size(); ++i) {
+            store_le<std::uint32_t>(dst + i * sizeof(std::uint32_t), utils::CompositionHash::pack_species_id(species[i]));
+        }
+        return utils::CompositionHash::hash_species_schema(species);
+    }
+
+    /**
+     * @brief Reads `count` packed (Z, A) identifiers from `src` and checks them against `schemaHash`.
+     * @throws exceptions::CompositionIOError If the table does not match the hash.
+     */
+    inline std::vector<std::uint32_t> load_species_table(const std::byte* src, const std::size_t count, const std::uint64_t schemaHash) {
+        std::vector<std::uint32_t> ids(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            ids[i] = load_le<std::uint32_t>(src + i * sizeof(std::uint32_t));
+        }
+        if (utils::CompositionHash::hash_species_ids(ids) != schemaHash) {
+            throw exceptions::CompositionIOError("Serialized species table does not match its schema hash.");
+        }
+        return ids;
+    }
+}
@@ -0,0 +1,271 @@
+#include "fourdst/composition/io/composition_archive.h"
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+
+#include "binary_layout.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace fourdst::composition::io::detail;
+    using fourdst::composition::exceptions::CompositionIOError;
+
+    constexpr std::size_t kZoneRecordSize = sizeof(double) + sizeof(std::uint64_t);
+
+    [[noreturn]] void throw_malformed(const std::string& what) {
+        throw CompositionIOError("Malformed composition archive: " + what + ".");
+    }
+}
+
+namespace fourdst::composition::io {
+    std::vector<std::byte> build_composition_archive(
+        const std::vector<atomic::Species> &species,
+        const std::span<const double> molarAbundances,
+        const std::span<const double> coordinates,
+        const ArchiveLayout layout
+    ) {
+        const std::size_t nSpecies = species.size();
+        if (nSpecies == 0 ? !molarAbundances.empty() : molarAbundances.size() % nSpecies != 0) {
+            throw CompositionIOError(
+                "Abundance matrix of " + std::to_string(molarAbundances.size()) +
+                " entries is not a whole number of zones of " + std::to_string(nSpecies) + " species."
+            );
+        }
+        const std::size_t nZones = nSpecies == 0 ? coordinates.size() : molarAbundances.size() / nSpecies;
+        if (!coordinates.empty() && coordinates.size() != nZones) {
+            throw CompositionIOError(
+                "Got " + std::to_string(coordinates.size()) + " zone coordinates for " + std::to_string(nZones) + " zones."
+            );
+        }
+        for (std::size_t j = 1; j < nSpecies; ++j) {
+            if (!(species[j - 1] < species[j])) {
+                throw CompositionIOError("Archive species must be sorted and unique, got " + std::string(species[j].name()) + " after " + std::string(species[j - 1].name()) + ".");
+            }
+        }
+
+        const bool rowMajor = layout == ArchiveLayout::ROW_MAJOR;
+        const std::size_t zoneIndexOffset = align_up(sizeof(CompositionArchiveHeader) + nSpecies * sizeof(std::uint32_t));
+        const std::size_t dataOffset = align_up(zoneIndexOffset + nZones * kZoneRecordSize);
+        const std::size_t stride = align_up((rowMajor ? nSpecies : nZones) * sizeof(double));
+        const std::size_t total = dataOffset + (rowMajor ? nZones : nSpecies) * stride;
+
+        std::vector<std::byte> archive(total); // value-initialised, so all padding is zero
+        std::byte* out = archive.data();
+
+        const std::uint64_t schemaHash = store_species_table(out + sizeof(CompositionArchiveHeader), species);
+
+        for (std::size_t i = 0; i < nZones; ++i) {
+            std::byte* record = out + zoneIndexOffset + i * kZoneRecordSize;
+            store_le<double>(record, coordinates.empty() ? static_cast<double>(i) : coordinates[i]);
+            store_le<std::uint64_t>(record + sizeof(double), dataOffset + (rowMajor ? i * stride : i * sizeof(double)));
+        }
+
+        if (rowMajor) {
+            for (std::size_t i = 0; i < nZones; ++i) {
+                store_doubles_le(out + dataOffset + i * stride, molarAbundances.subspan(i * nSpecies, nSpecies));
+            }
+        } else {
+            for (std::size_t i = 0; i < nZones; ++i) {
+                for (std::size_t j = 0; j < nSpecies; ++j) {
+                    store_le<double>(out + dataOffset + j * stride + i * sizeof(double), molarAbundances[i * nSpecies + j]);
+                }
+            }
+        }
+
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, magic), kCompositionArchiveMagic);
+        store_le<std::uint16_t>(out + offsetof(CompositionArchiveHeader, version), kCompositionArchiveVersion);
+        store_le<std::uint16_t>(out + offsetof(CompositionArchiveHeader, layout), static_cast<std::uint16_t>(layout));
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, schema_hash), schemaHash);
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, species_count), nSpecies);
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, zone_count), nZones);
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, zone_index_offset), zoneIndexOffset);
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, data_offset), dataOffset);
+        store_le<std::uint64_t>(out + offsetof(CompositionArchiveHeader, stride), stride);
+
+        return archive;
+    }
+
+    std::vector<std::byte> build_composition_archive(
+        const std::span<const Composition> zones,
+        const std::span<const double> coordinates,
+        const ArchiveLayout layout
+    ) {
+        std::set<atomic::Species> speciesUnion;
+        for (const auto& zone : zones) {
+            speciesUnion.insert(zone.getRegisteredSpecies().begin(), zone.getRegisteredSpecies().end());
+        }
+        const std::vector<atomic::Species> species(speciesUnion.begin(), speciesUnion.end());
+
+        std::vector<double> matrix(zones.size() * species.size(), 0.0);
+        for (std::size_t i = 0; i < zones.size(); ++i) {
+            for (const auto& [sp, y] : zones[i]) {
+                const auto it = std::ranges::lower_bound(species, sp);
+                matrix[i * species.size() + static_cast<std::size_t>(std::distance(species.begin(), it))] = y;
+            }
+        }
+
+        if (coordinates.empty() && !zones.empty()) { // Explicit indices keep the zone count of species-less archives
+            std::vector<double> indices(zones.size());
+            for (std::size_t i = 0; i < indices.size(); ++i) {
+                indices[i] = static_cast<double>(i);
+            }
+            return build_composition_archive(species, matrix, indices, layout);
+        }
+        return build_composition_archive(species, matrix, coordinates, layout);
+    }
+
+    void write_composition_archive(
+        const std::filesystem::path &path,
+        const std::span<const Composition> zones,
+        const std::span<const double> coordinates,
+        const ArchiveLayout layout
+    ) {
+        write_composition_archive(path, build_composition_archive(zones, coordinates, layout));
+    }
+
+    void write_composition_archive(const std::filesystem::path &path, const std::span<const std::byte> archive) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw CompositionIOError("Unable to open composition archive " + path.string() + " for writing.");
+        }
+        out.write(reinterpret_cast<const char*>(archive.data()), static_cast<std::streamsize>(archive.size()));
+        if (!out) {
+            throw CompositionIOError("Unable to write composition archive " + path.string() + ".");
+        }
+    }
+
+    CompositionArchive::CompositionArchive(const std::filesystem::path &path) :
+    m_file(std::in_place, path) {
+        m_bytes = m_file->bytes();
+        open();
+    }
+
+    CompositionArchive::CompositionArchive(const std::span<const std::byte> buffer) :
+    m_bytes(buffer) {
+        open();
+    }
+
+    void CompositionArchive::open() {
+        const std::size_t size = m_bytes.size();
+        if (size < sizeof(CompositionArchiveHeader)) {
+            throw_malformed("file of " + std::to_string(size) + " bytes is smaller than the header");
+        }
+
+        const std::byte* data = m_bytes.data();
+        m_header.magic = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, magic));
+        m_header.version = load_le<std::uint16_t>(data + offsetof(CompositionArchiveHeader, version));
+        m_header.layout = load_le<std::uint16_t>(data + offsetof(CompositionArchiveHeader, layout));
+        m_header.reserved = load_le<std::uint32_t>(data + offsetof(CompositionArchiveHeader, reserved));
+        m_header.schema_hash = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, schema_hash));
+        m_header.species_count = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, species_count));
+        m_header.zone_count = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, zone_count));
+        m_header.zone_index_offset = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, zone_index_offset));
+        m_header.data_offset = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, data_offset));
+        m_header.stride = load_le<std::uint64_t>(data + offsetof(CompositionArchiveHeader, stride));
+
+        if (m_header.magic != kCompositionArchiveMagic) {
+            throw_malformed("bad magic number");
+        }
+        if (m_header.version != kCompositionArchiveVersion) {
+            throw_malformed("unsupported version " + std::to_string(m_header.version));
+        }
+        if (m_header.layout != static_cast<std::uint16_t>(ArchiveLayout::ROW_MAJOR) &&
+            m_header.layout != static_cast<std::uint16_t>(ArchiveLayout::COLUMN_MAJOR)) {
+            throw_malformed("unknown layout " + std::to_string(m_header.layout));
+        }
+        // Bound the counts by the file size first so that the products below cannot overflow
+        if (m_header.species_count > size / sizeof(std::uint32_t) || m_header.zone_count > size / kZoneRecordSize ||
+            m_header.stride > size) {
+            throw_malformed("species or zone count exceeds the file size");
+        }
+
+        const bool rowMajor = layout() == ArchiveLayout::ROW_MAJOR;
+        const std::size_t lineCount = rowMajor ? m_header.zone_count : m_header.species_count;
+        const std::size_t lineLength = (rowMajor ? m_header.species_count : m_header.zone_count) * sizeof(double);
+        if (m_header.zone_index_offset < sizeof(CompositionArchiveHeader) + m_header.species_count * sizeof(std::uint32_t) ||
+            m_header.data_offset < m_header.zone_index_offset + m_header.zone_count * kZoneRecordSize ||
+            m_header.data_offset > size ||
+            m_header.stride < lineLength || m_header.stride % sizeof(double) != 0 ||
+            (lineCount > 0 && (size - m_header.data_offset) / lineCount < m_header.stride)) {
+            throw_malformed("section offsets are inconsistent with a file of " + std::to_string(size) + " bytes");
+        }
+
+        m_schema = species_schema_from_ids(load_species_table(data + sizeof(CompositionArchiveHeader), m_header.species_count, m_header.schema_hash));
+    }
+
+    double CompositionArchive::zone_coordinate(const std::size_t zone) const {
+        if (zone >= m_header.zone_count) {
+            throw std::out_of_range("Zone " + std::to_string(zone) + " is out of range for an archive of " + std::to_string(m_header.zone_count) + " zones.");
+        }
+        return load_le<double>(m_bytes.data() + m_header.zone_index_offset + zone * kZoneRecordSize);
+    }
+
+    CompositionView CompositionArchive::zone(const std::size_t zone) const {
+        const std::uint64_t offset = zone_offset(zone);
+        const std::size_t nSpecies = m_header.species_count;
+
+        if (layout() == ArchiveLayout::ROW_MAJOR) {
+            if (const auto inPlace = doubles_in_place(m_bytes.data() + offset, nSpecies); !inPlace.empty()) {
+                return {m_schema, inPlace};
+            }
+            std::vector<double> row(nSpecies);
+            load_doubles_le(m_bytes.data() + offset, row);
+            return {m_schema, std::move(row)};
+        }
+
+        std::vector<double> gathered(nSpecies);
+        for (std::size_t j = 0; j < nSpecies; ++j) {
+            gathered[j] = load_le<double>(m_bytes.data() + offset + j * m_header.stride);
+        }
+        return {m_schema, std::move(gathered)};
+    }
+
+    std::optional<std::span<const double>> CompositionArchive::species_column(const atomic::Species &species) const {
+        const std::size_t j = species_index(species);
+        if (layout() != ArchiveLayout::COLUMN_MAJOR || m_header.zone_count == 0) {
+            return std::nullopt;
+        }
+        const auto column = doubles_in_place(m_bytes.data() + m_header.data_offset + j * m_header.stride, m_header.zone_count);
+        if (column.empty()) {
+            return std::nullopt;
+        }
+        return column;
+    }
+
+    double CompositionArchive::molar_abundance(const std::size_t zone, const atomic::Species &species) const {
+        const std::uint64_t offset = zone_offset(zone);
+        const std::size_t j = species_index(species);
+        const std::size_t step = layout() == ArchiveLayout::ROW_MAJOR ? sizeof(double) : m_header.stride;
+        return load_le<double>(m_bytes.data() + offset + j * step);
+    }
+
+    std::uint64_t CompositionArchive::zone_offset(const std::size_t zone) const {
+        if (zone >= m_header.zone_count) {
+            throw std::out_of_range("Zone " + std::to_string(zone) + " is out of range for an archive of " + std::to_string(m_header.zone_count) + " zones.");
+        }
+        const std::uint64_t offset = load_le<std::uint64_t>(m_bytes.data() + m_header.zone_index_offset + zone * kZoneRecordSize + sizeof(double));
+
+        // The last abundance of the zone must lie inside the abundance block
+        const std::size_t span = m_header.species_count == 0 ? 0 :
+            (layout() == ArchiveLayout::ROW_MAJOR ? (m_header.species_count - 1) * sizeof(double) : (m_header.species_count - 1) * m_header.stride) + sizeof(double);
+        if (offset < m_header.data_offset || offset % sizeof(double) != 0 || offset > m_bytes.size() || m_bytes.size() - offset < span) {
+            throw_malformed("zone " + std::to_string(zone) + " has an invalid abundance offset");
+        }
+        return offset;
+    }
+
+    std::size_t CompositionArchive::species_index(const atomic::Species &species) const {
+        const auto it = std::ranges::lower_bound(*m_schema, species);
+        if (it == m_schema->end() || *it != species) {
+            throw exceptions::UnregisteredSymbolError("Species '" + std::string(species.name()) + "' is not part of the composition archive schema.");
+        }
+        return static_cast<std::size_t>(std::distance(m_schema->begin(), it));
+    }
+}
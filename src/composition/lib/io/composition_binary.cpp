@@ -0,0 +1,202 @@
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/utils/utils.h"
+
+#include "binary_layout.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace fourdst::composition::io::detail;
+
+    std::vector<std::uint32_t> read_species_ids(
+        const std::span<const std::byte> buffer,
+        const fourdst::composition::io::CompositionBinaryHeader& header
+    ) {
+        return load_species_table(buffer.data() + sizeof(fourdst::composition::io::CompositionBinaryHeader), header.species_count, header.schema_hash);
+    }
+
+    std::vector<double> read_abundances(
+        const std::span<const std::byte> buffer,
+        const fourdst::composition::io::CompositionBinaryHeader& header
+    ) {
+        std::vector<double> abundances(header.species_count);
+        load_doubles_le(buffer.data() + header.abundance_offset, abundances);
+        return abundances;
+    }
+
+    struct SchemaCacheEntry {
+        std::vector<std::uint32_t> ids;
+        std::shared_ptr<const std::vector<fourdst::atomic::Species>> schema;
+    };
+
+    struct SchemaCache {
+        std::mutex mutex;
+        std::unordered_multimap<std::uint64_t, SchemaCacheEntry> entries;
+    };
+
+    SchemaCache& schema_cache() {
+        static SchemaCache cache;
+        return cache;
+    }
+}
+
+namespace fourdst::composition::io {
+    std::size_t serialized_size(const CompositionAbstract &composition) noexcept {
+        return serialized_size(composition.size());
+    }
+
+    std::size_t serialize(const CompositionAbstract &composition, const std::span<std::byte> buffer) {
+        const std::size_t count = composition.size();
+        const std::size_t total = serialized_size(count);
+        if (buffer.size() < total) {
+            throw exceptions::CompositionIOError(
+                "Buffer of " + std::to_string(buffer.size()) + " bytes is too small to serialize a composition of " +
+                std::to_string(count) + " species (" + std::to_string(total) + " bytes required)."
+            );
+        }
+
+        const std::size_t abundanceOffset = align_up(sizeof(CompositionBinaryHeader) + count * sizeof(std::uint32_t));
+        std::memset(buffer.data(), 0, total);
+
+        const std::uint64_t schemaHash = store_species_table(buffer.data() + sizeof(CompositionBinaryHeader), composition.getRegisteredSpecies());
+        store_doubles_le(buffer.data() + abundanceOffset, {composition.begin().getAbundanceIt(), count});
+
+        std::byte* header = buffer.data();
+        store_le<std::uint64_t>(header + offsetof(CompositionBinaryHeader, magic), kCompositionBinaryMagic);
+        store_le<std::uint16_t>(header + offsetof(CompositionBinaryHeader, version), kCompositionBinaryVersion);
+        store_le<std::uint16_t>(header + offsetof(CompositionBinaryHeader, species_encoding), static_cast<std::uint16_t>(SpeciesEncoding::PACKED_ZA));
+        store_le<std::uint64_t>(header + offsetof(CompositionBinaryHeader, schema_hash), schemaHash);
+        store_le<std::uint64_t>(header + offsetof(CompositionBinaryHeader, species_count), count);
+        store_le<std::uint64_t>(header + offsetof(CompositionBinaryHeader, abundance_offset), abundanceOffset);
+        store_le<std::uint64_t>(header + offsetof(CompositionBinaryHeader, total_size), total);
+
+        return total;
+    }
+
+    std::vector<std::byte> serialize(const CompositionAbstract &composition) {
+        std::vector<std::byte> buffer(serialized_size(composition));
+        serialize(composition, buffer);
+        return buffer;
+    }
+
+    CompositionBinaryHeader read_header(const std::span<const std::byte> buffer) {
+        if (buffer.size() < sizeof(CompositionBinaryHeader)) {
+            throw exceptions::CompositionIOError("Buffer of " + std::to_string(buffer.size()) + " bytes is too small to hold a serialized composition header.");
+        }
+
+        const std::byte* data = buffer.data();
+        CompositionBinaryHeader header;
+        header.magic = load_le<std::uint64_t>(data + offsetof(CompositionBinaryHeader, magic));
+        header.version = load_le<std::uint16_t>(data + offsetof(CompositionBinaryHeader, version));
+        header.species_encoding = load_le<std::uint16_t>(data + offsetof(CompositionBinaryHeader, species_encoding));
+        header.reserved = load_le<std::uint32_t>(data + offsetof(CompositionBinaryHeader, reserved));
+        header.schema_hash = load_le<std::uint64_t>(data + offsetof(CompositionBinaryHeader, schema_hash));
+        header.species_count = load_le<std::uint64_t>(data + offsetof(CompositionBinaryHeader, species_count));
+        header.abundance_offset = load_le<std::uint64_t>(data + offsetof(CompositionBinaryHeader, abundance_offset));
+        header.total_size = load_le<std::uint64_t>(data + offsetof(CompositionBinaryHeader, total_size));
+
+        if (header.magic != kCompositionBinaryMagic) {
+            throw exceptions::CompositionIOError("Buffer does not contain a serialized composition (bad magic number).");
+        }
+        if (header.version != kCompositionBinaryVersion) {
+            throw exceptions::CompositionIOError(
+                "Unsupported serialized composition version " + std::to_string(header.version) +
+                " (expected " + std::to_string(kCompositionBinaryVersion) + ")."
+            );
+        }
+        if (header.species_encoding != static_cast<std::uint16_t>(SpeciesEncoding::PACKED_ZA)) {
+            throw exceptions::CompositionIOError("Unsupported species encoding " + std::to_string(header.species_encoding) + " in serialized composition.");
+        }
+        // Guard against counts whose byte sizes would overflow before comparing against the layout
+        if (header.species_count > buffer.size() / sizeof(double)) {
+            throw exceptions::CompositionIOError("Serialized composition species count " + std::to_string(header.species_count) + " exceeds the buffer size.");
+        }
+        const std::size_t count = header.species_count;
+        const std::size_t speciesEnd = sizeof(CompositionBinaryHeader) + count * sizeof(std::uint32_t);
+        if (header.abundance_offset % kCompositionBinaryAlignment != 0 ||
+            header.abundance_offset < speciesEnd ||
+            header.total_size < header.abundance_offset + count * sizeof(double) ||
+            header.total_size > buffer.size()) {
+            throw exceptions::CompositionIOError(
+                "Serialized composition layout is inconsistent (abundance offset " + std::to_string(header.abundance_offset) +
+                ", total size " + std::to_string(header.total_size) + ", buffer size " + std::to_string(buffer.size()) + ")."
+            );
+        }
+        return header;
+    }
+
+    Composition deserialize(const std::span<const std::byte> buffer) {
+        const CompositionBinaryHeader header = read_header(buffer);
+        const std::shared_ptr<const std::vector<atomic::Species>> schema = species_schema_from_ids(read_species_ids(buffer, header));
+        return {*schema, read_abundances(buffer, header)};
+    }
+
+    CompositionView deserialize_view(const std::span<const std::byte> buffer) {
+        const CompositionBinaryHeader header = read_header(buffer);
+        std::shared_ptr<const std::vector<atomic::Species>> schema = species_schema_from_ids(read_species_ids(buffer, header));
+
+        if (const auto inPlace = doubles_in_place(buffer.data() + header.abundance_offset, header.species_count); !inPlace.empty()) {
+            return {std::move(schema), inPlace};
+        }
+        return {std::move(schema), read_abundances(buffer, header)};
+    }
+
+    std::shared_ptr<const std::vector<atomic::Species>> species_schema_from_ids(const std::span<const std::uint32_t> ids) {
+        const std::uint64_t schemaHash = utils::CompositionHash::hash_species_ids(ids);
+        SchemaCache& cache = schema_cache();
+
+        {
+            std::scoped_lock lock(cache.mutex);
+            const auto [first, last] = cache.entries.equal_range(schemaHash);
+            for (auto it = first; it != last; ++it) {
+                if (std::ranges::equal(it->second.ids, ids)) {
+                    return it->second.schema;
+                }
+            }
+        }
+
+        auto species = std::make_shared<std::vector<atomic::Species>>();
+        species->reserve(ids.size());
+        for (const std::uint32_t id : ids) {
+            const int z = static_cast<int>(id >> 16);
+            const int a = static_cast<int>(id & 0xFFFFu);
+            auto sp = getSpecies(z, a);
+            if (!sp) {
+                throw exceptions::CompositionIOError("Serialized species (Z=" + std::to_string(z) + ", A=" + std::to_string(a) + ") is not in the species database.");
+            }
+            if (!species->empty() && !(species->back() < *sp)) {
+                throw exceptions::CompositionIOError("Serialized species table is not in canonical order at " + std::string(sp->name()) + ".");
+            }
+            species->push_back(std::move(*sp));
+        }
+
+        std::shared_ptr<const std::vector<atomic::Species>> schema = std::move(species);
+        std::scoped_lock lock(cache.mutex);
+        const auto [first, last] = cache.entries.equal_range(schemaHash);
+        for (auto it = first; it != last; ++it) { // Another thread may have resolved the same schema meanwhile
+            if (std::ranges::equal(it->second.ids, ids)) {
+                return it->second.schema;
+            }
+        }
+        cache.entries.emplace(schemaHash, SchemaCacheEntry{{ids.begin(), ids.end()}, schema});
+        return schema;
+    }
+
+    std::shared_ptr<const std::vector<atomic::Species>> find_species_schema(const std::uint64_t schemaHash) {
+        SchemaCache& cache = schema_cache();
+        std::scoped_lock lock(cache.mutex);
+        if (cache.entries.count(schemaHash) != 1) {
+            return nullptr;
+        }
+        return cache.entries.find(schemaHash)->second.schema;
+    }
+}
@@ -0,0 +1,606 @@
+#include "fourdst/composition/io/composition_numpy.h"
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/utils/utils.h"
+
+#include "binary_layout.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace fourdst::composition::io::detail;
+    using fourdst::composition::exceptions::CompositionIOError;
+
+    constexpr std::string_view kNpyMagic = "\x93NUMPY";
+    constexpr std::size_t kNpyPreambleV1 = 10; // magic, version, uint16 header length
+    constexpr std::size_t kNpyPreambleV2 = 12; // magic, version, uint32 header length
+
+    constexpr std::uint32_t kZipLocalHeader = 0x04034b50;
+    constexpr std::uint32_t kZipCentralHeader = 0x02014b50;
+    constexpr std::uint32_t kZipEndOfCentralDirectory = 0x06054b50;
+    constexpr std::size_t kZipLocalHeaderSize = 30;
+    constexpr std::size_t kZipCentralHeaderSize = 46;
+    constexpr std::size_t kZipEndSize = 22;
+    constexpr std::uint16_t kZipAlignmentExtraId = 0xD935; // same extra field id as Android's zipalign
+    constexpr std::uint16_t kZipDosDate = (0 << 9) | (1 << 5) | 1; // 1980-01-01
+
+    constexpr std::array<std::uint32_t, 256> make_crc_table() {
+        std::array<std::uint32_t, 256> table{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        return table;
+    }
+
+    constexpr std::array<std::uint32_t, 256> kCrcTable = make_crc_table();
+
+    std::uint32_t crc32_update(std::uint32_t crc, const std::span<const std::byte> data) noexcept {
+        crc = ~crc;
+        for (const std::byte b : data) {
+            crc = kCrcTable[(crc ^ std::to_integer<std::uint32_t>(b)) & 0xFFu] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    std::span<const std::byte> as_bytes(const std::string& s) noexcept {
+        return {reinterpret_cast<const std::byte*>(s.data()), s.size()};
+    }
+
+    /**
+     * Builds the magic, version and header dictionary of a C-ordered .npy array, padded so that the
+     * element data starts on a 64 byte boundary.
+     */
+    std::string npy_header(const std::string_view descr, const std::vector<std::size_t>& shape) {
+        std::string dict = "{'descr': '" + std::string(descr) + "', 'fortran_order': False, 'shape': (";
+        for (const std::size_t extent : shape) {
+            dict += std::to_string(extent) + ", ";
+        }
+        if (shape.size() > 1) {
+            dict.resize(dict.size() - 1); // "(2, 3)" rather than "(2, 3, )"; one dimensional shapes keep "(3,)"
+            dict.back() = ')';
+        } else if (shape.size() == 1) {
+            dict.back() = ')';
+        } else {
+            dict += ')';
+        }
+        dict += ", }";
+
+        const bool v2 = align_up(kNpyPreambleV1 + dict.size() + 1) - kNpyPreambleV1 > 0xFFFF;
+        const std::size_t preamble = v2 ? kNpyPreambleV2 : kNpyPreambleV1;
+        const std::size_t total = align_up(preamble + dict.size() + 1);
+        dict.append(total - preamble - dict.size() - 1, ' ');
+        dict += '\n';
+
+        std::string header(kNpyMagic);
+        header += static_cast<char>(v2 ? 2 : 1);
+        header += '\0';
+        const std::size_t length = dict.size();
+        header += static_cast<char>(length & 0xFF);
+        header += static_cast<char>((length >> 8) & 0xFF);
+        if (v2) {
+            header += static_cast<char>((length >> 16) & 0xFF);
+            header += static_cast<char>((length >> 24) & 0xFF);
+        }
+        return header + dict;
+    }
+
+    // Number of elements of an array of this shape; shapes read from a file can be arbitrarily large
+    std::size_t shape_product(const std::vector<std::size_t>& shape) {
+        std::size_t product = 1;
+        for (const std::size_t extent : shape) {
+            if (__builtin_mul_overflow(product, extent, &product)) {
+                throw CompositionIOError("Array shape overflows the addressable element count.");
+            }
+        }
+        return product;
+    }
+
+    void check_shape(const std::size_t count, const std::vector<std::size_t>& shape) {
+        const std::size_t product = shape_product(shape);
+        if (product != count) {
+            throw CompositionIOError("Array shape holds " + std::to_string(product) + " elements but " + std::to_string(count) + " were given.");
+        }
+    }
+
+    void write_bytes(std::ofstream& out, const std::span<const std::byte> bytes) {
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    /**
+     * Minimal writer for uncompressed ZIP archives, as used by numpy.savez. Member data is aligned to 64
+     * bytes with a padding extra field so that readers can map the arrays in place.
+     */
+    class ZipWriter {
+    public:
+        explicit ZipWriter(const std::filesystem::path& path) : m_path(path), m_out(path, std::ios::binary | std::ios::trunc) {
+            if (!m_out) {
+                throw CompositionIOError("Unable to open " + path.string() + " for writing.");
+            }
+        }
+
+        void add_npy(const std::string& name, const std::string& header, const std::span<const std::byte> data) {
+            const std::string fileName = name + ".npy";
+            const std::uint32_t crc = crc32_update(crc32_update(0, as_bytes(header)), data);
+            const std::size_t size = header.size() + data.size();
+            if (size > 0xFFFFFFFFu || m_offset > 0xFFFFFFFFu) {
+                throw CompositionIOError("Array " + name + " is too large for a non-zip64 .npz archive.");
+            }
+
+            std::size_t pad = (kBlockAlignment - (m_offset + kZipLocalHeaderSize + fileName.size()) % kBlockAlignment) % kBlockAlignment;
+            if (pad != 0 && pad < 4) {
+                pad += kBlockAlignment; // an extra field needs at least its 4 byte header
+            }
+
+            std::vector<std::byte> local(kZipLocalHeaderSize + fileName.size() + pad);
+            store_le<std::uint32_t>(local.data(), kZipLocalHeader);
+            store_le<std::uint16_t>(local.data() + 4, 20); // version needed to extract
+            store_le<std::uint16_t>(local.data() + 12, kZipDosDate);
+            store_le<std::uint32_t>(local.data() + 14, crc);
+            store_le<std::uint32_t>(local.data() + 18, static_cast<std::uint32_t>(size));
+            store_le<std::uint32_t>(local.data() + 22, static_cast<std::uint32_t>(size));
+            store_le<std::uint16_t>(local.data() + 26, static_cast<std::uint16_t>(fileName.size()));
+            store_le<std::uint16_t>(local.data() + 28, static_cast<std::uint16_t>(pad));
+            std::memcpy(local.data() + kZipLocalHeaderSize, fileName.data(), fileName.size());
+            if (pad != 0) {
+                store_le<std::uint16_t>(local.data() + kZipLocalHeaderSize + fileName.size(), kZipAlignmentExtraId);
+                store_le<std::uint16_t>(local.data() + kZipLocalHeaderSize + fileName.size() + 2, static_cast<std::uint16_t>(pad - 4));
+            }
+
+            m_entries.push_back({fileName, crc, static_cast<std::uint32_t>(size), static_cast<std::uint32_t>(m_offset)});
+            write_bytes(m_out, local);
+            write_bytes(m_out, as_bytes(header));
+            write_bytes(m_out, data);
+            m_offset += local.size() + size;
+        }
+
+        void finish() {
+            const std::size_t directoryOffset = m_offset;
+            std::size_t directorySize = 0;
+            for (const auto& entry : m_entries) {
+                std::vector<std::byte> central(kZipCentralHeaderSize + entry.name.size());
+                store_le<std::uint32_t>(central.data(), kZipCentralHeader);
+                store_le<std::uint16_t>(central.data() + 4, 20); // version made by
+                store_le<std::uint16_t>(central.data() + 6, 20); // version needed to extract
+                store_le<std::uint16_t>(central.data() + 14, kZipDosDate);
+                store_le<std::uint32_t>(central.data() + 16, entry.crc);
+                store_le<std::uint32_t>(central.data() + 20, entry.size);
+                store_le<std::uint32_t>(central.data() + 24, entry.size);
+                store_le<std::uint16_t>(central.data() + 28, static_cast<std::uint16_t>(entry.name.size()));
+                store_le<std::uint32_t>(central.data() + 42, entry.offset);
+                std::memcpy(central.data() + kZipCentralHeaderSize, entry.name.data(), entry.name.size());
+                write_bytes(m_out, central);
+                directorySize += central.size();
+            }
+            if (directoryOffset > 0xFFFFFFFFu) {
+                throw CompositionIOError("Archive " + m_path.string() + " is too large for a non-zip64 .npz archive.");
+            }
+
+            std::array<std::byte, kZipEndSize> end{};
+            store_le<std::uint32_t>(end.data(), kZipEndOfCentralDirectory);
+            store_le<std::uint16_t>(end.data() + 8, static_cast<std::uint16_t>(m_entries.size()));
+            store_le<std::uint16_t>(end.data() + 10, static_cast<std::uint16_t>(m_entries.size()));
+            store_le<std::uint32_t>(end.data() + 12, static_cast<std::uint32_t>(directorySize));
+            store_le<std::uint32_t>(end.data() + 16, static_cast<std::uint32_t>(directoryOffset));
+            write_bytes(m_out, end);
+
+            m_out.flush();
+            if (!m_out) {
+                throw CompositionIOError("Unable to write " + m_path.string() + ".");
+            }
+        }
+
+    private:
+        struct Entry {
+            std::string name;
+            std::uint32_t crc;
+            std::uint32_t size;
+            std::uint32_t offset;
+        };
+
+        std::filesystem::path m_path;
+        std::ofstream m_out;
+        std::vector<Entry> m_entries;
+        std::size_t m_offset = 0;
+    };
+
+    template <typename T>
+    void add_array(ZipWriter& zip, const std::string& name, const std::span<const T> data, const std::vector<std::size_t>& shape) {
+        check_shape(data.size(), shape);
+        zip.add_npy(name, npy_header(fourdst::composition::io::npy_descr<T>(), shape), std::as_bytes(data));
+    }
+
+    void add_string_array(ZipWriter& zip, const std::string& name, const std::vector<std::string>& strings) {
+        std::size_t width = 1;
+        for (const auto& s : strings) {
+            width = std::max(width, s.size());
+        }
+        std::vector<std::byte> data(strings.size() * width * sizeof(std::uint32_t));
+        for (std::size_t i = 0; i < strings.size(); ++i) {
+            for (std::size_t c = 0; c < strings[i].size(); ++c) { // species names are ASCII, so UTF-32 is a zero extension
+                store_le<std::uint32_t>(data.data() + (i * width + c) * sizeof(std::uint32_t), static_cast<unsigned char>(strings[i][c]));
+            }
+        }
+        zip.add_npy(name, npy_header("<U" + std::to_string(width), {strings.size()}), data);
+    }
+
+    std::vector<std::int64_t> integer_values(const fourdst::composition::io::NpyArray& array, const std::string& name) {
+        if (array.descr() == fourdst::composition::io::npy_descr<std::int32_t>()) {
+            const auto values = array.copy_values<std::int32_t>();
+            return {values.begin(), values.end()};
+        }
+        if (array.descr() == fourdst::composition::io::npy_descr<std::int64_t>()) {
+            return array.copy_values<std::int64_t>();
+        }
+        throw CompositionIOError("Array '" + name + "' must hold 32 or 64 bit integers, got dtype " + array.descr() + ".");
+    }
+
+    // Extracts the value following `'key':` in a .npy header dictionary
+    std::string_view dict_value(const std::string_view dict, const std::string_view key) {
+        const std::string quoted = "'" + std::string(key) + "'";
+        std::size_t pos = dict.find(quoted);
+        if (pos == std::string_view::npos) {
+            throw CompositionIOError("Malformed .npy header: missing key " + quoted + ".");
+        }
+        pos = dict.find(':', pos + quoted.size());
+        if (pos == std::string_view::npos) {
+            throw CompositionIOError("Malformed .npy header: missing value for " + quoted + ".");
+        }
+        ++pos;
+        while (pos < dict.size() && dict[pos] == ' ') {
+            ++pos;
+        }
+        return dict.substr(pos);
+    }
+}
+
+namespace fourdst::composition::io {
+    NpyArray::NpyArray(const std::span<const std::byte> bytes) {
+        if (bytes.size() < kNpyPreambleV1 || std::memcmp(bytes.data(), kNpyMagic.data(), kNpyMagic.size()) != 0) {
+            throw CompositionIOError("Buffer is not a .npy array (bad magic string).");
+        }
+        const auto major = std::to_integer<unsigned>(bytes[6]);
+        if (major < 1 || major > 3) {
+            throw CompositionIOError("Unsupported .npy format version " + std::to_string(major) + ".");
+        }
+        const std::size_t preamble = major == 1 ? kNpyPreambleV1 : kNpyPreambleV2;
+        if (bytes.size() < preamble) {
+            throw CompositionIOError("Truncated .npy header.");
+        }
+        const std::size_t headerLength = major == 1 ? load_le<std::uint16_t>(bytes.data() + 8) : load_le<std::uint32_t>(bytes.data() + 8);
+        if (bytes.size() - preamble < headerLength) {
+            throw CompositionIOError("Truncated .npy header.");
+        }
+        const std::string_view dict(reinterpret_cast<const char*>(bytes.data()) + preamble, headerLength);
+
+        const std::string_view descr = dict_value(dict, "descr");
+        if (descr.empty() || descr.front() != '\'' || descr.find('\'', 1) == std::string_view::npos) {
+            throw CompositionIOError("Unsupported .npy dtype (only simple dtypes are supported).");
+        }
+        m_descr = std::string(descr.substr(1, descr.find('\'', 1) - 1));
+        m_fortranOrder = dict_value(dict, "fortran_order").starts_with("True");
+
+        const std::string_view shape = dict_value(dict, "shape");
+        if (shape.empty() || shape.front() != '(' || shape.find(')') == std::string_view::npos) {
+            throw CompositionIOError("Malformed .npy header: bad shape.");
+        }
+        std::string_view extents = shape.substr(1, shape.find(')') - 1);
+        while (!extents.empty()) {
+            while (!extents.empty() && (extents.front() == ' ' || extents.front() == ',')) {
+                extents.remove_prefix(1);
+            }
+            if (extents.empty()) {
+                break;
+            }
+            std::size_t extent = 0;
+            const auto [ptr, ec] = std::from_chars(extents.data(), extents.data() + extents.size(), extent);
+            if (ec != std::errc{}) {
+                throw CompositionIOError("Malformed .npy header: bad shape.");
+            }
+            m_shape.push_back(extent);
+            extents.remove_prefix(static_cast<std::size_t>(ptr - extents.data()));
+        }
+
+        m_data = bytes.subspan(preamble + headerLength);
+        std::size_t itemSize = 0;
+        const std::string_view digits = std::string_view(m_descr).substr(std::min<std::size_t>(2, m_descr.size()));
+        if (std::from_chars(digits.data(), digits.data() + digits.size(), itemSize).ec != std::errc{} || m_descr.size() < 3) {
+            throw CompositionIOError("Unsupported .npy dtype " + m_descr + ".");
+        }
+        if (m_descr[1] == 'U') {
+            itemSize *= sizeof(std::uint32_t);
+        }
+        const std::size_t count = shape_product(m_shape);
+        if (itemSize != 0 && m_data.size() / itemSize < count) {
+            throw CompositionIOError("Truncated .npy data: expected " + std::to_string(count) + " elements of dtype " + m_descr + ".");
+        }
+        m_data = m_data.first(count * itemSize);
+    }
+
+    std::size_t NpyArray::element_count() const noexcept {
+        return std::accumulate(m_shape.begin(), m_shape.end(), std::size_t{1}, std::multiplies<>());
+    }
+
+    std::vector<std::string> NpyArray::strings() const {
+        if (m_descr.size() < 3 || (m_descr[1] != 'U' && m_descr[1] != 'S')) {
+            throw CompositionIOError("Array of dtype " + m_descr + " does not hold strings.");
+        }
+        const bool unicode = m_descr[1] == 'U';
+        const std::size_t count = element_count();
+        const std::size_t width = count == 0 ? 0 : m_data.size() / count / (unicode ? sizeof(std::uint32_t) : 1);
+
+        std::vector<std::string> out(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t c = 0; c < width; ++c) {
+                std::uint32_t code;
+                if (unicode) {
+                    const std::byte* p = m_data.data() + (i * width + c) * sizeof(std::uint32_t);
+                    code = m_descr[0] == '>' ? std::byteswap(load_le<std::uint32_t>(p)) : load_le<std::uint32_t>(p);
+                } else {
+                    code = std::to_integer<std::uint32_t>(m_data[i * width + c]);
+                }
+                if (code == 0) {
+                    break;
+                }
+                out[i] += code < 0x80 ? static_cast<char>(code) : '?';
+            }
+        }
+        return out;
+    }
+
+    void NpyArray::check_descr(const std::string_view expected, const std::size_t itemSize) const {
+        // A single byte type has no byte order, NumPy writes '|' for it
+        if (m_descr != expected && !(itemSize == 1 && m_descr.size() == expected.size() && m_descr.substr(1) == expected.substr(1))) {
+            throw CompositionIOError("Expected .npy dtype " + std::string(expected) + ", got " + m_descr + ".");
+        }
+        if (m_fortranOrder && m_shape.size() > 1) {
+            throw CompositionIOError("Fortran ordered .npy arrays are not supported.");
+        }
+    }
+
+    void NpyArray::throw_misaligned() {
+        throw CompositionIOError(".npy data is not aligned for in-place access; use copy_values() instead.");
+    }
+
+    NpyFile::NpyFile(const std::filesystem::path &path) :
+    m_file(path),
+    m_array(m_file.bytes()) {}
+
+    NpzFile::NpzFile(const std::filesystem::path &path) :
+    m_file(path) {
+        const std::span<const std::byte> bytes = m_file.bytes();
+        if (bytes.size() < kZipEndSize) {
+            throw CompositionIOError(path.string() + " is not a .npz archive (too small).");
+        }
+
+        // The end of central directory record is followed by a comment of at most 65535 bytes
+        std::size_t end = bytes.size() - kZipEndSize;
+        const std::size_t lowest = bytes.size() > kZipEndSize + 0xFFFF ? bytes.size() - kZipEndSize - 0xFFFF : 0;
+        while (load_le<std::uint32_t>(bytes.data() + end) != kZipEndOfCentralDirectory) {
+            if (end == lowest) {
+                throw CompositionIOError(path.string() + " is not a .npz archive (no end of central directory).");
+            }
+            --end;
+        }
+
+        const std::size_t entries = load_le<std::uint16_t>(bytes.data() + end + 10);
+        std::size_t cursor = load_le<std::uint32_t>(bytes.data() + end + 16);
+        for (std::size_t i = 0; i < entries; ++i) {
+            if (cursor > end || end - cursor < kZipCentralHeaderSize || load_le<std::uint32_t>(bytes.data() + cursor) != kZipCentralHeader) {
+                throw CompositionIOError(path.string() + " has a corrupt central directory.");
+            }
+            const std::byte* central = bytes.data() + cursor;
+            const auto method = load_le<std::uint16_t>(central + 10);
+            const std::size_t compressedSize = load_le<std::uint32_t>(central + 20);
+            const std::size_t nameLength = load_le<std::uint16_t>(central + 28);
+            const std::size_t extraLength = load_le<std::uint16_t>(central + 30);
+            const std::size_t commentLength = load_le<std::uint16_t>(central + 32);
+            const std::size_t localOffset = load_le<std::uint32_t>(central + 42);
+            if (end - cursor - kZipCentralHeaderSize < nameLength) {
+                throw CompositionIOError(path.string() + " has a corrupt central directory.");
+            }
+            std::string name(reinterpret_cast<const char*>(central + kZipCentralHeaderSize), nameLength);
+            cursor += kZipCentralHeaderSize + nameLength + extraLength + commentLength;
+
+            if (method != 0) {
+                throw CompositionIOError("Member " + name + " of " + path.string() + " is compressed; only uncompressed archives (numpy.savez) are supported.");
+            }
+            if (compressedSize == 0xFFFFFFFFu || localOffset == 0xFFFFFFFFu) {
+                throw CompositionIOError("Member " + name + " of " + path.string() + " uses zip64, which is not supported.");
+            }
+            if (localOffset > bytes.size() || bytes.size() - localOffset < kZipLocalHeaderSize ||
+                load_le<std::uint32_t>(bytes.data() + localOffset) != kZipLocalHeader) {
+                throw CompositionIOError("Member " + name + " of " + path.string() + " has a corrupt local header.");
+            }
+            const std::size_t dataOffset = localOffset + kZipLocalHeaderSize +
+                load_le<std::uint16_t>(bytes.data() + localOffset + 26) + load_le<std::uint16_t>(bytes.data() + localOffset + 28);
+            if (dataOffset > bytes.size() || bytes.size() - dataOffset < compressedSize) {
+                throw CompositionIOError("Member " + name + " of " + path.string() + " is truncated.");
+            }
+
+            if (name.ends_with(".npy")) {
+                name.resize(name.size() - 4);
+            }
+            m_arrays.emplace(std::move(name), NpyArray(bytes.subspan(dataOffset, compressedSize)));
+        }
+    }
+
+    const NpyArray & NpzFile::at(const std::string &name) const {
+        const auto it = m_arrays.find(name);
+        if (it == m_arrays.end()) {
+            throw CompositionIOError("Archive has no array named '" + name + "'.");
+        }
+        return it->second;
+    }
+
+    std::vector<std::string> NpzFile::names() const {
+        std::vector<std::string> out;
+        out.reserve(m_arrays.size());
+        for (const auto& name : m_arrays | std::views::keys) {
+            out.push_back(name);
+        }
+        return out;
+    }
+
+    template <typename T>
+    void write_npy(const std::filesystem::path &path, const std::span<const T> data, const std::vector<std::size_t> &shape) {
+        check_shape(data.size(), shape);
+        const std::string header = npy_header(npy_descr<T>(), shape);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw CompositionIOError("Unable to open " + path.string() + " for writing.");
+        }
+        write_bytes(out, as_bytes(header));
+        write_bytes(out, std::as_bytes(data));
+        out.flush();
+        if (!out) {
+            throw CompositionIOError("Unable to write " + path.string() + ".");
+        }
+    }
+
+    template void write_npy<double>(const std::filesystem::path&, std::span<const double>, const std::vector<std::size_t>&);
+    template void write_npy<float>(const std::filesystem::path&, std::span<const float>, const std::vector<std::size_t>&);
+    template void write_npy<std::int32_t>(const std::filesystem::path&, std::span<const std::int32_t>, const std::vector<std::size_t>&);
+    template void write_npy<std::int64_t>(const std::filesystem::path&, std::span<const std::int64_t>, const std::vector<std::size_t>&);
+    template void write_npy<std::uint32_t>(const std::filesystem::path&, std::span<const std::uint32_t>, const std::vector<std::size_t>&);
+    template void write_npy<std::uint64_t>(const std::filesystem::path&, std::span<const std::uint64_t>, const std::vector<std::size_t>&);
+
+    void write_composition_npz(
+        const std::filesystem::path &path,
+        const std::vector<atomic::Species> &species,
+        const std::span<const double> molarAbundances
+    ) {
+        const std::size_t nSpecies = species.size();
+        if (nSpecies == 0 ? !molarAbundances.empty() : molarAbundances.size() % nSpecies != 0) {
+            throw CompositionIOError(
+                "Abundance matrix of " + std::to_string(molarAbundances.size()) +
+                " entries is not a whole number of zones of " + std::to_string(nSpecies) + " species."
+            );
+        }
+        const std::size_t nZones = nSpecies == 0 ? 0 : molarAbundances.size() / nSpecies;
+
+        std::vector<std::int32_t> z(nSpecies);
+        std::vector<std::int32_t> a(nSpecies);
+        std::vector<double> mass(nSpecies);
+        std::vector<std::string> names(nSpecies);
+        for (std::size_t j = 0; j < nSpecies; ++j) {
+            z[j] = species[j].z();
+            a[j] = species[j].a();
+            mass[j] = species[j].mass();
+            names[j] = std::string(species[j].name());
+        }
+
+        ZipWriter zip(path);
+        add_array<double>(zip, "molar_abundances", molarAbundances, {nZones, nSpecies});
+        add_array<std::int32_t>(zip, "z", z, {nSpecies});
+        add_array<std::int32_t>(zip, "a", a, {nSpecies});
+        add_array<double>(zip, "mass", mass, {nSpecies});
+        add_string_array(zip, "names", names);
+        zip.finish();
+    }
+
+    void write_composition_npz(const std::filesystem::path &path, const std::span<const Composition> zones) {
+        std::set<atomic::Species> speciesUnion;
+        for (const auto& zone : zones) {
+            speciesUnion.insert(zone.getRegisteredSpecies().begin(), zone.getRegisteredSpecies().end());
+        }
+        const std::vector<atomic::Species> species(speciesUnion.begin(), speciesUnion.end());
+
+        std::vector<double> matrix(zones.size() * species.size(), 0.0);
+        for (std::size_t i = 0; i < zones.size(); ++i) {
+            for (const auto& [sp, y] : zones[i]) {
+                const auto it = std::ranges::lower_bound(species, sp);
+                matrix[i * species.size() + static_cast<std::size_t>(std::distance(species.begin(), it))] = y;
+            }
+        }
+        write_composition_npz(path, species, matrix);
+    }
+
+    void write_composition_npz(const std::filesystem::path &path, const CompositionAbstract &composition) {
+        write_composition_npz(path, composition.getRegisteredSpecies(), {composition.begin().getAbundanceIt(), composition.size()});
+    }
+
+    CompositionNpz::CompositionNpz(const std::filesystem::path &path) :
+    m_npz(path) {
+        const std::vector<std::int64_t> z = integer_values(m_npz.at("z"), "z");
+        const std::vector<std::int64_t> a = integer_values(m_npz.at("a"), "a");
+        if (z.size() != a.size()) {
+            throw CompositionIOError("Arrays 'z' and 'a' of " + path.string() + " differ in length.");
+        }
+        const std::size_t nSpecies = z.size();
+
+        std::vector<atomic::Species> species;
+        species.reserve(nSpecies);
+        for (std::size_t j = 0; j < nSpecies; ++j) {
+            auto sp = getSpecies(static_cast<int>(z[j]), static_cast<int>(a[j]));
+            if (!sp) {
+                throw CompositionIOError("Species (Z=" + std::to_string(z[j]) + ", A=" + std::to_string(a[j]) + ") in " + path.string() + " is not in the species database.");
+            }
+            species.push_back(std::move(*sp));
+        }
+
+        // Composition order of the stored species
+        std::vector<std::size_t> order(nSpecies);
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&](const std::size_t lhs, const std::size_t rhs) { return species[lhs] < species[rhs]; });
+        std::vector<std::uint32_t> ids(nSpecies);
+        for (std::size_t j = 0; j < nSpecies; ++j) {
+            if (j > 0 && species[order[j]] == species[order[j - 1]]) {
+                throw CompositionIOError("Species " + std::string(species[order[j]].name()) + " appears twice in " + path.string() + ".");
+            }
+            ids[j] = utils::CompositionHash::pack_species_id(species[order[j]]);
+        }
+        m_schema = species_schema_from_ids(ids);
+
+        const NpyArray& matrix = m_npz.at("molar_abundances");
+        const auto& shape = matrix.shape();
+        if (!((shape.size() == 2 && shape[1] == nSpecies) || (shape.size() == 1 && shape[0] == nSpecies))) {
+            throw CompositionIOError("Array 'molar_abundances' of " + path.string() + " must have shape (zones, " + std::to_string(nSpecies) + ").");
+        }
+        m_zones = shape.size() == 2 ? shape[0] : 1;
+
+        const bool sorted = std::ranges::is_sorted(order);
+        const bool aligned = reinterpret_cast<std::uintptr_t>(matrix.data().data()) % alignof(double) == 0;
+        if (sorted && aligned && !matrix.fortran_order()) {
+            m_abundances = matrix.values<double>();
+            return;
+        }
+
+        if (matrix.descr() != npy_descr<double>()) {
+            throw CompositionIOError("Array 'molar_abundances' of " + path.string() + " must hold float64 values, got " + matrix.descr() + ".");
+        }
+        m_owned.resize(m_zones * nSpecies);
+        const std::byte* raw = matrix.data().data();
+        for (std::size_t i = 0; i < m_zones; ++i) {
+            for (std::size_t j = 0; j < nSpecies; ++j) {
+                const std::size_t source = matrix.fortran_order() ? order[j] * m_zones + i : i * nSpecies + order[j];
+                std::memcpy(&m_owned[i * nSpecies + j], raw + source * sizeof(double), sizeof(double));
+            }
+        }
+        m_abundances = m_owned;
+    }
+
+    CompositionView CompositionNpz::zone(const std::size_t zone) const {
+        if (zone >= m_zones) {
+            throw std::out_of_range("Zone " + std::to_string(zone) + " is out of range for a batch of " + std::to_string(m_zones) + " zones.");
+        }
+        const std::size_t nSpecies = m_schema->size();
+        return {m_schema, m_abundances.subspan(zone * nSpecies, nSpecies)};
+    }
+}
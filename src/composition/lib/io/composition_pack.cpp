@@ -0,0 +1,234 @@
+#include "fourdst/composition/io/composition_pack.h"
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/composition/utils/composition_hash.h"
+
+#include "binary_layout.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace fourdst::composition::io;
+    using namespace fourdst::composition::io::detail;
+    using fourdst::composition::exceptions::CompositionIOError;
+    using fourdst::composition::utils::CompositionHash;
+
+    std::size_t abundance_offset(const std::size_t speciesCount, const PackSchema schema) noexcept {
+        const std::size_t tableSize = schema == PackSchema::INLINE ? speciesCount * sizeof(std::uint32_t) : 0;
+        return align_up(sizeof(CompositionPackHeader) + tableSize, sizeof(double));
+    }
+
+    std::size_t message_size(const std::size_t speciesCount, const std::size_t zoneCount, const PackSchema schema) noexcept {
+        return abundance_offset(speciesCount, schema) + zoneCount * speciesCount * sizeof(double);
+    }
+
+    void check_buffer(const std::span<std::byte> buffer, const std::size_t required) {
+        if (buffer.size() < required) {
+            throw CompositionIOError(
+                "Buffer of " + std::to_string(buffer.size()) + " bytes is too small to pack " +
+                std::to_string(required) + " bytes of compositions."
+            );
+        }
+    }
+
+    /**
+     * Writes the header and, for INLINE messages, the species table. Returns the abundance offset.
+     */
+    std::size_t pack_schema(
+        const std::vector<fourdst::atomic::Species>& species,
+        const std::size_t zoneCount,
+        const std::span<std::byte> buffer,
+        const PackSchema schema
+    ) {
+        std::byte* out = buffer.data();
+        store_le<std::uint32_t>(out + offsetof(CompositionPackHeader, magic), kCompositionPackMagic);
+        store_le<std::uint16_t>(out + offsetof(CompositionPackHeader, version), kCompositionPackVersion);
+        store_le<std::uint16_t>(out + offsetof(CompositionPackHeader, schema), static_cast<std::uint16_t>(schema));
+        store_le<std::uint64_t>(out + offsetof(CompositionPackHeader, schema_id), CompositionHash::hash_species_schema(species));
+        store_le<std::uint64_t>(out + offsetof(CompositionPackHeader, species_count), species.size());
+        store_le<std::uint64_t>(out + offsetof(CompositionPackHeader, zone_count), zoneCount);
+
+        const std::size_t offset = abundance_offset(species.size(), schema);
+        if (schema == PackSchema::INLINE) {
+            std::byte* table = out + sizeof(CompositionPackHeader);
+            for (std::size_t j = 0; j < species.size(); ++j) {
+                store_le<std::uint32_t>(table + j * sizeof(std::uint32_t), CompositionHash::pack_species_id(species[j]));
+            }
+            std::fill(table + species.size() * sizeof(std::uint32_t), out + offset, std::byte{0});
+        }
+        return offset;
+    }
+
+    bool same_schema(const std::vector<fourdst::atomic::Species>& a, const std::vector<fourdst::atomic::Species>& b) noexcept {
+        const auto id = [](const fourdst::atomic::Species& sp) { return CompositionHash::pack_species_id(sp); };
+        return std::ranges::equal(a, b, {}, id, id);
+    }
+
+    /**
+     * Resolves the species schema of a validated message.
+     */
+    std::shared_ptr<const std::vector<fourdst::atomic::Species>> message_schema(
+        const std::span<const std::byte> buffer,
+        const CompositionPackHeader& header
+    ) {
+        if (header.schema == static_cast<std::uint16_t>(PackSchema::INLINE)) {
+            const std::vector<std::uint32_t> ids = load_species_table(buffer.data() + sizeof(CompositionPackHeader), header.species_count, header.schema_id);
+            return species_schema_from_ids(ids);
+        }
+        if (header.species_count == 0) {
+            static const auto empty = std::make_shared<const std::vector<fourdst::atomic::Species>>();
+            return empty;
+        }
+        auto schema = find_species_schema(header.schema_id);
+        if (!schema || schema->size() != header.species_count) {
+            throw CompositionIOError(
+                "Packed compositions refer to unknown species schema " + std::to_string(header.schema_id) +
+                "; register it with register_species_schema or send the schema inline."
+            );
+        }
+        return schema;
+    }
+}
+
+namespace fourdst::composition::io {
+    std::uint64_t register_species_schema(const std::vector<atomic::Species> &species) {
+        std::vector<std::uint32_t> ids;
+        ids.reserve(species.size());
+        for (const auto& sp : species) {
+            ids.push_back(utils::CompositionHash::pack_species_id(sp));
+        }
+        (void)species_schema_from_ids(ids);
+        return utils::CompositionHash::hash_species_ids(ids);
+    }
+
+    std::size_t packed_size(const CompositionAbstract &composition, const PackSchema schema) noexcept {
+        return message_size(composition.size(), 1, schema);
+    }
+
+    std::size_t packed_size(const std::span<const Composition> zones, const PackSchema schema) noexcept {
+        return message_size(zones.empty() ? 0 : zones.front().size(), zones.size(), schema);
+    }
+
+    std::size_t pack_into(const CompositionAbstract &composition, const std::span<std::byte> buffer, const PackSchema schema) {
+        const std::size_t total = packed_size(composition, schema);
+        check_buffer(buffer, total);
+        const std::size_t offset = pack_schema(composition.getRegisteredSpecies(), 1, buffer, schema);
+        store_doubles_le(buffer.data() + offset, {composition.begin().getAbundanceIt(), composition.size()});
+        return total;
+    }
+
+    std::size_t pack_into(const std::span<const Composition> zones, const std::span<std::byte> buffer, const PackSchema schema) {
+        const std::size_t total = packed_size(zones, schema);
+        check_buffer(buffer, total);
+        if (zones.empty()) {
+            pack_schema({}, 0, buffer, schema);
+            return total;
+        }
+
+        const std::vector<atomic::Species>& species = zones.front().getRegisteredSpecies();
+        for (std::size_t k = 1; k < zones.size(); ++k) {
+            if (!same_schema(zones[k].getRegisteredSpecies(), species)) {
+                throw CompositionIOError("Zone " + std::to_string(k) + " does not share the species schema of the first zone and cannot be packed into the same message.");
+            }
+        }
+
+        const std::size_t offset = pack_schema(species, zones.size(), buffer, schema);
+        const std::size_t rowBytes = species.size() * sizeof(double);
+        for (std::size_t k = 0; k < zones.size(); ++k) {
+            store_doubles_le(buffer.data() + offset + k * rowBytes, {zones[k].begin().getAbundanceIt(), species.size()});
+        }
+        return total;
+    }
+
+    CompositionPackHeader read_pack_header(const std::span<const std::byte> buffer) {
+        if (buffer.size() < sizeof(CompositionPackHeader)) {
+            throw CompositionIOError("Buffer of " + std::to_string(buffer.size()) + " bytes is too small to hold a packed composition header.");
+        }
+        const std::byte* data = buffer.data();
+        CompositionPackHeader header;
+        header.magic = load_le<std::uint32_t>(data + offsetof(CompositionPackHeader, magic));
+        header.version = load_le<std::uint16_t>(data + offsetof(CompositionPackHeader, version));
+        header.schema = load_le<std::uint16_t>(data + offsetof(CompositionPackHeader, schema));
+        header.schema_id = load_le<std::uint64_t>(data + offsetof(CompositionPackHeader, schema_id));
+        header.species_count = load_le<std::uint64_t>(data + offsetof(CompositionPackHeader, species_count));
+        header.zone_count = load_le<std::uint64_t>(data + offsetof(CompositionPackHeader, zone_count));
+
+        if (header.magic != kCompositionPackMagic) {
+            throw CompositionIOError("Buffer does not contain packed compositions (bad magic number).");
+        }
+        if (header.version != kCompositionPackVersion) {
+            throw CompositionIOError("Unsupported packed composition version " + std::to_string(header.version) + ".");
+        }
+        if (header.schema != static_cast<std::uint16_t>(PackSchema::ID_ONLY) && header.schema != static_cast<std::uint16_t>(PackSchema::INLINE)) {
+            throw CompositionIOError("Unknown packed composition schema mode " + std::to_string(header.schema) + ".");
+        }
+        // Bound both counts by the buffer first so that the size computation cannot overflow
+        const std::size_t limit = buffer.size() / sizeof(std::uint32_t);
+        if (header.species_count > limit || header.zone_count > limit ||
+            (header.species_count > 0 && header.zone_count > limit / header.species_count) ||
+            message_size(header.species_count, header.zone_count, static_cast<PackSchema>(header.schema)) > buffer.size()) {
+            throw CompositionIOError(
+                "Packed message of " + std::to_string(buffer.size()) + " bytes is too small for " + std::to_string(header.zone_count) +
+                " zones of " + std::to_string(header.species_count) + " species."
+            );
+        }
+        return header;
+    }
+
+    Composition unpack_from(const std::span<const std::byte> buffer) {
+        const CompositionPackHeader header = read_pack_header(buffer);
+        if (header.zone_count != 1) {
+            throw CompositionIOError("Expected a packed message with one zone, got " + std::to_string(header.zone_count) + ".");
+        }
+        const auto schema = message_schema(buffer, header);
+        std::vector<double> abundances(header.species_count);
+        load_doubles_le(buffer.data() + abundance_offset(header.species_count, static_cast<PackSchema>(header.schema)), abundances);
+        return {*schema, abundances};
+    }
+
+    std::vector<Composition> unpack_zones_from(const std::span<const std::byte> buffer) {
+        const CompositionPackHeader header = read_pack_header(buffer);
+        const auto schema = message_schema(buffer, header);
+        const std::byte* data = buffer.data() + abundance_offset(header.species_count, static_cast<PackSchema>(header.schema));
+
+        std::vector<Composition> zones;
+        zones.reserve(header.zone_count);
+        std::vector<double> abundances(header.species_count);
+        for (std::size_t k = 0; k < header.zone_count; ++k) {
+            load_doubles_le(data + k * header.species_count * sizeof(double), abundances);
+            if (k == 0) {
+                zones.emplace_back(*schema, abundances);
+            } else { // Copying the first zone reuses its sorted species instead of sorting them again
+                zones.push_back(zones.front());
+                zones.back().setMolarAbundance(*schema, abundances);
+            }
+        }
+        return zones;
+    }
+
+    void unpack_into(const std::span<const std::byte> buffer, const std::span<Composition> zones) {
+        const CompositionPackHeader header = read_pack_header(buffer);
+        if (header.zone_count != zones.size()) {
+            throw CompositionIOError(
+                "Packed message holds " + std::to_string(header.zone_count) + " zones but " +
+                std::to_string(zones.size()) + " target compositions were given."
+            );
+        }
+        const auto schema = message_schema(buffer, header);
+        const std::byte* data = buffer.data() + abundance_offset(header.species_count, static_cast<PackSchema>(header.schema));
+
+        std::vector<double> abundances(header.species_count);
+        for (std::size_t k = 0; k < zones.size(); ++k) {
+            load_doubles_le(data + k * header.species_count * sizeof(double), abundances);
+            if (same_schema(zones[k].getRegisteredSpecies(), *schema)) {
+                zones[k].setMolarAbundance(*schema, abundances);
+            } else {
+                zones[k] = Composition(*schema, abundances);
+            }
+        }
+    }
+}
@@ -0,0 +1,286 @@
+#include "fourdst/composition/io/composition_text.h"
+#include "fourdst/composition/io/mapped_file.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/composition/utils/utils.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    using fourdst::composition::exceptions::CompositionIOError;
+
+    constexpr std::size_t kSymbolColumn = 8; // abundances start in this column for symbols shorter than it
+
+    /**
+     * One parsed line. Zone lines have no species and carry the declared species count.
+     */
+    struct Entry {
+        const fourdst::atomic::Species* species = nullptr;
+        double y = 0.0;
+        std::size_t zoneSpecies = 0;
+        std::size_t offset = 0; ///< Byte offset of the line, for error messages.
+    };
+
+    struct ChunkResult {
+        std::vector<Entry> entries;
+        std::deque<fourdst::atomic::Species> species; ///< Species resolved by this chunk; entries point into it.
+        std::exception_ptr error;
+    };
+
+    std::size_t line_number(const std::string_view text, const std::size_t offset) {
+        return static_cast<std::size_t>(std::count(text.begin(), text.begin() + static_cast<std::ptrdiff_t>(offset), '\n')) + 1;
+    }
+
+    [[noreturn]] void throw_parse_error(const std::string_view text, const std::size_t offset, const std::string& what) {
+        throw CompositionIOError("Composition text line " + std::to_string(line_number(text, offset)) + ": " + what);
+    }
+
+    constexpr bool is_blank(const char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    /**
+     * Parses the lines in [begin, end) of `text`. `begin` must be the start of a line.
+     */
+    void parse_chunk(const std::string_view text, const std::size_t begin, const std::size_t end, ChunkResult& result) {
+        std::unordered_map<std::string_view, const fourdst::atomic::Species*> symbols;
+        result.entries.reserve((end - begin) / 16);
+
+        const char* const base = text.data();
+        std::size_t pos = begin;
+        while (pos < end) {
+            const std::size_t lineStart = pos;
+            const char* lineEnd = static_cast<const char*>(std::memchr(base + pos, '\n', end - pos));
+            const std::size_t next = lineEnd ? static_cast<std::size_t>(lineEnd - base) + 1 : end;
+            const char* p = base + pos;
+            const char* const last = lineEnd ? lineEnd : base + end;
+            pos = next;
+
+            while (p < last && is_blank(*p)) {
+                ++p;
+            }
+            if (p == last || *p == '#') {
+                continue;
+            }
+
+            const char* tokenEnd = p;
+            while (tokenEnd < last && !is_blank(*tokenEnd)) {
+                ++tokenEnd;
+            }
+            const std::string_view token(p, static_cast<std::size_t>(tokenEnd - p));
+            p = tokenEnd;
+            while (p < last && is_blank(*p)) {
+                ++p;
+            }
+
+            Entry entry;
+            entry.offset = lineStart;
+            if (token == "zone") {
+                const auto [ptr, ec] = std::from_chars(p, last, entry.zoneSpecies);
+                if (ec != std::errc{}) {
+                    throw_parse_error(text, lineStart, "expected a species count after 'zone'.");
+                }
+                p = ptr;
+            } else {
+                auto it = symbols.find(token);
+                if (it == symbols.end()) {
+                    auto species = fourdst::composition::getSpecies(token);
+                    if (!species) {
+                        throw fourdst::composition::exceptions::UnknownSymbolError(
+                            "Symbol " + std::string(token) + " on composition text line " + std::to_string(line_number(text, lineStart)) +
+                            " is not a valid species symbol (not in the species database)"
+                        );
+                    }
+                    it = symbols.emplace(token, &result.species.emplace_back(std::move(*species))).first;
+                }
+                entry.species = it->second;
+
+                const auto [ptr, ec] = std::from_chars(p, last, entry.y);
+                if (ec != std::errc{}) {
+                    throw_parse_error(text, lineStart, "expected a molar abundance after '" + std::string(token) + "'.");
+                }
+                p = ptr;
+            }
+
+            while (p < last && is_blank(*p)) {
+                ++p;
+            }
+            if (p != last) {
+                throw_parse_error(text, lineStart, "unexpected trailing characters.");
+            }
+            result.entries.push_back(entry);
+        }
+    }
+}
+
+namespace fourdst::composition::io {
+    void append_composition_text(std::string &out, const CompositionAbstract &composition) {
+        out.reserve(out.size() + 16 + composition.size() * (kSymbolColumn + 26));
+        out += "zone ";
+        out += std::to_string(composition.size());
+        out += '\n';
+
+        std::array<char, 32> buffer{}; // the shortest representation of a double is at most 24 characters
+        for (const auto& [species, y] : composition) {
+            const std::string_view name = species.name();
+            out += name;
+            out.append(name.size() < kSymbolColumn ? kSymbolColumn - name.size() : 1, ' ');
+            const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), y);
+            out.append(buffer.data(), result.ptr);
+            out += '\n';
+        }
+    }
+
+    std::string to_composition_text(const std::span<const Composition> zones) {
+        std::string out(kCompositionTextHeader);
+        out += '\n';
+        for (const auto& zone : zones) {
+            append_composition_text(out, zone);
+        }
+        return out;
+    }
+
+    std::string to_composition_text(const CompositionAbstract &composition) {
+        std::string out(kCompositionTextHeader);
+        out += '\n';
+        append_composition_text(out, composition);
+        return out;
+    }
+
+    void write_composition_text(const std::filesystem::path &path, const std::span<const Composition> zones) {
+        const std::string text = to_composition_text(zones);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw CompositionIOError("Unable to open composition text file " + path.string() + " for writing.");
+        }
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        if (!out) {
+            throw CompositionIOError("Unable to write composition text file " + path.string() + ".");
+        }
+    }
+
+    std::vector<Composition> parse_composition_text(const std::string_view text, const TextParseOptions &options) {
+        const std::size_t headerEnd = std::min(text.find('\n'), text.size());
+        std::string_view header = text.substr(0, headerEnd);
+        if (header.ends_with('\r')) {
+            header.remove_suffix(1);
+        }
+        if (header != kCompositionTextHeader) {
+            throw CompositionIOError("Composition text must start with the line '" + std::string(kCompositionTextHeader) + "'.");
+        }
+        const std::size_t bodyStart = std::min(headerEnd + 1, text.size());
+        const std::size_t bodySize = text.size() - bodyStart;
+
+        // Split the body into line aligned chunks
+        std::size_t threads = options.threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : options.threads;
+        threads = std::max<std::size_t>(1, std::min(threads, bodySize / std::max<std::size_t>(options.min_chunk_bytes, 1)));
+        std::vector<std::size_t> bounds = {bodyStart};
+        for (std::size_t i = 1; i < threads; ++i) {
+            std::size_t split = std::max(bodyStart + bodySize * i / threads, bounds.back());
+            const std::size_t newline = text.find('\n', split);
+            split = newline == std::string_view::npos ? text.size() : newline + 1;
+            if (split > bounds.back() && split < text.size()) {
+                bounds.push_back(split);
+            }
+        }
+        bounds.push_back(text.size());
+
+        std::vector<ChunkResult> chunks(bounds.size() - 1);
+        const auto parse = [&](const std::size_t i) {
+            try {
+                parse_chunk(text, bounds[i], bounds[i + 1], chunks[i]);
+            } catch (...) {
+                chunks[i].error = std::current_exception();
+            }
+        };
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks.size() - 1);
+            for (std::size_t i = 1; i < chunks.size(); ++i) {
+                workers.emplace_back(parse, i);
+            }
+            parse(0);
+        }
+        for (const auto& chunk : chunks) {
+            if (chunk.error) {
+                std::rethrow_exception(chunk.error);
+            }
+        }
+
+        // Assemble zones; a zone may span chunk boundaries. Composition has no move constructor, so
+        // reserve up front to avoid copying every zone when the vector grows.
+        std::size_t zoneCount = 0;
+        for (const auto& chunk : chunks) {
+            zoneCount += static_cast<std::size_t>(std::ranges::count(chunk.entries, nullptr, &Entry::species));
+        }
+        std::vector<Composition> zones;
+        zones.reserve(zoneCount);
+        std::vector<const atomic::Species*> species;
+        std::vector<double> abundances;
+        std::size_t expected = 0;
+        std::size_t zoneOffset = 0;
+        bool inZone = false;
+        const auto finishZone = [&] {
+            if (species.size() != expected) {
+                throw_parse_error(text, zoneOffset, "zone declares " + std::to_string(expected) + " species but lists " + std::to_string(species.size()) + ".");
+            }
+            // Zones usually share one schema. Copying the previous zone then only copies its (already
+            // sorted) species once, where the species constructor would copy and sort them again.
+            if (!zones.empty() && std::ranges::equal(zones.back().getRegisteredSpecies(), species, {}, {}, [](const atomic::Species* sp) -> const atomic::Species& { return *sp; })) {
+                zones.push_back(zones.back());
+                zones.back().setMolarAbundance(zones.back().getRegisteredSpecies(), abundances);
+            } else {
+                std::vector<atomic::Species> owned;
+                owned.reserve(species.size());
+                for (const atomic::Species* sp : species) {
+                    owned.push_back(*sp);
+                }
+                zones.emplace_back(owned, abundances);
+            }
+            species.clear();
+            abundances.clear();
+        };
+
+        for (const auto& chunk : chunks) {
+            for (const Entry& entry : chunk.entries) {
+                if (!entry.species) {
+                    if (inZone) {
+                        finishZone();
+                    }
+                    inZone = true;
+                    expected = entry.zoneSpecies;
+                    zoneOffset = entry.offset;
+                    species.reserve(expected);
+                    abundances.reserve(expected);
+                    continue;
+                }
+                if (!inZone) {
+                    throw_parse_error(text, entry.offset, "species listed before the first 'zone' line.");
+                }
+                species.push_back(entry.species);
+                abundances.push_back(entry.y);
+            }
+        }
+        if (inZone) {
+            finishZone();
+        }
+        return zones;
+    }
+
+    std::vector<Composition> read_composition_text(const std::filesystem::path &path, const TextParseOptions &options) {
+        const MappedFile file(path);
+        const std::span<const char> chars = file.chars();
+        return parse_composition_text({chars.data(), chars.size()}, options);
+    }
+}
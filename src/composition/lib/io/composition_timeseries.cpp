@@ -0,0 +1,523 @@
+#include "fourdst/composition/io/composition_timeseries.h"
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+
+#include "binary_layout.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace fourdst::composition::io::detail;
+    using fourdst::composition::exceptions::CompositionIOError;
+
+    using fourdst::composition::io::CompositionTimeSeriesHeader;
+
+    constexpr std::size_t kHeaderSize = sizeof(CompositionTimeSeriesHeader);
+    constexpr std::size_t kRecordPrefixSize = sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(double);
+    constexpr std::uint8_t kKeyframe = 0;
+    constexpr std::uint8_t kDelta = 1;
+
+    /**
+     * LSB-first bit packer; byte k of the output holds bits 8k..8k+7 of the stream.
+     */
+    class BitWriter {
+    public:
+        explicit BitWriter(std::vector<std::byte>& out) : m_out(out) {}
+
+        void write(std::uint64_t value, const unsigned count) {
+            if (count == 0) {
+                return;
+            }
+            if (count < 64) {
+                value &= (std::uint64_t{1} << count) - 1;
+            }
+            const unsigned space = 64 - m_used;
+            m_acc |= value << m_used;
+            if (count < space) {
+                m_used += count;
+                return;
+            }
+            emit(8);
+            m_acc = space < 64 ? value >> space : 0;
+            m_used = count - space;
+        }
+
+        void finish() {
+            emit((m_used + 7) / 8);
+            m_acc = 0;
+            m_used = 0;
+        }
+
+    private:
+        std::vector<std::byte>& m_out;
+        std::uint64_t m_acc = 0;
+        unsigned m_used = 0;
+
+        void emit(const unsigned bytes) {
+            for (unsigned i = 0; i < bytes; ++i) {
+                m_out.push_back(static_cast<std::byte>(m_acc >> (8 * i)));
+            }
+        }
+    };
+
+    class BitReader {
+    public:
+        explicit BitReader(const std::span<const std::byte> in) : m_in(in) {}
+
+        std::uint64_t read(const unsigned count) {
+            std::uint64_t result = 0;
+            unsigned got = 0;
+            while (got < count) {
+                if (m_avail == 0) {
+                    if (m_next >= m_in.size()) {
+                        throw CompositionIOError("Malformed composition time series: delta frame is truncated.");
+                    }
+                    m_acc = std::to_integer<std::uint64_t>(m_in[m_next++]);
+                    m_avail = 8;
+                }
+                const unsigned take = std::min(count - got, m_avail);
+                result |= (m_acc & ((std::uint64_t{1} << take) - 1)) << got;
+                m_acc >>= take;
+                m_avail -= take;
+                got += take;
+            }
+            return result;
+        }
+
+    private:
+        std::span<const std::byte> m_in;
+        std::size_t m_next = 0;
+        std::uint64_t m_acc = 0;
+        unsigned m_avail = 0;
+    };
+
+    struct EncoderWindow {
+        unsigned leading = 0;
+        unsigned trailing = 0;
+        bool valid = false;
+    };
+
+    // Gorilla XOR encoding of one changed value (xorBits != 0). A '0' control bit reuses the previous
+    // window of meaningful bits, a '1' is followed by 6 bits of leading zeros and 6 bits of length - 1.
+    void encode_xor(BitWriter& bits, const std::uint64_t xorBits, EncoderWindow& window) {
+        const auto leading = static_cast<unsigned>(std::countl_zero(xorBits));
+        const auto trailing = static_cast<unsigned>(std::countr_zero(xorBits));
+        if (window.valid && leading >= window.leading && trailing >= window.trailing) {
+            bits.write(0, 1);
+            bits.write(xorBits >> window.trailing, 64 - window.leading - window.trailing);
+            return;
+        }
+        const unsigned length = 64 - leading - trailing;
+        bits.write(1, 1);
+        bits.write(leading, 6);
+        bits.write(length - 1, 6);
+        bits.write(xorBits >> trailing, length);
+        window = {leading, trailing, true};
+    }
+
+    std::vector<std::byte> encode_header(const std::vector<fourdst::atomic::Species>& species, const std::size_t keyframeInterval) {
+        std::vector<std::byte> header(kHeaderSize + species.size() * sizeof(std::uint32_t));
+        const std::uint64_t schemaHash = store_species_table(header.data() + kHeaderSize, species);
+        store_le<std::uint64_t>(header.data() + offsetof(CompositionTimeSeriesHeader, magic), fourdst::composition::io::kCompositionTimeSeriesMagic);
+        store_le<std::uint16_t>(header.data() + offsetof(CompositionTimeSeriesHeader, version), fourdst::composition::io::kCompositionTimeSeriesVersion);
+        store_le<std::uint64_t>(header.data() + offsetof(CompositionTimeSeriesHeader, schema_hash), schemaHash);
+        store_le<std::uint64_t>(header.data() + offsetof(CompositionTimeSeriesHeader, species_count), species.size());
+        store_le<std::uint64_t>(header.data() + offsetof(CompositionTimeSeriesHeader, keyframe_interval), keyframeInterval);
+        return header;
+    }
+
+    [[noreturn]] void throw_malformed(const std::string& what) {
+        throw CompositionIOError("Malformed composition time series: " + what + ".");
+    }
+}
+
+namespace fourdst::composition::io {
+    CompositionTimeSeriesWriter::CompositionTimeSeriesWriter(
+        const std::filesystem::path &path,
+        const std::vector<atomic::Species> &species,
+        const TimeSeriesOptions options
+    ) :
+    m_species(species),
+    m_options(options) {
+        for (std::size_t j = 1; j < m_species.size(); ++j) {
+            if (!(m_species[j - 1] < m_species[j])) {
+                throw CompositionIOError("Time series species must be sorted and unique, got " + std::string(m_species[j].name()) + " after " + std::string(m_species[j - 1].name()) + ".");
+            }
+        }
+        start(path);
+    }
+
+    CompositionTimeSeriesWriter::CompositionTimeSeriesWriter(
+        const std::filesystem::path &path,
+        const CompositionAbstract &schema,
+        const TimeSeriesOptions options
+    ) :
+    m_species(schema.getRegisteredSpecies()),
+    m_options(options) {
+        start(path);
+    }
+
+    CompositionTimeSeriesWriter::~CompositionTimeSeriesWriter() {
+        try {
+            close();
+        } catch (...) { // NOLINT(bugprone-empty-catch) destructors must not throw; close() reports errors
+        }
+    }
+
+    void CompositionTimeSeriesWriter::start(const std::filesystem::path &path) {
+        if (m_options.keyframe_interval == 0 || m_options.max_pending == 0) {
+            throw CompositionIOError("Time series keyframe interval and buffer size must be positive.");
+        }
+
+        m_out.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_out) {
+            throw CompositionIOError("Unable to open composition time series " + path.string() + " for writing.");
+        }
+        const std::vector<std::byte> header = encode_header(m_species, m_options.keyframe_interval);
+        m_out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        if (!m_out) {
+            throw CompositionIOError("Unable to write composition time series header to " + path.string() + ".");
+        }
+
+        m_freeBuffers.assign(m_options.max_pending, std::vector<double>(m_species.size()));
+        m_worker = std::jthread([this] { run(); });
+    }
+
+    void CompositionTimeSeriesWriter::append(const double time, const std::span<const double> molarAbundances) {
+        (void)enqueue(time, molarAbundances, true);
+    }
+
+    void CompositionTimeSeriesWriter::append(const double time, const CompositionAbstract &composition) {
+        const auto& species = composition.getRegisteredSpecies();
+        if (species != m_species) {
+            throw exceptions::InvalidCompositionError("Composition species do not match the species schema of the time series.");
+        }
+        (void)enqueue(time, {composition.begin().getAbundanceIt(), species.size()}, true);
+    }
+
+    bool CompositionTimeSeriesWriter::try_append(const double time, const std::span<const double> molarAbundances) {
+        return enqueue(time, molarAbundances, false);
+    }
+
+    bool CompositionTimeSeriesWriter::enqueue(const double time, const std::span<const double> molarAbundances, const bool wait) {
+        if (molarAbundances.size() != m_species.size()) {
+            throw exceptions::InvalidCompositionError(
+                "Expected " + std::to_string(m_species.size()) + " molar abundances for the time series schema, got " +
+                std::to_string(molarAbundances.size()) + "."
+            );
+        }
+
+        std::unique_lock lock(m_mutex);
+        rethrow_error();
+        if (m_closing) {
+            throw CompositionIOError("Cannot append to a closed composition time series.");
+        }
+        if (m_freeBuffers.empty()) {
+            if (!wait) {
+                return false;
+            }
+            m_notFull.wait(lock, [this] { return !m_freeBuffers.empty() || m_error; });
+            rethrow_error();
+        }
+
+        std::vector<double> buffer = std::move(m_freeBuffers.back());
+        m_freeBuffers.pop_back();
+        std::ranges::copy(molarAbundances, buffer.begin());
+        m_pending.push_back({time, std::move(buffer)});
+        ++m_appended;
+        lock.unlock();
+        m_notEmpty.notify_one();
+        return true;
+    }
+
+    void CompositionTimeSeriesWriter::flush() {
+        std::unique_lock lock(m_mutex);
+        m_notFull.wait(lock, [this] { return (m_pending.empty() && m_inFlight == 0) || m_error; });
+        rethrow_error();
+    }
+
+    void CompositionTimeSeriesWriter::close() {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_closing = true;
+        }
+        m_notEmpty.notify_one();
+        if (m_worker.joinable()) {
+            m_worker.join();
+        }
+        std::scoped_lock lock(m_mutex);
+        rethrow_error();
+    }
+
+    void CompositionTimeSeriesWriter::rethrow_error() {
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    void CompositionTimeSeriesWriter::run() {
+        const std::size_t nSpecies = m_species.size();
+        std::vector<double> previous(nSpecies);
+        std::vector<EncoderWindow> windows(nSpecies);
+        std::vector<std::byte> record;
+        std::size_t frameIndex = 0;
+
+        while (true) {
+            Frame frame;
+            {
+                std::unique_lock lock(m_mutex);
+                m_notEmpty.wait(lock, [this] { return !m_pending.empty() || m_closing; });
+                if (m_pending.empty()) {
+                    break; // closing and drained
+                }
+                frame = std::move(m_pending.front());
+                m_pending.pop_front();
+                ++m_inFlight;
+            }
+
+            try {
+                const bool keyframe = frameIndex % m_options.keyframe_interval == 0;
+                record.assign(kRecordPrefixSize, std::byte{0});
+                record[sizeof(std::uint32_t)] = static_cast<std::byte>(keyframe ? kKeyframe : kDelta);
+                store_le<double>(record.data() + sizeof(std::uint32_t) + sizeof(std::uint8_t), frame.time);
+
+                if (keyframe) {
+                    record.resize(kRecordPrefixSize + nSpecies * sizeof(double));
+                    store_doubles_le(record.data() + kRecordPrefixSize, frame.abundances);
+                    std::ranges::fill(windows, EncoderWindow{});
+                } else {
+                    const std::size_t bitmapOffset = record.size();
+                    record.resize(bitmapOffset + (nSpecies + 7) / 8, std::byte{0});
+                    BitWriter bits(record);
+                    for (std::size_t j = 0; j < nSpecies; ++j) {
+                        const std::uint64_t xorBits = std::bit_cast<std::uint64_t>(frame.abundances[j]) ^ std::bit_cast<std::uint64_t>(previous[j]);
+                        if (xorBits == 0) {
+                            continue;
+                        }
+                        record[bitmapOffset + j / 8] |= static_cast<std::byte>(1u << (j % 8));
+                        encode_xor(bits, xorBits, windows[j]);
+                    }
+                    bits.finish();
+                }
+
+                if (record.size() - sizeof(std::uint32_t) > UINT32_MAX) {
+                    throw CompositionIOError("Composition time series frame is too large to encode.");
+                }
+                store_le<std::uint32_t>(record.data(), static_cast<std::uint32_t>(record.size() - sizeof(std::uint32_t)));
+                m_out.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+                if (!m_out) {
+                    throw CompositionIOError("Unable to write composition time series frame " + std::to_string(frameIndex) + ".");
+                }
+                previous.swap(frame.abundances);
+                ++frameIndex;
+            } catch (...) {
+                std::scoped_lock lock(m_mutex);
+                m_error = std::current_exception();
+                m_pending.clear();
+                m_inFlight = 0;
+                m_notFull.notify_all();
+                return;
+            }
+
+            bool idle;
+            {
+                std::scoped_lock lock(m_mutex);
+                idle = m_pending.empty();
+            }
+            if (idle) { // flush before reporting the frame as written so that flush() observes it on disk
+                m_out.flush();
+            }
+            {
+                std::scoped_lock lock(m_mutex);
+                m_freeBuffers.push_back(std::move(frame.abundances)); // holds the frame before last after the swap
+                --m_inFlight;
+            }
+            m_notFull.notify_all();
+        }
+
+        // A failed flush or close means the file is truncated; report it from close() like a failed frame write
+        m_out.flush();
+        const bool flushed = static_cast<bool>(m_out);
+        m_out.close();
+        if (!flushed || !m_out) {
+            std::scoped_lock lock(m_mutex);
+            m_error = std::make_exception_ptr(CompositionIOError(
+                "Unable to flush and close composition time series after " + std::to_string(frameIndex) + " frames."
+            ));
+        }
+    }
+
+    CompositionTimeSeriesReader::CompositionTimeSeriesReader(const std::filesystem::path &path) :
+    m_file(path) {
+        const std::span<const std::byte> bytes = m_file.bytes();
+        if (bytes.size() < kHeaderSize) {
+            throw_malformed("file is smaller than the header");
+        }
+        if (load_le<std::uint64_t>(bytes.data() + offsetof(CompositionTimeSeriesHeader, magic)) != kCompositionTimeSeriesMagic) {
+            throw_malformed("bad magic number");
+        }
+        if (const auto version = load_le<std::uint16_t>(bytes.data() + offsetof(CompositionTimeSeriesHeader, version)); version != kCompositionTimeSeriesVersion) {
+            throw_malformed("unsupported version " + std::to_string(version));
+        }
+        const auto nSpecies = load_le<std::uint64_t>(bytes.data() + offsetof(CompositionTimeSeriesHeader, species_count));
+        if (nSpecies > (bytes.size() - kHeaderSize) / sizeof(std::uint32_t)) {
+            throw_malformed("species count exceeds the file size");
+        }
+        m_schema = species_schema_from_ids(load_species_table(bytes.data() + kHeaderSize, nSpecies, load_le<std::uint64_t>(bytes.data() + offsetof(CompositionTimeSeriesHeader, schema_hash))));
+
+        std::size_t offset = kHeaderSize + nSpecies * sizeof(std::uint32_t);
+        while (offset < bytes.size()) {
+            if (bytes.size() - offset < kRecordPrefixSize) {
+                throw_malformed("frame " + std::to_string(m_records.size()) + " is truncated");
+            }
+            const std::size_t length = load_le<std::uint32_t>(bytes.data() + offset);
+            if (length < kRecordPrefixSize - sizeof(std::uint32_t) || bytes.size() - offset - sizeof(std::uint32_t) < length) {
+                throw_malformed("frame " + std::to_string(m_records.size()) + " has an invalid length");
+            }
+            const auto kind = std::to_integer<std::uint8_t>(bytes[offset + sizeof(std::uint32_t)]);
+            if (kind != kKeyframe && kind != kDelta) {
+                throw_malformed("frame " + std::to_string(m_records.size()) + " has unknown kind " + std::to_string(kind));
+            }
+            if (m_records.empty() && kind != kKeyframe) {
+                throw_malformed("the first frame is not a keyframe");
+            }
+            Record record;
+            record.offset = offset + kRecordPrefixSize;
+            record.length = length - (kRecordPrefixSize - sizeof(std::uint32_t));
+            record.keyframe = kind == kKeyframe;
+            record.time = load_le<double>(bytes.data() + offset + sizeof(std::uint32_t) + sizeof(std::uint8_t));
+            m_records.push_back(record);
+            offset += sizeof(std::uint32_t) + length;
+        }
+
+        m_current.assign(nSpecies, 0.0);
+        m_windows.assign(nSpecies, Window{});
+    }
+
+    std::vector<std::size_t> CompositionTimeSeriesReader::keyframes() const {
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < m_records.size(); ++i) {
+            if (m_records[i].keyframe) {
+                indices.push_back(i);
+            }
+        }
+        return indices;
+    }
+
+    bool CompositionTimeSeriesReader::next() {
+        const std::size_t frame = m_started ? m_position + 1 : 0;
+        if (frame >= m_records.size()) {
+            return false;
+        }
+        decode(frame);
+        return true;
+    }
+
+    void CompositionTimeSeriesReader::seek(const std::size_t frame) {
+        if (frame >= m_records.size()) {
+            throw std::out_of_range("Frame " + std::to_string(frame) + " is out of range for a time series of " + std::to_string(m_records.size()) + " frames.");
+        }
+        if (m_started && frame == m_position) {
+            return;
+        }
+
+        std::size_t start = frame;
+        while (!m_records[start].keyframe) { // the first frame is always a keyframe
+            --start;
+        }
+        if (m_started && m_position < frame && m_position >= start) {
+            start = m_position + 1; // continue replaying from the current frame
+        }
+        for (std::size_t i = start; i <= frame; ++i) {
+            decode(i);
+        }
+    }
+
+    std::size_t CompositionTimeSeriesReader::seek_time(const double time) {
+        if (m_records.empty()) {
+            throw std::out_of_range("Cannot seek in an empty composition time series.");
+        }
+        const auto it = std::ranges::upper_bound(m_records, time, {}, &Record::time);
+        const std::size_t frame = it == m_records.begin() ? 0 : static_cast<std::size_t>(std::distance(m_records.begin(), it)) - 1;
+        seek(frame);
+        return frame;
+    }
+
+    std::size_t CompositionTimeSeriesReader::position() const {
+        require_frame();
+        return m_position;
+    }
+
+    double CompositionTimeSeriesReader::time() const {
+        require_frame();
+        return m_records[m_position].time;
+    }
+
+    std::span<const double> CompositionTimeSeriesReader::molar_abundances() const {
+        require_frame();
+        return m_current;
+    }
+
+    CompositionView CompositionTimeSeriesReader::view() const {
+        require_frame();
+        return {m_schema, std::span<const double>(m_current)};
+    }
+
+    void CompositionTimeSeriesReader::decode(const std::size_t frame) {
+        const Record& record = m_records[frame];
+        const std::span<const std::byte> payload = m_file.bytes().subspan(record.offset, record.length);
+        const std::size_t nSpecies = m_current.size();
+
+        if (record.keyframe) {
+            if (payload.size() != nSpecies * sizeof(double)) {
+                throw_malformed("keyframe " + std::to_string(frame) + " has the wrong size");
+            }
+            load_doubles_le(payload.data(), m_current);
+            std::ranges::fill(m_windows, Window{});
+        } else {
+            if (!m_started || m_position + 1 != frame) {
+                throw std::logic_error("Delta frames must be decoded in order."); // guarded by seek()
+            }
+            const std::size_t bitmapSize = (nSpecies + 7) / 8;
+            if (payload.size() < bitmapSize) {
+                throw_malformed("delta frame " + std::to_string(frame) + " is truncated");
+            }
+            BitReader bits(payload.subspan(bitmapSize));
+            for (std::size_t j = 0; j < nSpecies; ++j) {
+                if ((std::to_integer<unsigned>(payload[j / 8]) >> (j % 8) & 1u) == 0) {
+                    continue;
+                }
+                Window& window = m_windows[j];
+                if (bits.read(1) != 0) {
+                    window.leading = static_cast<unsigned>(bits.read(6));
+                    const auto length = static_cast<unsigned>(bits.read(6)) + 1;
+                    if (window.leading + length > 64) {
+                        throw_malformed("delta frame " + std::to_string(frame) + " has an invalid XOR window");
+                    }
+                    window.trailing = 64 - window.leading - length;
+                    window.valid = true;
+                } else if (!window.valid) {
+                    throw_malformed("delta frame " + std::to_string(frame) + " reuses an undefined XOR window");
+                }
+                const std::uint64_t xorBits = bits.read(64 - window.leading - window.trailing) << window.trailing;
+                m_current[j] = std::bit_cast<double>(std::bit_cast<std::uint64_t>(m_current[j]) ^ xorBits);
+            }
+        }
+
+        m_position = frame;
+        m_started = true;
+    }
+
+    void CompositionTimeSeriesReader::require_frame() const {
+        if (!m_started) {
+            throw std::logic_error("No current frame; call next() or seek() first.");
+        }
+    }
+}
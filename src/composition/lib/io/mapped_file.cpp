@@ -0,0 +1,77 @@
+#include "fourdst/composition/io/mapped_file.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    // `error` is the errno of the failed call, saved before any cleanup can overwrite it
+    [[noreturn]] void throw_io_error(const std::filesystem::path& path, const std::string& what, const int error) {
+        throw fourdst::composition::exceptions::CompositionIOError(
+            "Unable to " + what + " file " + path.string() + ": " + std::strerror(error)
+        );
+    }
+}
+
+namespace fourdst::composition::io {
+    MappedFile::MappedFile(const std::filesystem::path &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw_io_error(path, "open", errno);
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw_io_error(path, "stat", error);
+        }
+
+        m_size = static_cast<std::size_t>(st.st_size);
+        if (m_size == 0) { // mmap rejects zero length mappings, an empty file is simply an empty span
+            ::close(fd);
+            return;
+        }
+
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        ::close(fd); // The mapping holds its own reference to the file
+        if (data == MAP_FAILED) {
+            m_size = 0;
+            throw_io_error(path, "map", error);
+        }
+        m_data = data;
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept :
+    m_data(std::exchange(other.m_data, nullptr)),
+    m_size(std::exchange(other.m_size, 0)) {}
+
+    MappedFile & MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    void MappedFile::release() noexcept {
+        if (m_data != nullptr) {
+            ::munmap(m_data, m_size);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#include "fourdst/composition/io/shared_composition_segment.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    using fourdst::composition::exceptions::CompositionIOError;
+
+    [[noreturn]] void throw_segment_error(const std::string& name, const std::string& what) {
+        throw CompositionIOError("Unable to " + what + " shared composition segment " + name + ": " + std::strerror(errno));
+    }
+
+    void validate_name(const std::string& name) {
+        if (name.size() < 2 || name.size() > 255 || name.front() != '/' || name.find('/', 1) != std::string::npos) {
+            throw CompositionIOError("Invalid shared composition segment name '" + name + "': expected '/' followed by 1 to 254 characters other than '/'.");
+        }
+    }
+
+    // The magic number is the first field of the archive and is only written once the rest of the
+    // archive is in place, so it doubles as the publication flag of the segment.
+    std::atomic_ref<std::uint64_t> magic_of(void* data) noexcept {
+        return std::atomic_ref(*static_cast<std::uint64_t*>(data));
+    }
+}
+
+namespace fourdst::composition::io {
+    SharedCompositionSegment SharedCompositionSegment::create(
+        const std::string &name,
+        const std::span<const Composition> zones,
+        const std::span<const double> coordinates,
+        const ArchiveLayout layout
+    ) {
+        return create(name, build_composition_archive(zones, coordinates, layout));
+    }
+
+    SharedCompositionSegment SharedCompositionSegment::create(const std::string &name, const std::span<const std::byte> archive) {
+        validate_name(name);
+        // Validate before anything becomes visible to other processes
+        (void)CompositionArchive(archive);
+
+        const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            throw_segment_error(name, "create");
+        }
+        if (::ftruncate(fd, static_cast<off_t>(archive.size())) != 0) {
+            const int error = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            errno = error;
+            throw_segment_error(name, "size");
+        }
+        void* data = ::mmap(nullptr, archive.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd); // The mapping holds its own reference to the segment
+        if (data == MAP_FAILED) {
+            const int error = errno;
+            ::shm_unlink(name.c_str());
+            errno = error;
+            throw_segment_error(name, "map");
+        }
+        SharedCompositionSegment segment(name, data, archive.size(), true);
+
+        constexpr std::size_t magicSize = sizeof(std::uint64_t);
+        std::memcpy(static_cast<std::byte*>(data) + magicSize, archive.data() + magicSize, archive.size() - magicSize);
+        std::uint64_t magic;
+        std::memcpy(&magic, archive.data(), magicSize);
+        magic_of(data).store(magic, std::memory_order_release);
+        ::mprotect(data, archive.size(), PROT_READ);
+
+        segment.m_archive.emplace(std::span<const std::byte>(static_cast<const std::byte*>(data), archive.size()));
+        return segment;
+    }
+
+    SharedCompositionSegment SharedCompositionSegment::attach(const std::string &name) {
+        validate_name(name);
+        const int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+        if (fd < 0) {
+            throw_segment_error(name, "open");
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            const int error = errno;
+            ::close(fd);
+            errno = error;
+            throw_segment_error(name, "stat");
+        }
+        const auto size = static_cast<std::size_t>(st.st_size);
+        if (size < sizeof(CompositionArchiveHeader)) { // Created, but not yet sized by its owner
+            ::close(fd);
+            throw CompositionIOError("Shared composition segment " + name + " has not been published yet.");
+        }
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw_segment_error(name, "map");
+        }
+        SharedCompositionSegment segment(name, data, size, false);
+
+        if (magic_of(data).load(std::memory_order_acquire) == 0) {
+            throw CompositionIOError("Shared composition segment " + name + " has not been published yet.");
+        }
+        segment.m_archive.emplace(std::span<const std::byte>(static_cast<const std::byte*>(data), size));
+        return segment;
+    }
+
+    bool SharedCompositionSegment::remove(const std::string &name) noexcept {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+    SharedCompositionSegment::SharedCompositionSegment(std::string name, void* data, const std::size_t size, const bool ownsName) :
+    m_name(std::move(name)),
+    m_data(data),
+    m_size(size),
+    m_ownsName(ownsName) {}
+
+    SharedCompositionSegment::~SharedCompositionSegment() {
+        release();
+    }
+
+    SharedCompositionSegment::SharedCompositionSegment(SharedCompositionSegment &&other) noexcept :
+    m_name(std::move(other.m_name)),
+    m_data(std::exchange(other.m_data, nullptr)),
+    m_size(std::exchange(other.m_size, 0)),
+    m_ownsName(std::exchange(other.m_ownsName, false)),
+    m_archive(std::move(other.m_archive)) {
+        other.m_archive.reset();
+    }
+
+    SharedCompositionSegment & SharedCompositionSegment::operator=(SharedCompositionSegment &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_name = std::move(other.m_name);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_ownsName = std::exchange(other.m_ownsName, false);
+            m_archive = std::move(other.m_archive);
+            other.m_archive.reset();
+        }
+        return *this;
+    }
+
+    void SharedCompositionSegment::release() noexcept {
+        m_archive.reset();
+        if (m_data != nullptr) {
+            ::munmap(m_data, m_size);
+            m_data = nullptr;
+            m_size = 0;
+        }
+        if (m_ownsName) {
+            ::shm_unlink(m_name.c_str());
+            m_ownsName = false;
+        }
+    }
+}
@@ -1,17 +1,25 @@
 #include "fourdst/composition/io/standard_compositions.h"
 #include "fourdst/composition/io/StandardMetalFractionsBinary.h"
+#include "fourdst/composition/io/mapped_file.h"
 
 #include "fourdst/composition/composition.h"
 #include "fourdst/atomic/atomicSpecies.h"
 #include "fourdst/atomic/species.h"
+#include "fourdst/atomic/species_table.h"
 #include "../../include/fourdst/composition/utils/utils.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
-#include <fstream>
+#include <charconv>
+#include <cmath>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <system_error>
 #include <unordered_map>
 #include <print>
 #include <ranges>
@@ -19,232 +27,381 @@
 
 namespace {
     /**
-     * @brief Removes leading whitespace from a string in-place.
+     * @brief Checks whether a character is whitespace in the "C" locale.
      *
-     * Uses `std::ranges::find_if` with an `std::isspace` predicate to locate the
-     * first non-whitespace character, then erases all characters before that position.
+     * @param ch Character to test.
+     * @return `true` for space, tab, newline, carriage return, vertical tab and form feed.
+     */
+    constexpr bool is_space(const char ch) noexcept {
+        return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\v' || ch == '\f';
+    }
+
+    /**
+     * @brief Removes leading and trailing whitespace from a view.
      *
-     * @param[in,out] s String to modify.
+     * @param s View to trim.
+     * @return The trimmed sub-view of `s`.
      */
-    void ltrim(std::string &s) {
-        s.erase(
-            s.begin(),
-            std::ranges::find_if(s,
-                                 [](const unsigned char ch) {
-                                     return !std::isspace(ch);
-                                 })
-         );
+    constexpr std::string_view trim(std::string_view s) noexcept {
+        while (!s.empty() && is_space(s.front())) {
+            s.remove_prefix(1);
+        }
+        while (!s.empty() && is_space(s.back())) {
+            s.remove_suffix(1);
+        }
+        return s;
     }
 
     /**
-     * @brief Removes trailing whitespace from a string in-place.
+     * @brief Pops the next line (without its terminating newline) off the front of a view.
      *
-     * Iterates in reverse via a reverse iterator pair and `std::find_if` with an
-     * `std::isspace` predicate to locate the last non-whitespace character, then
-     * erases everything after it.
+     * @param[in,out] rest Remaining unread data; advanced past the returned line.
+     * @return The next line.
+     */
+    constexpr std::string_view next_line(std::string_view& rest) noexcept {
+        const size_t eol = rest.find('\n');
+        const std::string_view line = rest.substr(0, eol);
+        rest.remove_prefix(eol == std::string_view::npos ? rest.size() : eol + 1);
+        return line;
+    }
+
+    /**
+     * @brief Extracts the value of a `KEY: [value]` line.
      *
-     * @param[in,out] s String to modify.
+     * Everything up to and including the first colon is dropped, then surrounding
+     * whitespace and the enclosing list brackets are stripped.
+     *
+     * @param line Line to process.
+     * @return The value portion of the line.
      */
-    void rtrim(std::string &s) {
-        s.erase(
-            std::find_if(
-                s.rbegin(),
-                s.rend(),
-                [](const unsigned char ch) {
-                    return !std::isspace(ch);
-                }).base(),
-                s.end()
-            );
+    constexpr std::string_view field_value(std::string_view line) noexcept {
+        if (const size_t colon_pos = line.find(':'); colon_pos != std::string_view::npos) {
+            line.remove_prefix(colon_pos + 1);
+        }
+        line = trim(line);
+        if (!line.empty() && line.front() == '[') {
+            line.remove_prefix(1);
+        }
+        if (!line.empty() && line.back() == ']') {
+            line.remove_suffix(1);
+        }
+        return trim(line);
     }
 
     /**
-     * @brief Removes both leading and trailing whitespace from a string in-place.
+     * @brief Calls `f` with every trimmed comma separated item in a list value.
      *
-     * Delegates to ltrim() then rtrim() in sequence.
+     * A single trailing comma (e.g. `Li,Be,B,`) does not produce an empty item.
      *
-     * @param[in,out] s String to modify.
+     * @param list List value as returned by field_value().
+     * @param f Callable invoked with each item as a `std::string_view`.
      */
-    void trim(std::string &s) {
-        ltrim(s);
-        rtrim(s);
+    template <typename Func>
+    void for_each_item(std::string_view list, Func&& f) {
+        while (!list.empty()) {
+            const size_t comma = list.find(',');
+            f(trim(list.substr(0, comma)));
+            if (comma == std::string_view::npos) {
+                break;
+            }
+            list.remove_prefix(comma + 1);
+        }
     }
 
+    /**
+     * @brief Converts a token to a number with `std::from_chars`.
+     *
+     * @param token Token to convert; must be fully consumed.
+     * @return The parsed value.
+     * @throws std::invalid_argument If the token is not a valid number.
+     * @throws std::out_of_range If the value does not fit in `T`.
+     */
+    template <typename T>
+    T to_number(std::string_view token) {
+        if (!token.empty() && token.front() == '+') { // from_chars does not accept an explicit plus sign
+            token.remove_prefix(1);
+        }
+        T value{};
+        const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (ec == std::errc::result_out_of_range) {
+            throw std::out_of_range("Numeric field '" + std::string(token) + "' is out of range");
+        }
+        if (ec != std::errc() || ptr != token.data() + token.size()) {
+            throw std::invalid_argument("Unable to parse numeric field '" + std::string(token) + "'");
+        }
+        return value;
+    }
 
     /**
      * @brief Converts a string to a boolean value, case-insensitively.
      *
-     * Lower-cases every character via `std::ranges::transform` and returns `true`
-     * only when the resulting string is exactly `"true"`.  All other inputs
-     * (including `"1"`, `"yes"`, empty string) return `false`.
-     *
      * @param s String to interpret (e.g., `"true"`, `"True"`, `"TRUE"`, `"false"`).
-     * @return `true` if the lower-cased string equals `"true"`, `false` otherwise.
+     * @return `true` if the string equals `"true"` ignoring case, `false` otherwise.
      */
-    bool to_bool(std::string s) {
-        std::ranges::transform(s, s.begin(),
-                               [](const unsigned char c){ return std::tolower(c); });
-
-        return s == "true";
+    bool to_bool(const std::string_view s) {
+        constexpr std::string_view expected = "true";
+        return std::ranges::equal(s, expected, [](const unsigned char a, const unsigned char b) {
+            return std::tolower(a) == b;
+        });
     }
 
-}
+    /**
+     * @brief Parses the body of a composition block.
+     *
+     * The body lines are, in order: comment, log10 He abundance, atomic-weight flag,
+     * element list and log10 abundance list.
+     *
+     * @param body Lines between the `BEGIN` and `END` sentinels.
+     * @return The populated composition data.
+     */
+    fourdst::composition::io::CompositionData parse_composition_block(std::string_view body) {
+        fourdst::composition::io::CompositionData comp{};
+
+        for (int field = 1; field <= 5 && !body.empty(); ++field) {
+            const std::string_view value = field_value(next_line(body));
+            switch (field) {
+                case 1:
+                    comp.comment_str = value;
+                    std::erase_if(comp.comment_str, [](const char c) { return c == '[' || c == ']'; });
+                    break;
+                case 2:
+                    comp.he_abundance = std::pow(10.0, to_number<double>(value));
+                    break;
+                case 3:
+                    comp.requires_atomic_weight = to_bool(value);
+                    break;
+                case 4:
+                    for_each_item(value, [&](const std::string_view item) {
+                        comp.elements.emplace_back(item);
+                    });
+                    break;
+                case 5:
+                    for_each_item(value, [&](const std::string_view item) {
+                        comp.abundances.push_back(std::pow(10.0, to_number<double>(item)));
+                    });
+                    break;
+                default:
+                    break;
+            }
+        }
+        return comp;
+    }
 
-namespace fourdst:: composition::io {
-    std::span<const unsigned char> get_raw_standard_solar_composition_data() {
-        return StandardMetalFractions;
+    /**
+     * @brief Parses the body of an isotopic-percentage block.
+     *
+     * The body lines are, in order: comment, atomic numbers, element symbols, mass
+     * numbers and isotopic percentages.
+     *
+     * @param body Lines between the `BEGIN` and `END` sentinels.
+     * @return The populated isotopic percentage table.
+     */
+    fourdst::composition::io::IsotopicPercentage parse_isotopic_block(std::string_view body) {
+        fourdst::composition::io::IsotopicPercentage iso{};
+
+        for (int field = 1; field <= 5 && !body.empty(); ++field) {
+            const std::string_view value = field_value(next_line(body));
+            switch (field) {
+                case 1:
+                    iso.comment_str = value;
+                    std::erase_if(iso.comment_str, [](const char c) { return c == '[' || c == ']'; });
+                    break;
+                case 2:
+                    for_each_item(value, [&](const std::string_view item) {
+                        iso.atomic_numbers.push_back(to_number<int>(item));
+                    });
+                    break;
+                case 3:
+                    for_each_item(value, [&](const std::string_view item) {
+                        iso.elements.emplace_back(item);
+                    });
+                    break;
+                case 4:
+                    for_each_item(value, [&](const std::string_view item) {
+                        iso.mass_numbers.push_back(to_number<int>(item));
+                    });
+                    break;
+                case 5:
+                    for_each_item(value, [&](const std::string_view item) {
+                        iso.percentages.push_back(to_number<double>(item));
+                    });
+                    break;
+                default:
+                    break;
+            }
+        }
+        return iso;
     }
 
-    CompositionData ChemicalFileParser::parse_composition_data(const std::vector<char>& data,const std::string& scheme) {
+    /**
+     * @brief A user registered abundance source together with the storage backing its index.
+     */
+    struct RegisteredSource {
+        std::vector<char> buffer; ///< Owned data for in-memory sources.
+        std::optional<fourdst::composition::io::MappedFile> file; ///< Mapping for file sources.
+        fourdst::composition::io::ChemicalFileParser parser; ///< Index over `buffer` or `file`.
+    };
 
-        std::istringstream stream(std::string(data.begin(), data.end()));
+    /**
+     * @brief Process wide registry of user abundance sources.
+     */
+    struct SourceRegistry {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<const RegisteredSource>> sources;
+    };
+
+    SourceRegistry& registry() {
+        static SourceRegistry instance;
+        return instance;
+    }
 
-        // add error message if something goes wrong
+    /**
+     * @brief Gets the (lazily built) index over the embedded standard solar data.
+     */
+    const fourdst::composition::io::ChemicalFileParser& embedded_parser() {
+        static const fourdst::composition::io::ChemicalFileParser parser(
+            std::span(reinterpret_cast<const char*>(StandardMetalFractions), StandardMetalFractions_len)
+        );
+        return parser;
+    }
 
-        std::string line;
-        int start_line = 0;
-        int i = 0;
+    /**
+     * @brief Finds the parser which provides `scheme`, searching user sources newest first.
+     *
+     * @param sources Snapshot of the registered sources.
+     * @param scheme Block tag to find.
+     * @return The parser holding the scheme, or the embedded parser if no user source has it.
+     */
+    const fourdst::composition::io::ChemicalFileParser& parser_for(
+        const std::vector<std::shared_ptr<const RegisteredSource>>& sources,
+        const std::string_view scheme
+    ) {
+        for (const auto& source : std::views::reverse(sources)) {
+            if (source->parser.contains(scheme)) {
+                return source->parser;
+            }
+        }
+        return embedded_parser();
+    }
 
-        CompositionData comp;
+    void add_source(std::shared_ptr<const RegisteredSource> source) {
+        auto& reg = registry();
+        const std::scoped_lock lock(reg.mutex);
+        reg.sources.push_back(std::move(source));
+    }
 
-        while (std::getline(stream, line)) {
+    std::vector<std::shared_ptr<const RegisteredSource>> registered_sources() {
+        auto& reg = registry();
+        const std::scoped_lock lock(reg.mutex);
+        return reg.sources;
+    }
 
-            // find where the end of the scheme block is
-            auto end_pos = std::ranges::search(line,std::format("END {}", scheme));
+}
 
-            // exit if have reached the end of block
-            if (!end_pos.empty()) {
-                break;
-            }
+namespace fourdst:: composition::io {
+    std::span<const unsigned char> get_raw_standard_solar_composition_data() {
+        return StandardMetalFractions;
+    }
 
-            if (start_line>0){
-                const size_t colon_pos = line.find(':');
-                line = line.substr(colon_pos+1);
-
-                line.erase(std::remove_if(line.begin(), line.end(),
-                    [](char c){ return c == '[' || c == ']'; }),
-                    line.end());
-
-                trim(line);
-                std::string item;
-                std::stringstream ss(line);
-                double val;
-                switch(i-start_line){
-                    case 1:
-                        comp.comment_str = line;
-                        break;
-                    case 2:
-                        comp.he_abundance = std::pow(10.0,std::stod(line));
-                        break;
-                    case 3:
-                        comp.requires_atomic_weight = to_bool(line);
-                        break;
-                    case 4:
-                        while(std::getline(ss, item, ',')) {
-                            comp.elements.push_back(item);
-                        }
-                        break;
-                    case 5:
-                        while(std::getline(ss, item, ',')) {
-                            val = std::pow(10.0,std::stod(item));
-                            comp.abundances.push_back(val);
-                        }
+    ChemicalFileParser::ChemicalFileParser(const std::span<const char> data) {
+        constexpr std::string_view begin_tag = "BEGIN ";
+        constexpr std::string_view end_tag = "END ";
+
+        struct OpenBlock {
+            std::string_view name;
+            const char* body_start;
+        };
+        std::vector<OpenBlock> open;
+
+        std::string_view rest(data.data(), data.size());
+        while (!rest.empty()) {
+            const char* line_start = rest.data();
+            const std::string_view line = trim(next_line(rest));
+
+            if (line.starts_with(begin_tag)) {
+                open.push_back({trim(line.substr(begin_tag.size())), rest.data()});
+            } else if (line.starts_with(end_tag)) {
+                const std::string_view name = trim(line.substr(end_tag.size()));
+                // Close the innermost matching block; unmatched END lines are ignored
+                for (auto it = open.rbegin(); it != open.rend(); ++it) {
+                    if (it->name == name) {
+                        m_blocks.push_back({name, std::string_view(it->body_start, line_start)});
+                        open.erase(std::next(it).base(), open.end());
                         break;
+                    }
                 }
             }
-
-            // find where the start of the scheme block is
-            auto start_pos = std::ranges::search(line, std::format("BEGIN {}", scheme));
-
-            if (!start_pos.empty()) {
-                start_line = i;
-            }
-            i+=1;
         }
-
-        // if (start_pos==0):
-        //     raise error ("Scheme {} not found", scheme)
-
-
-
-        return comp;
-
     }
 
-    IsotopicPercentage ChemicalFileParser::parse_isotopic_percentage(const std::vector<char>& data,const std::string& scheme) {
-
-        // get file and iso_scheme
-
-        std::istringstream stream(std::string(data.begin(), data.end()));
+    const ChemicalFileParser::Block* ChemicalFileParser::find_block(const std::string_view scheme) const noexcept {
+        const auto it = std::ranges::find(m_blocks, scheme, &Block::name);
+        return it == m_blocks.end() ? nullptr : &*it;
+    }
 
-        // add error message if something goes wrong
-        ParsedChemicalData parsed;
+    bool ChemicalFileParser::contains(const std::string_view scheme) const noexcept {
+        return find_block(scheme) != nullptr;
+    }
 
-        std::string line;
-        int start_line = 0;
-        int i = 0;
+    std::vector<std::string_view> ChemicalFileParser::schemes() const {
+        std::vector<std::string_view> names;
+        names.reserve(m_blocks.size());
+        for (const auto& block : m_blocks) {
+            names.push_back(block.name);
+        }
+        return names;
+    }
 
-        IsotopicPercentage iso;
+    std::optional<CompositionData> ChemicalFileParser::composition_data(const std::string_view scheme) const {
+        const Block* block = find_block(scheme);
+        if (block == nullptr) {
+            return std::nullopt;
+        }
+        return parse_composition_block(block->body);
+    }
 
-        while (std::getline(stream, line)) {
+    std::optional<IsotopicPercentage> ChemicalFileParser::isotopic_percentage(const std::string_view scheme) const {
+        const Block* block = find_block(scheme);
+        if (block == nullptr) {
+            return std::nullopt;
+        }
+        return parse_isotopic_block(block->body);
+    }
 
-            // find where the end of the scheme block is
-            auto end_pos = std::ranges::search(line,std::format("END {}", scheme));
+    CompositionData ChemicalFileParser::parse_composition_data(const std::vector<char>& data, const std::string& scheme) {
+        return parse_composition_data(std::span(data), std::string_view(scheme));
+    }
 
-            // exit if have reached the end of block
-            if (!end_pos.empty()) {
-                break;
-            }
+    CompositionData ChemicalFileParser::parse_composition_data(const std::span<const char> data, const std::string_view scheme) {
+        return ChemicalFileParser(data).composition_data(scheme).value_or(CompositionData{});
+    }
 
-            if (start_line>0){
-                const size_t colon_pos = line.find(':');
-                line = line.substr(colon_pos+1);
-
-                line.erase(std::remove_if(line.begin(), line.end(),
-                    [](char c){ return c == '[' || c == ']'; }),
-                    line.end());
-
-                trim(line);
-                std::string item;
-                std::stringstream ss(line);
-                parsed.push_back(line);
-                switch(i-start_line){
-                    case 1:
-                        iso.comment_str = line;
-                        break;
-                    case 2:
-                        while(std::getline(ss, item, ',')) {
-                            iso.atomic_numbers.push_back(std::stoi(item));
-                        }
-                        break;
-                    case 3:
-                        while(std::getline(ss, item, ',')) {
-                            iso.elements.push_back(item);
-                        }
-                        break;
-                    case 4:
-                        while(std::getline(ss, item, ',')) {
-                            iso.mass_numbers.push_back(std::stoi(item));
-                        }
-                        break;
-                    case 5:
-                        while(std::getline(ss, item, ',')) {
-                            iso.percentages.push_back(std::stod(item));
-                        }
-                        break;
-                }
-            }
+    IsotopicPercentage ChemicalFileParser::parse_isotopic_percentage(const std::vector<char>& data, const std::string& scheme) {
+        return parse_isotopic_percentage(std::span(data), std::string_view(scheme));
+    }
 
-            // find where the start of the scheme block is
-            auto start_pos = std::ranges::search(line, std::format("BEGIN {}", scheme));
+    IsotopicPercentage ChemicalFileParser::parse_isotopic_percentage(const std::span<const char> data, const std::string_view scheme) {
+        return ChemicalFileParser(data).isotopic_percentage(scheme).value_or(IsotopicPercentage{});
+    }
 
-            if (!start_pos.empty()) {
-                start_line = i;
-            }
-            i+=1;
-        }
+    void register_abundance_file(const std::filesystem::path &path) {
+        auto source = std::make_shared<RegisteredSource>();
+        source->file.emplace(path);
+        source->parser = ChemicalFileParser(source->file->chars());
+        add_source(std::move(source));
+    }
 
+    void register_abundance_data(std::vector<char> data) {
+        auto source = std::make_shared<RegisteredSource>();
+        source->buffer = std::move(data);
+        source->parser = ChemicalFileParser(std::span<const char>(source->buffer));
+        add_source(std::move(source));
+    }
 
-        return iso;
+    void clear_registered_abundance_data() {
+        auto& reg = registry();
+        const std::scoped_lock lock(reg.mutex);
+        reg.sources.clear();
     }
 }
 
@@ -254,28 +411,28 @@ namespace fourdst::composition {
                                                                         double initial_z, double initial_y) {
 
 
-        std::vector<char> data;
-
-        io::ChemicalFileParser parser;
-        io::CompositionData metals;
+        const auto sources = registered_sources();
 
-        io::IsotopicPercentage isotopes;
-
-        data = std::ranges::to<std::vector<char>>(StandardMetalFractions);
-
-        metals = parser.parse_composition_data(data,metal_fraction_scheme);
-        isotopes = parser.parse_isotopic_percentage(data,isotopic_percentage_scheme);
+        const io::CompositionData metals = parser_for(sources, metal_fraction_scheme)
+            .composition_data(metal_fraction_scheme)
+            .value_or(io::CompositionData{});
+        const io::IsotopicPercentage isotopes = parser_for(sources, isotopic_percentage_scheme)
+            .isotopic_percentage(isotopic_percentage_scheme)
+            .value_or(io::IsotopicPercentage{});
 
         std::string name;
         std::vector<atomic::Species> species;
+        std::vector<size_t> isotope_index; // row of isotopes.* each entry of species came from
 
 
         // construct name of the isotopes for all elements
-        for (const auto [E,A] : std::ranges::views::zip(isotopes.elements, isotopes.mass_numbers)){
+        for (size_t k = 0; k < isotopes.elements.size(); ++k) {
+            const std::string& E = isotopes.elements[k];
             if (std::ranges::contains(metals.elements,E ) || E == "H" || E == "He") {
-                name = std::format("{}-{}",E,A);
+                name = std::format("{}-{}",E,isotopes.mass_numbers[k]);
                 auto SpeciesObject = atomic::species.at(name);
                 species.push_back(SpeciesObject);
+                isotope_index.push_back(k);
                 // std::println("Species: {} has mass: {}", SpeciesObject.name(), SpeciesObject.mass());
             }
         }
@@ -350,21 +507,32 @@ namespace fourdst::composition {
 
         double zsum = 0.0;
 
+        // isotopic mass of every element, summed once over its isotope chain in the species table
+        const atomic::SpeciesTable& table = atomic::SpeciesTable::builtin();
+        std::vector<double> isotope_frac(table.size(), 0.0);
+        for (size_t i = 0; i < species.size(); ++i) {
+            isotope_frac[*table.find(species[i].z(), species[i].a())] = 1e-2*isotopes.percentages[isotope_index[i]];
+        }
+        std::vector<double> element_frac_sum(static_cast<size_t>(table.z().back()) + 1, 0.0);
+        for (const auto& sp : species) {
+            double& frac_sum = element_frac_sum[static_cast<size_t>(sp.z())];
+            if (frac_sum != 0.0) continue;
+            for (const atomic::SpeciesRecord& iso : table.element(sp.z())) {
+                frac_sum += isotope_frac[iso.id]*iso.mass;
+            }
+        }
+
         // get mass Fracs for each metal and scale it to required ztotal
         for (size_t i = 0; i < species.size();++i) {
-            size_t Z = isotopes.atomic_numbers[i];
+            const size_t k = isotope_index[i];
+            size_t Z = isotopes.atomic_numbers[k];
             if (Z<=2) continue;
 
-            if (metal_fractions.contains(isotopes.elements[i])) {
-                double frac = 1e-2*isotopes.percentages[i]*species[i].mass();
-                double frac_sum = 0.0;
-                size_t j = i ;
-                while (j<species.size() && isotopes.atomic_numbers[j] == Z) {
-                    frac_sum += 1e-2*isotopes.percentages[j]*species[j].mass();
-                    ++j;
-                }
+            if (metal_fractions.contains(isotopes.elements[k])) {
+                double frac = 1e-2*isotopes.percentages[k]*species[i].mass();
+                double frac_sum = element_frac_sum[Z];
                 // extract zfrac for the corresponding Z symbol/ isotopes.elements
-                double zfrac = metal_fractions.at(isotopes.elements[i]);
+                double zfrac = metal_fractions.at(isotopes.elements[k]);
                 auto temp = ztotal*zfrac*frac/frac_sum;
                 massFracs.push_back(temp);
                 zsum += temp;
@@ -376,7 +544,7 @@ namespace fourdst::composition {
         //Renormalize
         if (zsum > 0.0) {
             for (size_t i = 0; i < massFracs.size();++i) {
-                if (isotopes.atomic_numbers[i]<=2) continue;
+                if (isotopes.atomic_numbers[isotope_index[i]]<=2) continue;
                 massFracs[i] *= ztotal/zsum;
             }
         }
@@ -2,14 +2,20 @@
 #include "fourdst/composition/exceptions/exceptions_composition.h"
 #include "fourdst/atomic/atomicSpecies.h"
 #include "fourdst/atomic/species.h"
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/atomic/nuclide_symbol.h"
 #include "../include/fourdst/composition/utils/utils.h"
+#include "fourdst/composition/utils/composition_hash.h"
 #include "fourdst/logging/logging.h"
 
 #include <numeric>
 #include <ranges>
 #include <vector>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 #include "quill/LogMacros.h"
 
@@ -19,9 +25,39 @@ namespace {
         return logger;
     }
 
-    void throw_unknown_symbol(const std::string& symbol) {
+    [[noreturn]] void throw_unknown_symbol(const std::string_view symbol) {
         LOG_ERROR(getLogger(), "Symbol {} is not a valid species symbol (not in the species database)", symbol);
-        throw fourdst::composition::exceptions::UnknownSymbolError("Symbol " + symbol + " is not a valid species symbol (not in the species database)");
+        throw fourdst::composition::exceptions::UnknownSymbolError("Symbol " + std::string(symbol) + " is not a valid species symbol (not in the species database)");
+    }
+
+    /**
+     * Looks a species of the compiled-in database up by (Z, A); nullptr if there is none.
+     */
+    const fourdst::atomic::Species* builtin_species(const int z, const int a) noexcept {
+        using fourdst::composition::utils::CompositionHash;
+        // Built once from the species database, keyed on the packed (Z, A) identifier used by CompositionHash
+        static const std::unordered_map<uint32_t, const fourdst::atomic::Species*> za_index = [] {
+            std::unordered_map<uint32_t, const fourdst::atomic::Species*> index;
+            index.reserve(fourdst::atomic::species.size());
+            for (const auto& sp : fourdst::atomic::species | std::views::values) {
+                index.emplace(CompositionHash::pack_species_id(sp), &sp);
+            }
+            return index;
+        }();
+
+        if (z < 0 || a < 0 || z > 0xFFFF || a > 0xFFFF) {
+            return nullptr;
+        }
+        const auto it = za_index.find(CompositionHash::pack_species_id(z, a));
+        return it == za_index.end() ? nullptr : it->second;
+    }
+
+    fourdst::atomic::Species resolve_symbol(const std::string_view symbol) {
+        const auto species = fourdst::composition::findSpecies(symbol);
+        if (!species) {
+            throw_unknown_symbol(symbol);
+        }
+        return *species;
     }
 }
 
@@ -75,26 +111,21 @@ namespace fourdst::composition {
     }
 
     Composition buildCompositionFromMassFractions(const std::vector<std::string> &symbols, const std::vector<double> &massFractions) {
-        std::set<atomic::Species> species;
+        std::vector<atomic::Species> species;
+        species.reserve(symbols.size());
         for (const auto& symbol : symbols) {
-            auto result = getSpecies(symbol);
-            if (!result) {
-                throw_unknown_symbol(symbol);
-            }
-            species.insert(result.value());
+            species.push_back(resolve_symbol(symbol));
         }
+        return buildCompositionFromMassFractions(species, massFractions);
+    }
 
-        std::vector<double> sortedMassFractions(massFractions.size());
-        for (const auto& [symbol, xi] : std::views::zip(symbols, massFractions)) {
-            auto result = getSpecies(symbol);
-            if (!result) {
-                throw_unknown_symbol(symbol);
-            }
-            const size_t index = std::distance(species.begin(), species.find(result.value()));
-            assert (index < sortedMassFractions.size());
-            sortedMassFractions[index] = xi;
+    Composition buildCompositionFromMassFractions(const std::span<const std::string_view> symbols, const std::span<const double> massFractions) {
+        std::vector<atomic::Species> species;
+        species.reserve(symbols.size());
+        for (const auto symbol : symbols) {
+            species.push_back(resolve_symbol(symbol));
         }
-        return buildCompositionFromMassFractions(species, sortedMassFractions);
+        return buildCompositionFromMassFractions(species, std::vector(massFractions.begin(), massFractions.end()));
     }
 
     Composition buildCompositionFromMassFractions(const std::unordered_map<atomic::Species, double>& massFractionsMap) {
@@ -132,65 +163,78 @@ namespace fourdst::composition {
     }
 
     Composition buildCompositionFromMassFractions(std::map<std::string, double> massFractions) {
-        std::set<atomic::Species> species;
+        std::vector<atomic::Species> species;
         std::vector<double> massFractionVector;
-
-
-        for (const auto &symbol: massFractions | std::views::keys) {
-            auto result = getSpecies(symbol);
-            if (!result) {
-                throw_unknown_symbol(symbol);
-            }
-            species.insert(result.value());
-        }
-
-        massFractionVector.resize(massFractions.size());
+        species.reserve(massFractions.size());
+        massFractionVector.reserve(massFractions.size());
 
         for (const auto& [symbol, xi] : massFractions) {
-            auto result = getSpecies(symbol);
-            if (!result) {
-                throw_unknown_symbol(symbol);
-            }
-            const size_t index = std::distance(species.begin(), species.find(result.value()));
-            assert (index < massFractionVector.size());
-            massFractionVector[index] = xi;
+            species.push_back(resolve_symbol(symbol));
+            massFractionVector.push_back(xi);
         }
 
-
         return buildCompositionFromMassFractions(species, massFractionVector);
     }
 
     Composition buildCompositionFromMassFractions(const std::unordered_map<std::string, double>& massFractions) {
-        std::set<atomic::Species> species;
+        std::vector<atomic::Species> species;
         std::vector<double> massFractionVector;
+        species.reserve(massFractions.size());
+        massFractionVector.reserve(massFractions.size());
 
-        for (const auto &symbol: massFractions | std::views::keys) {
-            auto result = getSpecies(symbol);
-            if (!result) {
-                throw_unknown_symbol(symbol);
-            }
-            species.insert(result.value());
+        for (const auto& [symbol, xi] : massFractions) {
+            species.push_back(resolve_symbol(symbol));
+            massFractionVector.push_back(xi);
         }
 
-        massFractionVector.resize(massFractions.size());
-        for (const auto& [sp, xi] : massFractions) {
-            auto result = getSpecies(sp);
-            if (!result) {
-                throw_unknown_symbol(sp);
+        return buildCompositionFromMassFractions(species, massFractionVector);
+    }
+
+    SpeciesHandle findSpecies(const std::string_view symbol) noexcept {
+        // Canonical names take one hash probe; other notations ("fe56", "56Fe", "alpha") are decoded into (Z, A)
+        if (auto table = atomic::SpeciesTable::installed()) {
+            auto id = table->find(symbol);
+            if (!id) {
+                id = table->findNuclide(symbol);
+            }
+            if (!id) {
+                return {};
             }
-            const size_t index = std::distance(species.begin(), species.find(result.value()));
-            assert (index < massFractionVector.size());
-            massFractionVector[index] = xi;
+            const atomic::Species* sp = &table->allSpecies()[*id];
+            return {sp, std::move(table)};
+        }
+        if (const auto it = atomic::species.find(symbol); it != atomic::species.end()) {
+            return {&it->second, nullptr};
         }
+        const auto za = atomic::parse_nuclide(symbol);
+        if (!za) {
+            return {};
+        }
+        return {builtin_species(za->z, za->a), nullptr};
+    }
 
-        return buildCompositionFromMassFractions(species, massFractionVector);
+    std::optional<fourdst::atomic::Species> getSpecies(const std::string_view symbol) {
+        const auto species = findSpecies(symbol);
+        if (!species) {
+            return std::nullopt;
+        }
+        return *species;
     }
 
-    std::optional<fourdst::atomic::Species> getSpecies(const std::string& symbol) {
-        if (!fourdst::atomic::species.contains(symbol)) {
+    std::optional<fourdst::atomic::Species> getSpecies(const int z, const int a) {
+        if (const auto table = atomic::SpeciesTable::installed()) {
+            const auto id = table->find(z, a);
+            if (!id) {
+                return std::nullopt;
+            }
+            return (*table)[*id];
+        }
+
+        const atomic::Species* species = builtin_species(z, a);
+        if (species == nullptr) {
             return std::nullopt;
         }
-        return fourdst::atomic::species.at(symbol);
+        return *species;
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,389 @@
+#include "fourdst/composition/utils/composition_decay.h"
+#include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/exceptions/exceptions_composition.h"
+#include "fourdst/atomic/species_table.h"
+
+#include "../atomic/species_table_cache.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    using fourdst::atomic::DecayChannel;
+    using fourdst::atomic::Species;
+    using fourdst::atomic::SpeciesId;
+    using fourdst::atomic::SpeciesTable;
+    using fourdst::composition::utils::CompositionHash;
+
+    constexpr double kShortestHalfLife = 1.0e-30;
+    // Bound on the number of cached decay networks (one per species schema and table)
+    constexpr std::size_t kMaxCachedNetworks = 1024;
+
+    /**
+     * Order 16 Chebyshev rational approximation of exp(x) on (-inf, 0]:
+     * exp(x) ~ kCramLimit + 2 Re sum_k residue_k / (x - pole_k), over the poles in the upper half plane.
+     * Poles from the Caratheodory-Fejer method (Trefethen, Weideman & Schmelzer 2006), residues
+     * fitted in double precision; the maximum error on (-inf, 0] is 2.3e-14.
+     */
+    constexpr double kCramLimit = 1.7672542854042993e-16;
+    constexpr std::array<std::pair<std::complex<double>, std::complex<double>>, 8> kCram16{{
+        {{6.4262974984312011, 1.19469992052438}, {-65.071888493493987, -227.02100268091058}},
+        {{5.9583674621392655, 3.5892270906468542}, {114.45229475633715, 103.22096589011224}},
+        {{5.0036231348758999, 5.9999533828191574}, {-63.169221599992554, -11.485310171917353}},
+        {{3.520017060276091, 8.4407458721250581}, {15.253002870611533, -5.754168936538048}},
+        {{1.4311509492921133, 10.931598701985953}, {-1.5071179954280538, 1.7813852591175883}},
+        {{-1.4006174319284785, 13.505837945478275}, {0.042757598910433882, -0.15921634352622457}},
+        {{-5.2489991344321272, 16.230183380116973}, {0.00017311748052396865, 0.0044600973976017038}},
+        {{-10.823477773031836, 19.288503044383653}, {-2.5442367478587617e-07, -2.47082720782644e-05}},
+    }};
+
+    double decay_constant(const SpeciesTable& table, const std::optional<SpeciesId> row) noexcept {
+        if (!row) {
+            return 0.0;
+        }
+        const double halfLife = table.halfLife()[*row];
+        if (!std::isfinite(halfLife)) {
+            return 0.0;
+        }
+        return std::numbers::ln2 / std::max(halfLife, kShortestHalfLife);
+    }
+
+    /**
+     * Scratch buffers of DecayNetwork::apply, reused across compositions.
+     */
+    struct DecayWorkspace {
+        std::vector<double> y;
+        std::vector<double> decayed;
+        std::vector<std::complex<double>> x;
+    };
+
+    /**
+     * Decay network over the closure of a species schema, in topological order.
+     */
+    class DecayNetwork {
+    public:
+        DecayNetwork(const std::vector<Species>& schema, const SpeciesTable& table) {
+            // Closure of the schema under the decay channels
+            std::vector<Species> nodes(schema);
+            std::vector<std::optional<SpeciesId>> rows;
+            std::unordered_map<SpeciesId, std::uint32_t> nodeOfRow;
+            for (const auto& sp : schema) {
+                rows.push_back(table.find(sp.z(), sp.a()));
+                if (rows.back()) {
+                    nodeOfRow.emplace(*rows.back(), static_cast<std::uint32_t>(rows.size() - 1));
+                }
+            }
+            std::vector<double> lambda;
+            std::vector<std::vector<std::pair<std::uint32_t, double>>> out; // (daughter node, branching ratio)
+            for (std::size_t i = 0; i < nodes.size(); ++i) {
+                lambda.push_back(decay_constant(table, rows[i]));
+                out.emplace_back();
+                if (lambda[i] == 0.0) {
+                    continue;
+                }
+                const auto channels = table.decayChannels(*rows[i]);
+                if (channels.empty()) { // A half-life without decay modes gives nowhere to put the abundance
+                    lambda[i] = 0.0;
+                    continue;
+                }
+                double known = 0.0;
+                std::size_t unknown = 0;
+                for (const DecayChannel& channel : channels) {
+                    if (std::isnan(channel.branchingRatio)) {
+                        ++unknown;
+                    } else {
+                        known += channel.branchingRatio;
+                    }
+                }
+                const double share = unknown == 0 ? 0.0 : std::max(0.0, 1.0 - known) / static_cast<double>(unknown);
+                const double total = known + share * static_cast<double>(unknown);
+                for (const DecayChannel& channel : channels) {
+                    if (channel.daughter == fourdst::atomic::kNoSpecies || channel.daughter == *rows[i] || total <= 0.0) {
+                        continue;
+                    }
+                    const double ratio = (std::isnan(channel.branchingRatio) ? share : channel.branchingRatio) / total;
+                    auto [it, inserted] = nodeOfRow.emplace(channel.daughter, static_cast<std::uint32_t>(nodes.size()));
+                    if (inserted) {
+                        nodes.push_back(table[channel.daughter]);
+                        rows.emplace_back(channel.daughter);
+                    }
+                    out[i].emplace_back(it->second, ratio);
+                }
+            }
+
+            // Kahn's algorithm; the decay matrix is lower triangular in the resulting order
+            const std::size_t n = nodes.size();
+            std::vector<std::uint32_t> inDegree(n, 0);
+            for (const auto& edges : out) {
+                for (const auto& [daughter, ratio] : edges) {
+                    ++inDegree[daughter];
+                }
+            }
+            std::vector<std::uint32_t> order;
+            order.reserve(n);
+            for (std::uint32_t i = 0; i < n; ++i) {
+                if (inDegree[i] == 0) {
+                    order.push_back(i);
+                }
+            }
+            for (std::size_t k = 0; k < order.size(); ++k) {
+                for (const auto& [daughter, ratio] : out[order[k]]) {
+                    if (--inDegree[daughter] == 0) {
+                        order.push_back(daughter);
+                    }
+                }
+            }
+            if (order.size() != n) {
+                throw fourdst::composition::exceptions::InvalidCompositionError("The decay channels of the species table form a cycle; cannot decay the composition.");
+            }
+
+            // Species which neither decay nor are fed by a decay are passed through unchanged
+            std::vector<bool> fed(n, false);
+            for (const auto& edges : out) {
+                for (const auto& [daughter, ratio] : edges) {
+                    fed[daughter] = true;
+                }
+            }
+            std::vector<std::uint32_t> activeIndex(n, kPassive);
+            for (const std::uint32_t node : order) {
+                if (lambda[node] > 0.0 || fed[node]) {
+                    activeIndex[node] = static_cast<std::uint32_t>(m_lambda.size());
+                    m_lambda.push_back(lambda[node]);
+                }
+            }
+
+            // Incoming rates of every active species, as CSR rows
+            std::vector<std::vector<std::pair<std::uint32_t, double>>> in(m_lambda.size());
+            for (std::uint32_t node = 0; node < n; ++node) {
+                for (const auto& [daughter, ratio] : out[node]) {
+                    in[activeIndex[daughter]].emplace_back(activeIndex[node], lambda[node] * ratio);
+                }
+            }
+            m_rowStart.push_back(0);
+            for (const auto& edges : in) {
+                for (const auto& [source, rate] : edges) {
+                    m_source.push_back(source);
+                    m_rate.push_back(rate);
+                }
+                m_rowStart.push_back(static_cast<std::uint32_t>(m_source.size()));
+            }
+
+            // Products in Composition order, and where every species lives in the network
+            std::vector<std::uint32_t> byComposition(n);
+            for (std::uint32_t i = 0; i < n; ++i) {
+                byComposition[i] = i;
+            }
+            std::ranges::sort(byComposition, [&nodes](const std::uint32_t a, const std::uint32_t b) { return nodes[a] < nodes[b]; });
+            std::vector<std::uint32_t> productOfNode(n);
+            m_products.reserve(n);
+            for (const std::uint32_t node : byComposition) {
+                productOfNode[node] = static_cast<std::uint32_t>(m_products.size());
+                m_products.push_back(nodes[node]);
+                m_activeOfProduct.push_back(activeIndex[node]);
+            }
+            for (std::size_t i = 0; i < schema.size(); ++i) {
+                m_productOfInput.push_back(productOfNode[i]);
+            }
+        }
+
+        [[nodiscard]] const std::vector<Species>& products() const noexcept { return m_products; }
+
+        /**
+         * Decays `abundances` (in schema order) over dt into `result` (in products order).
+         */
+        void apply(const std::vector<double>& abundances, const double dt, std::vector<double>& result, DecayWorkspace& workspace) const {
+            const std::size_t m = m_lambda.size();
+            auto& [y, decayed, x] = workspace;
+            result.assign(m_products.size(), 0.0);
+            y.assign(m, 0.0);
+            for (std::size_t i = 0; i < abundances.size(); ++i) {
+                const std::uint32_t product = m_productOfInput[i];
+                if (m_activeOfProduct[product] == kPassive) {
+                    result[product] = abundances[i];
+                } else {
+                    y[m_activeOfProduct[product]] = abundances[i];
+                }
+            }
+
+            // exp(dt A) y ~ kCramLimit y + 2 Re sum_k residue_k (dt A - pole_k)^-1 y, by forward substitution
+            decayed.resize(m);
+            for (std::size_t i = 0; i < m; ++i) {
+                decayed[i] = kCramLimit * y[i];
+            }
+            x.resize(m);
+            for (const auto& [pole, residue] : kCram16) {
+                for (std::size_t i = 0; i < m; ++i) {
+                    std::complex<double> sum = y[i];
+                    for (std::uint32_t e = m_rowStart[i]; e < m_rowStart[i + 1]; ++e) {
+                        sum -= (dt * m_rate[e]) * x[m_source[e]];
+                    }
+                    x[i] = sum / (-dt * m_lambda[i] - pole);
+                    decayed[i] += 2.0 * (residue * x[i]).real();
+                }
+            }
+
+            for (std::size_t product = 0; product < m_products.size(); ++product) {
+                if (const std::uint32_t active = m_activeOfProduct[product]; active != kPassive) {
+                    result[product] = std::max(decayed[active], 0.0);
+                }
+            }
+        }
+
+    private:
+        static constexpr std::uint32_t kPassive = std::numeric_limits<std::uint32_t>::max();
+
+        std::vector<Species> m_products; ///< Schema closure, in Composition order.
+        std::vector<std::uint32_t> m_productOfInput;
+        std::vector<std::uint32_t> m_activeOfProduct; ///< Network row of every product, or kPassive.
+        std::vector<double> m_lambda; ///< Decay constants (1/s) of the network rows, in topological order.
+        std::vector<std::uint32_t> m_rowStart;
+        std::vector<std::uint32_t> m_source;
+        std::vector<double> m_rate; ///< Rate (1/s) at which m_source feeds the row.
+    };
+
+    struct NetworkCacheEntry {
+        std::shared_ptr<const SpeciesTable> table;
+        std::vector<std::uint32_t> ids;
+        std::shared_ptr<const DecayNetwork> network;
+    };
+
+    struct NetworkCache {
+        std::mutex mutex;
+        std::unordered_multimap<std::uint64_t, NetworkCacheEntry> entries;
+    };
+
+    NetworkCache& network_cache() {
+        static NetworkCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const SpeciesTable> decay_table() {
+        if (auto installed = SpeciesTable::installed()) {
+            return installed;
+        }
+        return {std::shared_ptr<const SpeciesTable>{}, &SpeciesTable::builtin()};
+    }
+
+    /**
+     * Gets the cached decay network of a species schema, building it on first use.
+     */
+    std::shared_ptr<const DecayNetwork> decay_network(const std::vector<Species>& schema) {
+        auto table = decay_table();
+        std::vector<std::uint32_t> ids;
+        ids.reserve(schema.size());
+        for (const auto& sp : schema) {
+            ids.push_back(CompositionHash::pack_species_id(sp));
+        }
+        const std::uint64_t schemaHash = CompositionHash::hash_species_ids(ids);
+        const auto matches = [&](const NetworkCacheEntry& entry) { return entry.table == table && entry.ids == ids; };
+
+        NetworkCache& cache = network_cache();
+        {
+            std::scoped_lock lock(cache.mutex);
+            const auto [first, last] = cache.entries.equal_range(schemaHash);
+            for (auto it = first; it != last; ++it) {
+                if (matches(it->second)) {
+                    return it->second.network;
+                }
+            }
+        }
+
+        auto network = std::make_shared<const DecayNetwork>(schema, *table);
+        std::scoped_lock lock(cache.mutex);
+        const auto [first, last] = cache.entries.equal_range(schemaHash);
+        for (auto it = first; it != last; ++it) { // Another thread may have built the same network meanwhile
+            if (matches(it->second)) {
+                return it->second.network;
+            }
+        }
+        // Drop networks of tables which are no longer installed anywhere
+        fourdst::atomic::detail::prune_table_cache(cache.entries, kMaxCachedNetworks);
+        cache.entries.emplace(schemaHash, NetworkCacheEntry{std::move(table), std::move(ids), network});
+        return network;
+    }
+
+    void check_time_step(const double dt) {
+        if (!std::isfinite(dt) || dt < 0.0) {
+            throw std::invalid_argument("Decay time step must be finite and non-negative, got " + std::to_string(dt) + ".");
+        }
+    }
+}
+
+namespace fourdst::composition::utils {
+    Composition decay(const CompositionAbstract &composition, const double dt) {
+        check_time_step(dt);
+        const auto network = decay_network(composition.getRegisteredSpecies());
+        std::vector<double> result;
+        DecayWorkspace workspace;
+        network->apply(composition.getMolarAbundanceVector(), dt, result, workspace);
+        return {network->products(), result};
+    }
+
+    std::vector<Composition> decay(const std::span<const Composition> zones, const double dt, const DecayOptions& options) {
+        check_time_step(dt);
+
+        // Resolve the networks up front; consecutive zones usually share a schema
+        std::vector<std::shared_ptr<const DecayNetwork>> networks(zones.size());
+        for (std::size_t i = 0; i < zones.size(); ++i) {
+            if (i > 0 && zones[i].getRegisteredSpecies() == zones[i - 1].getRegisteredSpecies()) {
+                networks[i] = networks[i - 1];
+            } else {
+                networks[i] = decay_network(zones[i].getRegisteredSpecies());
+            }
+        }
+
+        std::vector<Composition> decayed(zones.size());
+        const auto run = [&](const std::size_t begin, const std::size_t end) {
+            std::vector<double> result;
+            DecayWorkspace workspace;
+            for (std::size_t i = begin; i < end; ++i) {
+                networks[i]->apply(zones[i].getMolarAbundanceVector(), dt, result, workspace);
+                if (i > begin && networks[i] == networks[i - 1]) {
+                    decayed[i] = decayed[i - 1]; // Shares the sorted species list; only the abundances are replaced
+                    decayed[i].setMolarAbundance(networks[i]->products(), result);
+                } else {
+                    decayed[i] = Composition(networks[i]->products(), result);
+                }
+            }
+        };
+
+        std::size_t threads = options.threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : options.threads;
+        threads = std::max<std::size_t>(1, std::min(threads, zones.size() / std::max<std::size_t>(options.min_zones_per_thread, 1)));
+        std::vector<std::exception_ptr> errors(threads);
+        const auto chunk = [&](const std::size_t t) {
+            try {
+                run(zones.size() * t / threads, zones.size() * (t + 1) / threads);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        };
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(threads - 1);
+            for (std::size_t t = 1; t < threads; ++t) {
+                workers.emplace_back(chunk, t);
+            }
+            chunk(0);
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        return decayed;
+    }
+}
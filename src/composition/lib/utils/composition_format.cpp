@@ -0,0 +1,96 @@
+#include "fourdst/composition/utils/composition_format.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace {
+    using fourdst::composition::utils::CompositionFormatSpec;
+    using fourdst::composition::utils::FormatLayout;
+    using fourdst::composition::utils::FormatQuantity;
+
+    // Fixed notation of the largest double at kMaxFormatPrecision digits, with sign and point
+    constexpr std::size_t kValueBufferSize = 512;
+
+    void append_value(std::string& out, const double value, const CompositionFormatSpec& spec) {
+        if (spec.layout == FormatLayout::JSON && !std::isfinite(value)) {
+            out += "null";
+            return;
+        }
+        std::array<char, kValueBufferSize> buffer{};
+        char* const first = buffer.data();
+        char* const last = buffer.data() + buffer.size();
+        // Specs built by hand are not checked by parse_composition_format_spec
+        const int precision = std::min(spec.precision, fourdst::composition::utils::kMaxFormatPrecision);
+        std::to_chars_result result = precision < 0
+            ? (spec.style == std::chars_format::general
+                ? std::to_chars(first, last, value)
+                : std::to_chars(first, last, value, spec.style))
+            : std::to_chars(first, last, value, spec.style, precision);
+        if (result.ec != std::errc{}) { // The shortest representation always fits
+            result = std::to_chars(first, last, value);
+        }
+        out.append(first, result.ptr);
+    }
+
+    std::string_view quantity_label(const FormatQuantity quantity) noexcept {
+        switch (quantity) {
+            case FormatQuantity::NUMBER_FRACTION: return "Number Fractions";
+            case FormatQuantity::MOLAR_ABUNDANCE: return "Molar Abundances";
+            case FormatQuantity::MASS_FRACTION: break;
+        }
+        return "Mass Fractions";
+    }
+}
+
+namespace fourdst::composition::utils {
+    void format_composition(std::string& out, const CompositionAbstract& composition, const CompositionFormatSpec& spec) {
+        // Single normalisation pass; the per-species getters would rescan the composition for every species
+        double total = 1.0;
+        if (spec.quantity != FormatQuantity::MOLAR_ABUNDANCE) {
+            total = 0.0;
+            for (const auto& [species, y] : composition) {
+                total += spec.quantity == FormatQuantity::MASS_FRACTION ? y * species.mass() : y;
+            }
+        }
+
+        const bool json = spec.layout == FormatLayout::JSON;
+        out.reserve(out.size() + 32 + composition.size() * (json ? 32 : 28));
+        if (json) {
+            out += '{';
+        } else {
+            out += "Composition(";
+            out += quantity_label(spec.quantity);
+            out += " => [";
+        }
+
+        bool first = true;
+        for (const auto& [species, y] : composition) {
+            if (!first) {
+                out += ", ";
+            }
+            first = false;
+            if (json) {
+                out += '"';
+                out += species.name();
+                out += "\": ";
+            } else {
+                out += species.name();
+                out += ": ";
+            }
+            const double numerator = spec.quantity == FormatQuantity::MASS_FRACTION ? y * species.mass() : y;
+            append_value(out, numerator / total, spec);
+        }
+        out += json ? "}" : "])";
+    }
+
+    std::string format_composition(const CompositionAbstract& composition, const CompositionFormatSpec& spec) {
+        std::string out;
+        format_composition(out, composition, spec);
+        return out;
+    }
+}
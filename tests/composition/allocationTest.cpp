@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#define FDST_DEFINE_COUNTING_OPERATOR_NEW
+#include "allocation_counter.h"
+#include "allocation_budgets.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Test suite holding the Composition API to its declared allocation budgets.
+ * @details This executable replaces the global operator new (see allocation_counter.h), so it is
+ * kept apart from compositionTest. The budgets are declared in allocation_budgets.h and shared
+ * with the allocation benchmark.
+ */
+class allocationTest : public ::testing::TestWithParam<std::size_t> {};
+
+/**
+ * @brief Tests that no Composition operation allocates more than its budget.
+ * @par What this test proves:
+ * - Every operation in composition_allocation_budgets() stays within `fixed + perSpecies * N` operator new calls per call, at several composition sizes.
+ * - An allocation regression in any budgeted API fails this test target.
+ * @par What this test does not prove:
+ * - That operations without a declared budget are allocation free, or that the bytes allocated are small.
+ */
+TEST_P(allocationTest, withinBudgets) {
+    constexpr std::size_t calls = 16;
+    const std::size_t n = GetParam();
+    AllocationFixture fixture(n);
+    for (const AllocationBudget& budget : composition_allocation_budgets()) {
+        SCOPED_TRACE(std::string(budget.operation));
+        const AllocationCounts counts = count_allocations([&] { budget.call(fixture); }, calls);
+        EXPECT_LE(counts.allocations, budget.allowed(n) * calls)
+            << budget.operation << " made " << counts.allocations / static_cast<double>(calls)
+            << " allocations per call on " << n << " species; the budget is " << budget.allowed(n);
+    }
+}
+
+/**
+ * @brief Tests that the allocation counter sees allocations.
+ * @par What this test proves:
+ * - The operator new replacement is active, so a zero count in withinBudgets means no allocation rather than no counting.
+ */
+TEST(allocationCounterTest, countsAllocations) {
+    static std::vector<double>* volatile sink = nullptr;
+    const AllocationCounts counts = count_allocations([] {
+        std::vector<double> v(100);
+        sink = &v; // the escaping address keeps the allocation from being elided
+    });
+    EXPECT_EQ(counts.allocations, 1u);
+    EXPECT_EQ(counts.bytes, 100 * sizeof(double));
+}
+
+INSTANTIATE_TEST_SUITE_P(speciesCounts, allocationTest, ::testing::Values(8, 128, 1024));
@@ -1,21 +1,48 @@
 #include <gtest/gtest.h>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <ranges>
+#include <filesystem>
+#include <format>
+#include <sstream>
+#include <iomanip>
+#include <numbers>
 
 #include "fourdst/atomic/atomicSpecies.h"
 #include "fourdst/atomic/species.h"
+#include "fourdst/atomic/species_table.h"
+#include "fourdst/atomic/reaction_q_values.h"
+#include "fourdst/atomic/nuclide_symbol.h"
+#include "fourdst/atomic/species_literals.h"
+#include "fourdst/composition/utils/composition_decay.h"
 #include "fourdst/composition/composition.h"
 #include "fourdst/composition/exceptions/exceptions_composition.h"
 #include "fourdst/composition/utils/utils.h"
 #include "fourdst/composition/decorators/composition_masked.h"
 #include "fourdst/composition/io/standard_compositions.h"
 #include "fourdst/composition/utils/composition_hash.h"
+#include "fourdst/composition/composition_view.h"
+#include "fourdst/composition/io/composition_binary.h"
+#include "fourdst/composition/io/composition_archive.h"
+#include "fourdst/composition/io/composition_timeseries.h"
+#include "fourdst/composition/io/composition_numpy.h"
+#include "fourdst/composition/io/composition_text.h"
+#include "fourdst/composition/io/shared_composition_segment.h"
+#include "fourdst/composition/io/composition_pack.h"
+#include "fourdst/composition/utils/composition_format.h"
+#include "fourdst/composition/c/composition_c.h"
 
 #include "fourdst/config/config.h"
 
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 
 /**
  * @brief Test suite for the Composition class and related data structures.
@@ -23,7 +50,15 @@
  * including the underlying atomic data, the creation and manipulation of
  * compositions, and the correctness of derived physical quantities.
  */
-class compositionTest : public ::testing::Test {};
+class compositionTest : public ::testing::Test {
+protected:
+    /**
+     * @brief Removes any SpeciesTable a test installed, so a failed assertion cannot leak it into later tests.
+     */
+    void TearDown() override {
+        fourdst::atomic::SpeciesTable::install(nullptr);
+    }
+};
 
 /**
  * @brief Tests the correctness of atomic mass data for select isotopes.
@@ -62,8 +97,8 @@ TEST_F(compositionTest, isotopeHalfLives) {
 
 /**
  * @brief Tests the numeric conversion of spin-parity strings.
- * @details This test validates the `spin()` method, which relies on the `convert_jpi_to_double`
- * utility. It covers a wide range of cases including half-integer spins (H-1), integer spins (Li-10),
+ * @details This test validates the `spin()` method, which returns the spin decoded by `decode_jpi`
+ * at construction. It covers a wide range of cases including half-integer spins (H-1), integer spins (Li-10),
  * zero spin (He-4), and cases where the spin is not known and should result in NaN (Bh-270).
  * @par What this test proves:
  * - The spin-parity string parsing logic correctly handles common formats (e.g., "1/2+", "5", "0+").
@@ -75,18 +110,66 @@ TEST_F(compositionTest, isotopeSpin) {
     using namespace fourdst::atomic;
     EXPECT_DOUBLE_EQ(H_1.spin(), 0.5);
     EXPECT_DOUBLE_EQ(He_4.spin(), 0.0);
-    EXPECT_DOUBLE_EQ(Pm_164.spin(), 0.0);
+    EXPECT_DOUBLE_EQ(Pm_164.spin(), 5.0);
     EXPECT_DOUBLE_EQ(Tb_164.spin(), 5.0);
     EXPECT_DOUBLE_EQ(Ta_163.spin(), 0.5);
     EXPECT_DOUBLE_EQ(Hf_165.spin(), 2.5);
     EXPECT_DOUBLE_EQ(Ta_165.spin(), 0.5);
     EXPECT_DOUBLE_EQ(Li_10.spin(), 1.0);
     EXPECT_DOUBLE_EQ(He_9.spin(), 0.5);
-    EXPECT_DOUBLE_EQ(F_18.spin(), 0.0);
+    EXPECT_DOUBLE_EQ(F_18.spin(), 1.0);
     EXPECT_DOUBLE_EQ(B_20.spin(), 1.0);
     EXPECT_TRUE(std::isnan(Bh_270.spin()));
 }
 
+/**
+ * @brief Tests the exact spin, parity and certainty decoded from spin-parity strings.
+ * @par What this test proves:
+ * - 2J, parity and the tentative flag are decoded at construction and survive copies.
+ * - The decoded spin generated into species.h agrees with `decode_jpi` for every builtin species.
+ * - The SpeciesTable exposes them as TWO_J and PARITY columns that predicates can filter on.
+ */
+TEST_F(compositionTest, isotopeSpinParity) {
+    using namespace fourdst::atomic;
+    static_assert(decode_jpi("5/2-").twoJ == 5);
+    static_assert(decode_jpi("0+      T=1").parity == Parity::POSITIVE);
+
+    const Species be9("Be-9", "Be", 1, 5, 4, 9, 6462.6693, "B-", -13736.8, std::numeric_limits<double>::infinity(), "3/2-", "IS=100", 9.01218306, 0.00008);
+    EXPECT_EQ(be9.twoJ(), 3);
+    EXPECT_EQ(be9.parity(), Parity::NEGATIVE);
+    EXPECT_FALSE(be9.spinUncertain());
+    EXPECT_DOUBLE_EQ(Species(be9).spin(), 1.5);
+
+    EXPECT_EQ(Tb_164.twoJ(), 10);
+    EXPECT_EQ(Tb_164.parity(), Parity::POSITIVE);
+    EXPECT_TRUE(Tb_164.spinUncertain());
+    EXPECT_EQ(Pm_164.twoJ(), 10);
+    EXPECT_EQ(Pm_164.parity(), Parity::NEGATIVE);
+    EXPECT_TRUE(Pm_164.spinUncertain());
+    EXPECT_FALSE(Bh_270.nuclearSpin().known());
+    EXPECT_EQ(Bh_270.parity(), Parity::UNKNOWN);
+    EXPECT_EQ(Li_7.twoJ(), 3);
+    EXPECT_EQ(B_10.twoJ(), 6);
+    EXPECT_EQ(N_14.twoJ(), 2);
+    EXPECT_EQ(N_14.parity(), Parity::POSITIVE);
+
+    const SpeciesTable& table = SpeciesTable::builtin();
+    for (const Species& species : table.allSpecies()) {
+        const NuclearSpin decoded = decode_jpi(species.spinParity());
+        EXPECT_EQ(species.twoJ(), decoded.twoJ) << species.name();
+        EXPECT_EQ(species.parity(), decoded.parity) << species.name();
+        EXPECT_EQ(species.spinUncertain(), decoded.uncertain) << species.name();
+    }
+    const SpeciesId tb164 = *table.find("Tb-164");
+    EXPECT_EQ(table.twoJ()[tb164], 10);
+    EXPECT_EQ(table.parity()[tb164], 1);
+    for (const SpeciesId id : table.select({SpeciesPredicate{SpeciesColumn::TWO_J, 0, 0}, SpeciesPredicate{SpeciesColumn::PARITY, 1, 1}})) {
+        EXPECT_EQ(table[id].spin(), 0.0);
+        EXPECT_EQ(table[id].parity(), Parity::POSITIVE);
+    }
+    EXPECT_EQ(table.count({SpeciesPredicate{SpeciesColumn::TWO_J, -1, -1}}) + table.count({SpeciesPredicate{SpeciesColumn::SPIN}}), table.size());
+}
+
 /**
  * @brief Tests the default constructor of the Composition class.
  * @details This is a basic sanity check to ensure that a `Composition` object can be
@@ -516,4 +599,986 @@ TEST_F(compositionTest, standardSolarCompositions) {
         }
     }
 
-}
\ No newline at end of file
+    // Every isotope of an element is weighted by the isotopic mass of the whole element
+    using namespace fourdst::atomic;
+    const Composition gs98 = get_composition_record(io::SolarCompositions::GS98, io::IsotopicPercentages::L09, 0.02, 0.28);
+    const double X = gs98.getMassFraction(H_1) + gs98.getMassFraction(H_2);
+    const double Y = gs98.getMassFraction(He_3) + gs98.getMassFraction(He_4);
+    EXPECT_NEAR(X, 0.70, 1e-12);
+    EXPECT_NEAR(Y, 0.28, 1e-12);
+    EXPECT_NEAR(1.0 - X - Y, 0.02, 1e-12);
+    EXPECT_NEAR(gs98.getMassFraction(C_12), 3.402003874450781e-3, 1e-12);
+    EXPECT_NEAR(gs98.getMassFraction(O_16), 9.352802752450708e-3, 1e-12);
+    EXPECT_NEAR(gs98.getMassFraction(Fe_56), 1.4121442503676814e-3, 1e-12);
+}
+
+/**
+ * @brief Tests the indexed, zero-copy ChemicalFileParser against the legacy copying entry points.
+ * @par What this test proves:
+ * - Blocks are found by exact name only, so a prefix such as "GS9" does not match "GS98".
+ * - The span-based parser yields the same comment, elements and abundances as the static vector<char> parser.
+ * - Isotopic percentage blocks are parsed into parallel arrays of equal length.
+ * @par What this test does not prove:
+ * - That every block of the embedded data file parses; only GS98 and L03_data are checked.
+ */
+TEST_F(compositionTest, chemicalFileParserIndex) {
+    using namespace fourdst::composition;
+
+    const auto raw = io::get_raw_standard_solar_composition_data();
+    const std::span<const char> data(reinterpret_cast<const char*>(raw.data()), raw.size());
+    const std::vector<char> buffer(data.begin(), data.end());
+
+    const io::ChemicalFileParser parser(data);
+    EXPECT_TRUE(parser.contains("GS98"));
+    EXPECT_TRUE(parser.contains("L09_data"));
+    EXPECT_FALSE(parser.contains("GS9"));
+
+    const auto indexed = parser.composition_data("GS98");
+    ASSERT_TRUE(indexed.has_value());
+    const io::CompositionData legacy = io::ChemicalFileParser::parse_composition_data(buffer, "GS98");
+    EXPECT_EQ(indexed->comment_str, legacy.comment_str);
+    EXPECT_EQ(indexed->elements, legacy.elements);
+    EXPECT_EQ(indexed->abundances, legacy.abundances);
+    EXPECT_TRUE(indexed->requires_atomic_weight);
+    EXPECT_EQ(indexed->elements.front(), "Li");
+
+    const auto isotopes = parser.isotopic_percentage("L03_data");
+    ASSERT_TRUE(isotopes.has_value());
+    EXPECT_EQ(isotopes->atomic_numbers.size(), isotopes->percentages.size());
+    EXPECT_EQ(isotopes->elements.front(), "H");
+    EXPECT_EQ(isotopes->mass_numbers.front(), 1);
+
+    EXPECT_FALSE(parser.composition_data("NOT_A_SCHEME").has_value());
+}
+
+/**
+ * @brief Tests runtime registration of user abundance tables with get_composition_record.
+ * @par What this test proves:
+ * - A registered SECTIONS block is found by name and only contributes the metals it lists.
+ * - The resulting composition honours the requested metallicity Z.
+ * - clear_registered_abundance_data() removes the block again.
+ * @par What this test does not prove:
+ * - Registration from files through register_abundance_file() or the memory mapping behind it.
+ */
+TEST_F(compositionTest, registeredAbundanceData) {
+    using namespace fourdst::composition;
+
+    const std::string user_data =
+        "BEGIN USER_TEST\n"
+        "\t COMMENT: user supplied metals \n"
+        "\t HE_ABUNDANCE: 10.93\n"
+        "\t REQUIRES_ATOMIC_WEIGHT: True\n"
+        "\t SYMBOL: [C,N,O,]\n"
+        "\t ABUNDANCES: [8.43, 7.83, 8.69]\n"
+        "END USER_TEST\n";
+    io::register_abundance_data(std::vector<char>(user_data.begin(), user_data.end()));
+
+    const Composition comp = get_composition_record("USER_TEST", "L09_data", 0.02, 0.28);
+    EXPECT_TRUE(comp.contains(fourdst::atomic::C_12));
+    EXPECT_TRUE(comp.contains(fourdst::atomic::O_16));
+    EXPECT_FALSE(comp.contains(fourdst::atomic::Fe_56));
+    const double metals = 1.0 - comp.getMassFraction(fourdst::atomic::H_1) - comp.getMassFraction(fourdst::atomic::He_3) - comp.getMassFraction(fourdst::atomic::He_4);
+    EXPECT_NEAR(metals, 0.02, 1e-10);
+
+    io::clear_registered_abundance_data();
+    EXPECT_ANY_THROW((void)get_composition_record("USER_TEST", "L09_data", 0.02, 0.28));
+}
+
+/**
+ * @brief Tests the versioned binary serialisation of a Composition and its zero-copy view.
+ * @par What this test proves:
+ * - serialize() writes exactly serialized_size() bytes with an aligned abundance block.
+ * - deserialize() restores the species and abundances, so the composition hash is unchanged.
+ * - CompositionView reads the buffer in place and derives the same mass fractions and moments.
+ * - Buffers with the same species list share one schema.
+ * @par What this test does not prove:
+ * - Compatibility with buffers written by other versions of the format.
+ */
+TEST_F(compositionTest, binarySerializationRoundTrip) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const Composition comp(std::vector{H_1, He_4, C_12, O_16, Fe_56}, {0.7, 0.07, 1e-3, 5e-4, 1e-5});
+    const std::vector<std::byte> buffer = io::serialize(comp);
+    EXPECT_EQ(buffer.size(), io::serialized_size(comp));
+    EXPECT_EQ(buffer.size() % io::kCompositionBinaryAlignment, 0);
+
+    const io::CompositionBinaryHeader header = io::read_header(buffer);
+    EXPECT_EQ(header.species_count, comp.size());
+    EXPECT_EQ(header.abundance_offset % io::kCompositionBinaryAlignment, 0);
+
+    const Composition restored = io::deserialize(buffer);
+    EXPECT_EQ(restored.hash(), comp.hash());
+    EXPECT_EQ(restored.getRegisteredSpecies(), comp.getRegisteredSpecies());
+
+    const CompositionView view = io::deserialize_view(buffer);
+    EXPECT_FALSE(view.ownsData());
+    EXPECT_EQ(view.hash(), comp.hash());
+    EXPECT_DOUBLE_EQ(view.getMassFraction("He-4"), comp.getMassFraction("He-4"));
+    EXPECT_DOUBLE_EQ(view.getMeanParticleMass(), comp.getMeanParticleMass());
+    EXPECT_DOUBLE_EQ(view.getElectronAbundance(), comp.getElectronAbundance());
+    EXPECT_THROW((void)view.getMolarAbundance(N_14), fourdst::composition::exceptions::UnregisteredSymbolError);
+
+    // Views of buffers sharing a species list share one schema
+    const std::vector<std::byte> second = io::serialize(comp);
+    EXPECT_EQ(io::deserialize_view(second).schema(), view.schema());
+}
+
+/**
+ * @brief Tests that malformed binary composition buffers are rejected.
+ * @par What this test proves:
+ * - Too small output buffers, truncated input, a corrupted species table and a bad magic number all throw CompositionIOError.
+ * @par What this test does not prove:
+ * - That every possible corruption is detected; abundances are not checksummed.
+ */
+TEST_F(compositionTest, binarySerializationRejectsMalformedData) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const Composition comp(std::vector{H_1, He_4}, {0.7, 0.07});
+    std::vector<std::byte> buffer = io::serialize(comp);
+
+    std::vector<std::byte> small(buffer.size() - 1);
+    EXPECT_THROW((void)io::serialize(comp, small), fourdst::composition::exceptions::CompositionIOError);
+    EXPECT_THROW((void)io::deserialize(std::span(buffer).first(buffer.size() - 8)), fourdst::composition::exceptions::CompositionIOError);
+
+    std::vector<std::byte> badSchema = buffer;
+    badSchema[sizeof(io::CompositionBinaryHeader)] ^= std::byte{0x01};
+    EXPECT_THROW((void)io::deserialize_view(badSchema), fourdst::composition::exceptions::CompositionIOError);
+
+    buffer[0] = std::byte{0};
+    EXPECT_THROW((void)io::deserialize(buffer), fourdst::composition::exceptions::CompositionIOError);
+}
+
+/**
+ * @brief Tests random access to the zones of a memory-mapped composition archive.
+ * @par What this test proves:
+ * - Both layouts return the written abundances and mass coordinates of any zone.
+ * - Row-major zones are zero-copy views, column-major zones are gathered copies.
+ * - Column-major archives expose a species column as a contiguous span.
+ * @par What this test does not prove:
+ * - Behaviour for archives larger than memory or on filesystems without mmap support.
+ */
+TEST_F(compositionTest, compositionArchiveZoneViews) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const std::vector<Composition> zones = {
+        Composition(std::vector{H_1, He_4}, {0.7, 0.07}),
+        Composition(std::vector{He_4, C_12, O_16}, {0.2, 0.01, 0.02}),
+        Composition(std::vector{C_12, O_16, Fe_56}, {0.03, 0.03, 0.001})
+    };
+    const std::vector<double> massCoordinates = {0.9, 0.5, 0.1};
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "fourdst_composition_archive_test.fdstarch";
+
+    for (const auto layout : {io::ArchiveLayout::ROW_MAJOR, io::ArchiveLayout::COLUMN_MAJOR}) {
+        io::write_composition_archive(path, zones, massCoordinates, layout);
+        const io::CompositionArchive archive(path);
+
+        ASSERT_EQ(archive.zone_count(), zones.size());
+        EXPECT_EQ(archive.species_count(), 5);
+        EXPECT_EQ(archive.layout(), layout);
+        EXPECT_DOUBLE_EQ(archive.zone_coordinate(1), 0.5);
+
+        const CompositionView zone = archive.zone(1);
+        EXPECT_EQ(zone.ownsData(), layout == io::ArchiveLayout::COLUMN_MAJOR);
+        EXPECT_DOUBLE_EQ(zone.getMolarAbundance(O_16), 0.02);
+        EXPECT_DOUBLE_EQ(zone.getMolarAbundance(H_1), 0.0);
+        EXPECT_DOUBLE_EQ(archive.molar_abundance(2, Fe_56), 0.001);
+        EXPECT_THROW((void)archive.zone(3), std::out_of_range);
+
+        const auto column = archive.species_column(C_12);
+        EXPECT_EQ(column.has_value(), layout == io::ArchiveLayout::COLUMN_MAJOR);
+        if (column) {
+            EXPECT_EQ(std::vector(column->begin(), column->end()), (std::vector{0.0, 0.01, 0.03}));
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief Tests that the delta-compressed composition time series replays every frame bit-exactly.
+ * @par What this test proves:
+ * - Sequential reads and keyframe seeks both reproduce the appended abundances exactly.
+ * - A keyframe is written every keyframe_interval frames, and seek_time() finds the frame at or before a time.
+ * - Appending to a closed writer and seeking past the end throw.
+ * - A write that fails when the writer is closed is reported by close().
+ * @par What this test does not prove:
+ * - The achieved compression ratio, which depends on how smoothly the abundances evolve.
+ */
+TEST_F(compositionTest, compositionTimeSeriesReplayIsBitExact) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const std::vector<Species> species = Composition(std::vector{H_1, He_4, C_12, O_16}).getRegisteredSpecies();
+    std::vector<std::vector<double>> frames;
+    std::vector<double> y = {0.7, 0.07, 1e-3, 5e-4};
+    for (size_t step = 0; step < 100; ++step) {
+        y[step % y.size()] *= 1.0 + 1e-7 * static_cast<double>(step);
+        frames.push_back(y);
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "fourdst_composition_timeseries_test.fdstseri";
+    {
+        io::CompositionTimeSeriesWriter writer(path, species, {.keyframe_interval = 16, .max_pending = 4});
+        for (size_t step = 0; step < frames.size(); ++step) {
+            writer.append(static_cast<double>(step), frames[step]);
+        }
+        writer.close();
+        EXPECT_EQ(writer.frames_appended(), frames.size());
+        EXPECT_THROW(writer.append(0.0, frames.front()), fourdst::composition::exceptions::CompositionIOError);
+    }
+
+    io::CompositionTimeSeriesReader reader(path);
+    ASSERT_EQ(reader.frame_count(), frames.size());
+    EXPECT_EQ(reader.keyframes().size(), 7);
+
+    size_t step = 0;
+    while (reader.next()) {
+        const auto abundances = reader.molar_abundances();
+        EXPECT_TRUE(std::ranges::equal(abundances, frames[step])) << "frame " << step;
+        ++step;
+    }
+    EXPECT_EQ(step, frames.size());
+
+    reader.seek(37);
+    EXPECT_TRUE(std::ranges::equal(reader.molar_abundances(), frames[37]));
+    EXPECT_EQ(reader.seek_time(58.5), 58);
+    EXPECT_EQ(reader.view().getMolarAbundance(C_12), frames[58][2]);
+    EXPECT_THROW(reader.seek(frames.size()), std::out_of_range);
+
+    // Every write to /dev/full fails once the stream buffer is flushed, which happens on close
+    if (std::filesystem::exists("/dev/full")) {
+        io::CompositionTimeSeriesWriter full("/dev/full", species);
+        full.append(0.0, frames.front());
+        EXPECT_THROW(full.close(), fourdst::composition::exceptions::CompositionIOError);
+    }
+
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief Tests NumPy .npz export of composition batches and .npy read/write of plain arrays.
+ * @par What this test proves:
+ * - A written .npz archive reads back as zero-copy zone views with the shared species names.
+ * - .npy arrays round-trip, and reading them as the wrong dtype throws.
+ * - Shapes that do not match the data, or whose element count overflows, are rejected on write and read.
+ * @par What this test does not prove:
+ * - Interoperability with files written by NumPy itself, which is not available to the test.
+ */
+TEST_F(compositionTest, numpyExportRoundTrip) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const std::vector<Composition> zones = {
+        Composition(std::vector{H_1, He_4}, {0.7, 0.07}),
+        Composition(std::vector{He_4, C_12, O_16}, {0.2, 0.01, 0.02})
+    };
+    const std::filesystem::path npzPath = std::filesystem::temp_directory_path() / "fourdst_composition_numpy_test.npz";
+    io::write_composition_npz(npzPath, zones);
+
+    const io::CompositionNpz npz(npzPath);
+    ASSERT_EQ(npz.zone_count(), zones.size());
+    EXPECT_EQ(npz.schema()->size(), 4);
+    const CompositionView zone = npz.zone(1);
+    EXPECT_FALSE(zone.ownsData());
+    EXPECT_DOUBLE_EQ(zone.getMolarAbundance(C_12), 0.01);
+    EXPECT_DOUBLE_EQ(zone.getMolarAbundance(H_1), 0.0);
+    EXPECT_THROW((void)npz.zone(2), std::out_of_range);
+
+    const io::NpzFile archive(npzPath);
+    EXPECT_TRUE(archive.contains("mass"));
+    EXPECT_EQ(archive.at("names").strings(), (std::vector<std::string>{"H-1", "He-4", "C-12", "O-16"}));
+    EXPECT_EQ(archive.at("molar_abundances").shape(), (std::vector<size_t>{2, 4}));
+    EXPECT_THROW((void)archive.at("missing"), fourdst::composition::exceptions::CompositionIOError);
+
+    const std::vector<double> matrix = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    const std::filesystem::path npyPath = std::filesystem::temp_directory_path() / "fourdst_composition_numpy_test.npy";
+    io::write_npy<double>(npyPath, matrix, {2, 3});
+    const io::NpyFile npy(npyPath);
+    EXPECT_TRUE(std::ranges::equal(npy.array().values<double>(), matrix));
+    EXPECT_THROW((void)npy.array().values<float>(), fourdst::composition::exceptions::CompositionIOError);
+    EXPECT_THROW(io::write_npy<double>(npyPath, matrix, {4, 2}), fourdst::composition::exceptions::CompositionIOError);
+    const std::vector<std::uint32_t> ids = {0x10001u, 0x20004u, 0x6000cu};
+    io::write_npy<std::uint32_t>(npyPath, ids, {3});
+    EXPECT_TRUE(std::ranges::equal(io::NpyFile(npyPath).array().values<std::uint32_t>(), ids));
+    EXPECT_THROW(io::write_npy<double>(npyPath, {}, {std::size_t{1} << 32, std::size_t{1} << 32}), fourdst::composition::exceptions::CompositionIOError);
+
+    // 2^32 * 2^32 elements wrap to zero, which would pass the truncation check
+    const std::string dict = "{'descr': '<f8', 'fortran_order': False, 'shape': (4294967296, 4294967296), }\n";
+    std::string wrapped = std::string("\x93NUMPY\x01\x00", 8) + static_cast<char>(dict.size()) + '\0' + dict;
+    EXPECT_THROW((void)io::NpyArray(std::as_bytes(std::span(wrapped))), fourdst::composition::exceptions::CompositionIOError);
+
+    std::filesystem::remove(npzPath);
+    std::filesystem::remove(npyPath);
+}
+
+/**
+ * @brief Tests the std::formatter specialisations for Composition and Species.
+ * @par What this test proves:
+ * - The format spec selects the quantity (Y, X, n), the JSON layout and the floating-point style.
+ * - operator<< matches std::format with the stream's precision, also when it exceeds kMaxFormatPrecision.
+ * - Invalid specs are rejected with std::format_error.
+ * @par What this test does not prove:
+ * - Formatting of compositions with many species beyond the two used here.
+ */
+TEST_F(compositionTest, formatterSelectsQuantityAndLayout) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const Composition comp(std::vector{H_1, He_4}, {0.7, 0.075});
+
+    EXPECT_EQ(std::format("{:Yj}", comp), R"({"H-1": 0.7, "He-4": 0.075})");
+    EXPECT_EQ(std::format("{:Y.3e}", comp), "Composition(Molar Abundances => [H-1: 7.000e-01, He-4: 7.500e-02])");
+    EXPECT_EQ(
+        std::format("{}", comp),
+        std::format("Composition(Mass Fractions => [H-1: {}, He-4: {}])", comp.getMassFraction(H_1), comp.getMassFraction(He_4))
+    );
+    EXPECT_EQ(
+        std::format("{:nj}", comp),
+        std::format(R"({{"H-1": {}, "He-4": {}}})", comp.getNumberFraction(H_1), comp.getNumberFraction(He_4))
+    );
+    EXPECT_EQ(std::format("[{:>5}]", He_4), "[ He-4]");
+
+    std::ostringstream stream;
+    stream << comp;
+    EXPECT_EQ(stream.str(), std::format("{:.6}", comp));
+
+    std::ostringstream wide;
+    wide << std::scientific << std::setprecision(600) << comp;
+    EXPECT_EQ(wide.str(), std::format("{:.100e}", comp));
+
+    utils::CompositionFormatSpec spec;
+    EXPECT_EQ(utils::parse_composition_format_spec("X.1000", spec), std::string_view::npos);
+    spec = {.precision = 600, .style = std::chars_format::scientific};
+    EXPECT_EQ(utils::format_composition(comp, spec), std::format("{:.100e}", comp));
+    EXPECT_THROW((void)std::vformat("{:Q}", std::make_format_args(comp)), std::format_error);
+}
+
+/**
+ * @brief Tests that the composition text format round-trips abundances bit-exactly.
+ * @par What this test proves:
+ * - Shortest representations, subnormals, negative zero and the largest double parse back to identical bits.
+ * - Single- and multi-threaded parsing agree.
+ * - Comments, CRLF line endings and extra whitespace are accepted; missing headers, wrong counts and bad tokens throw.
+ * @par What this test does not prove:
+ * - Parsing throughput, which is covered by the benchmarks.
+ */
+TEST_F(compositionTest, textFormatRoundTripIsBitExact) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const std::vector<Composition> zones = {
+        Composition(std::vector{H_1, He_4, C_12}, {0.1 + 0.2, 1.0 / 3.0, 5e-324}),
+        Composition(std::vector{O_16, Fe_56}, {-0.0, 1.7976931348623157e308})
+    };
+    const std::string text = io::to_composition_text(zones);
+    EXPECT_TRUE(text.starts_with(std::string(io::kCompositionTextHeader) + "\nzone 3\nH-1     0.30000000000000004\n"));
+
+    for (const size_t threads : {1, 4}) {
+        const std::vector<Composition> parsed = io::parse_composition_text(text, {.threads = threads, .min_chunk_bytes = 1});
+        ASSERT_EQ(parsed.size(), zones.size());
+        for (size_t i = 0; i < zones.size(); ++i) {
+            EXPECT_EQ(utils::CompositionHash::hash_exact(parsed[i]), utils::CompositionHash::hash_exact(zones[i]));
+        }
+    }
+
+    const std::string header = std::string(io::kCompositionTextHeader) + "\n";
+    const std::vector<Composition> tolerant = io::parse_composition_text(header + "# comment\r\n\nzone 2\r\n  He-4\t0.25 \nH-1 0.5");
+    ASSERT_EQ(tolerant.size(), 1);
+    EXPECT_DOUBLE_EQ(tolerant[0].getMolarAbundance(He_4), 0.25);
+
+    EXPECT_THROW((void)io::parse_composition_text("zone 1\nH-1 0.5\n"), exceptions::CompositionIOError);
+    EXPECT_THROW((void)io::parse_composition_text(header + "zone 2\nH-1 0.5\n"), exceptions::CompositionIOError);
+    EXPECT_THROW((void)io::parse_composition_text(header + "zone 1\nH-1 0.5x\n"), exceptions::CompositionIOError);
+    EXPECT_THROW((void)io::parse_composition_text(header + "zone 1\nXx-9 0.5\n"), exceptions::UnknownSymbolError);
+}
+
+/**
+ * @brief Tests the C ABI over caller-owned abundance arrays.
+ * @par What this test proves:
+ * - Bound arrays are read in place, so later writes by the caller are seen.
+ * - Moments and mass fractions agree with the equivalent Composition, including strided batches.
+ * - Errors are reported through status codes and fdst_composition_last_error().
+ * @par What this test does not prove:
+ * - The Fortran module, which is exercised by the Fortran benchmark only.
+ */
+TEST_F(compositionTest, cApiBindsCallerArrays) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const std::vector<int32_t> z = {2, 1, 6};
+    const std::vector<int32_t> a = {4, 1, 12};
+    std::vector<double> y = {0.07, 0.7, 1e-3};
+
+    fdst_composition* handle = nullptr;
+    ASSERT_EQ(fdst_composition_create(z.data(), a.data(), z.size(), &handle), FDST_COMPOSITION_OK);
+    ASSERT_EQ(fdst_composition_species_count(handle), 3);
+    std::array<char, 8> name{};
+    ASSERT_EQ(fdst_composition_species_name(handle, 0, name.data(), name.size()), FDST_COMPOSITION_OK);
+    EXPECT_STREQ(name.data(), "He-4");
+
+    fdst_composition_moments moments{};
+    EXPECT_EQ(fdst_composition_get_moments(handle, &moments), FDST_COMPOSITION_NOT_BOUND);
+    EXPECT_STRNE(fdst_composition_last_error(), "");
+
+    ASSERT_EQ(fdst_composition_bind(handle, y.data()), FDST_COMPOSITION_OK);
+    y[1] = 0.5; // the bound array is read, not copied
+    const Composition comp(std::vector{He_4, H_1, C_12}, y);
+    ASSERT_EQ(fdst_composition_get_moments(handle, &moments), FDST_COMPOSITION_OK);
+    EXPECT_NEAR(moments.mean_particle_mass, comp.getMeanParticleMass(), 1e-12);
+    EXPECT_NEAR(moments.ye, comp.getElectronAbundance(), 1e-12);
+
+    std::vector<double> x(3);
+    ASSERT_EQ(fdst_composition_get_mass_fractions(handle, x.data()), FDST_COMPOSITION_OK);
+    EXPECT_NEAR(x[0], comp.getMassFraction(He_4), 1e-12);
+    EXPECT_NEAR(x[2], comp.getMassFraction(C_12), 1e-12);
+
+    // Two zones, the second one is the first with a padded stride of 4
+    std::vector<double> zones = {y[0], y[1], y[2], -1.0, y[0], y[1], y[2], -1.0};
+    std::array<fdst_composition_moments, 2> zoneMoments{};
+    ASSERT_EQ(fdst_composition_moments_batch(handle, zones.data(), 2, 4, zoneMoments.data()), FDST_COMPOSITION_OK);
+    EXPECT_DOUBLE_EQ(zoneMoments[1].ye, moments.ye);
+    ASSERT_EQ(fdst_composition_mass_fractions_batch(handle, zones.data(), 2, 4, zones.data()), FDST_COMPOSITION_OK);
+    EXPECT_DOUBLE_EQ(zones[4], x[0]);
+    EXPECT_DOUBLE_EQ(zones[3], -1.0);
+    EXPECT_EQ(fdst_composition_moments_batch(handle, zones.data(), 2, 2, zoneMoments.data()), FDST_COMPOSITION_INVALID_ARGUMENT);
+
+    // An empty zone has NaN means but does not fail the batch
+    const std::vector<double> empty = {0.0, 0.0, 0.0, y[0], y[1], y[2]};
+    ASSERT_EQ(fdst_composition_moments_batch(handle, empty.data(), 2, 3, zoneMoments.data()), FDST_COMPOSITION_OK);
+    EXPECT_EQ(zoneMoments[0].sum_y, 0.0);
+    EXPECT_TRUE(std::isnan(zoneMoments[0].abar));
+    EXPECT_DOUBLE_EQ(zoneMoments[1].ye, moments.ye);
+    fdst_composition_destroy(handle);
+
+    const int32_t badZ = 1;
+    const int32_t badA = 99;
+    EXPECT_EQ(fdst_composition_create(&badZ, &badA, 1, &handle), FDST_COMPOSITION_UNKNOWN_SPECIES);
+    EXPECT_EQ(handle, nullptr);
+    EXPECT_NE(std::string(fdst_composition_last_error()).find("A=99"), std::string::npos);
+}
+
+/**
+ * @brief Tests sharing compositions between processes through a POSIX shared-memory segment.
+ * @par What this test proves:
+ * - A separate worker process attaches to the segment by name and reads the zones written by this process.
+ * - Only the creator owns the name, creating an existing name throws, and the name is unlinked on destruction.
+ * @par What this test does not prove:
+ * - Concurrent writers; segments are read-only once created.
+ */
+TEST_F(compositionTest, sharedSegmentAttachesAcrossProcesses) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    // The worker is a separate executable; forking this process would run the child alongside the logger's threads
+    const char* worker = std::getenv("FDST_SHARED_SEGMENT_WORKER");
+    if (worker == nullptr) {
+        GTEST_SKIP() << "FDST_SHARED_SEGMENT_WORKER is not set; run the test through meson.";
+    }
+    const std::vector<Composition> zones = {
+        Composition(std::vector{H_1, He_4}, {0.7, 0.07}),
+        Composition(std::vector{He_4, C_12}, {0.2, 0.05})
+    };
+    const std::string name = "/fdst_composition_test_" + std::to_string(::getpid());
+    io::SharedCompositionSegment::remove(name);
+    {
+        const auto segment = io::SharedCompositionSegment::create(name, zones);
+        EXPECT_TRUE(segment.owns_name());
+        EXPECT_THROW((void)io::SharedCompositionSegment::create(name, zones), exceptions::CompositionIOError);
+
+        // The worker sees the same abundances through its own read-only mapping
+        char* argv[] = {const_cast<char*>(worker), const_cast<char*>(name.c_str()), nullptr};
+        pid_t child = 0;
+        ASSERT_EQ(::posix_spawn(&child, worker, nullptr, nullptr, argv, environ), 0);
+        int status = 0;
+        ASSERT_EQ(::waitpid(child, &status, 0), child);
+        EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+        const auto attached = io::SharedCompositionSegment::attach(name);
+        EXPECT_DOUBLE_EQ(attached.zone(0).getMeanParticleMass(), zones[0].getMeanParticleMass());
+    }
+    EXPECT_THROW((void)io::SharedCompositionSegment::attach(name), exceptions::CompositionIOError);
+    EXPECT_THROW((void)io::SharedCompositionSegment::attach("no-leading-slash"), exceptions::CompositionIOError);
+}
+
+/**
+ * @brief Tests packing compositions into message buffers and unpacking them again.
+ * @par What this test proves:
+ * - Inline-schema and schema-ID messages both round-trip, and schema-ID messages are smaller.
+ * - unpack_into() overwrites existing ghost compositions in place.
+ * - Unknown schemas are rejected until registered, and mixed species lists or short buffers throw.
+ * @par What this test does not prove:
+ * - Transport over MPI, which the library does not depend on.
+ */
+TEST_F(compositionTest, packUnpackLoopback) {
+    using namespace fourdst::composition;
+    using namespace fourdst::atomic;
+
+    const std::vector<Composition> halo = {
+        Composition(std::vector{H_1, He_4, C_12}, {0.7, 0.07, 1e-3}),
+        Composition(std::vector{H_1, He_4, C_12}, {0.5, 0.12, 2e-3})
+    };
+
+    // The first message carries the schema, later ones only its ID
+    std::vector<std::byte> first(io::packed_size(halo, io::PackSchema::INLINE));
+    ASSERT_EQ(io::pack_into(halo, first, io::PackSchema::INLINE), first.size());
+    const std::vector<Composition> received = io::unpack_zones_from(first);
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(utils::CompositionHash::hash_exact(received[1]), utils::CompositionHash::hash_exact(halo[1]));
+
+    std::vector<std::byte> message(io::packed_size(halo));
+    EXPECT_LT(message.size(), first.size());
+    io::pack_into(halo, message);
+    std::vector<Composition> ghosts = {Composition(std::vector{H_1, He_4, C_12}), Composition()};
+    io::unpack_into(message, ghosts);
+    EXPECT_DOUBLE_EQ(ghosts[0].getMolarAbundance(He_4), 0.07);
+    EXPECT_DOUBLE_EQ(ghosts[1].getMolarAbundance(C_12), 2e-3);
+
+    std::vector<std::byte> single(io::packed_size(halo[0]));
+    io::pack_into(halo[0], single);
+    EXPECT_EQ(utils::CompositionHash::hash_exact(io::unpack_from(single)), utils::CompositionHash::hash_exact(halo[0]));
+    EXPECT_THROW((void)io::unpack_from(message), exceptions::CompositionIOError);
+
+    const Composition unregistered(std::vector{Li_7, Be_9, B_11}, {1e-9, 1e-10, 1e-11});
+    std::vector<std::byte> unknown(io::packed_size(unregistered));
+    io::pack_into(unregistered, unknown);
+    EXPECT_THROW((void)io::unpack_from(unknown), exceptions::CompositionIOError);
+    EXPECT_EQ(io::register_species_schema(unregistered.getRegisteredSpecies()), io::read_pack_header(unknown).schema_id);
+    EXPECT_DOUBLE_EQ(io::unpack_from(unknown).getMolarAbundance(Be_9), 1e-10);
+
+    const std::vector<Composition> mixed = {halo[0], unregistered};
+    std::vector<std::byte> tooSmall(io::packed_size(halo) - 1);
+    EXPECT_THROW((void)io::pack_into(halo, tooSmall), exceptions::CompositionIOError);
+    std::vector<std::byte> mixedBuffer(io::packed_size(mixed));
+    EXPECT_THROW((void)io::pack_into(mixed, mixedBuffer), exceptions::CompositionIOError);
+}
+
+/**
+ * @brief Tests predicate queries over the columnar species table.
+ * @par What this test proves:
+ * - The builtin table holds every species and can be searched by (Z, A) and by name.
+ * - Conjunctions of predicates select the expected rows, with fractional bounds on integer columns rounded inwards.
+ * - Query results can be used to build compositions and masks.
+ * @par What this test does not prove:
+ * - The vectorised code path is faster than a scalar scan; that is covered by the benchmarks.
+ */
+TEST_F(compositionTest, speciesTableQueries) {
+    using namespace fourdst::atomic;
+    const SpeciesTable& table = SpeciesTable::builtin();
+    ASSERT_EQ(table.size(), species.size());
+    EXPECT_EQ(table.select({}).size(), table.size());
+
+    const auto fe56 = table.find(26, 56);
+    ASSERT_TRUE(fe56.has_value());
+    EXPECT_EQ(table[*fe56], Fe_56);
+    EXPECT_EQ(table.find("Fe-56"), fe56);
+    EXPECT_FALSE(table.find(26, 500).has_value());
+    EXPECT_THROW((void)table[static_cast<SpeciesId>(table.size())], std::out_of_range);
+
+    const auto light = table.select({atMost(SpeciesColumn::Z, 2), isStable()});
+    const auto lightSpecies = table.species(light);
+    EXPECT_EQ(lightSpecies, (std::vector{H_1, H_2, He_3, He_4}));
+    EXPECT_EQ(table.count({atMost(SpeciesColumn::Z, 2), isStable()}), light.size());
+
+    // Fractional bounds on integer columns are rounded inwards
+    EXPECT_EQ(table.select({between(SpeciesColumn::Z, 25.5, 26.5)}), table.select({equalTo(SpeciesColumn::Z, 26)}));
+    EXPECT_TRUE(table.select({between(SpeciesColumn::A, 4.2, 4.8)}).empty());
+
+    const auto longLivedIron = table.species(table.select({equalTo(SpeciesColumn::Z, 26), atLeast(SpeciesColumn::HALF_LIFE, 3.15576e7)}));
+    EXPECT_NE(std::ranges::find(longLivedIron, Fe_60), longLivedIron.end());
+    EXPECT_EQ(std::ranges::find(longLivedIron, Fe_59), longLivedIron.end());
+
+    // Query results feed compositions and masks directly
+    const fourdst::composition::Composition comp(lightSpecies);
+    EXPECT_EQ(comp.size(), light.size());
+    const fourdst::composition::MaskedComposition masked(comp, table.species(table.select({equalTo(SpeciesColumn::Z, 2)})));
+    EXPECT_TRUE(masked.contains(He_4));
+}
+
+/**
+ * @brief Tests the per-element isotope spans of the species table.
+ * @par What this test proves:
+ * - Each element's span holds exactly its isotopes, sorted by mass number.
+ * - The spans of consecutive elements tile the whole table.
+ * - Out-of-range charge numbers give empty spans rather than throwing.
+ * @par What this test does not prove:
+ * - The ordering of isomers of the same (Z, A), which the builtin table does not contain.
+ */
+TEST_F(compositionTest, speciesTableElementIndex) {
+    using namespace fourdst::atomic;
+    const SpeciesTable& table = SpeciesTable::builtin();
+
+    const auto helium = table.element(2);
+    ASSERT_FALSE(helium.empty());
+    EXPECT_TRUE(std::ranges::is_sorted(helium, {}, &SpeciesRecord::a));
+    EXPECT_TRUE(std::ranges::all_of(helium, [](const SpeciesRecord& r) { return r.z == 2 && r.n == r.a - 2; }));
+    EXPECT_EQ(table.lightestA(2), helium.front().a);
+    EXPECT_EQ(table.heaviestA(2), helium.back().a);
+    EXPECT_EQ(static_cast<std::size_t>(std::ranges::count_if(species | std::views::values, [](const Species& sp) { return sp.z() == 2; })), helium.size());
+
+    const auto he4 = std::ranges::find(helium, 4, &SpeciesRecord::a);
+    ASSERT_NE(he4, helium.end());
+    EXPECT_EQ(table[he4->id], He_4);
+    EXPECT_DOUBLE_EQ(he4->mass, He_4.mass());
+
+    // Blocks of consecutive elements tile the table
+    std::size_t rows = 0;
+    for (int z = 0; z <= table.z().back(); ++z) {
+        rows += table.element(z).size();
+    }
+    EXPECT_EQ(rows, table.size());
+    EXPECT_TRUE(table.element(-1).empty());
+    EXPECT_TRUE(table.element(table.z().back() + 1).empty());
+    EXPECT_FALSE(table.heaviestA(1000).has_value());
+}
+
+/**
+ * @brief Tests loading AME and NUBASE text into a species table and caching it.
+ * @par What this test proves:
+ * - Masses, binding energies, spins and decay modes are read at their fixed-width offsets.
+ * - Only ground states are kept, half-lives are converted from their own units, and later tables in a file are ignored.
+ * - The binary cache round-trips, and malformed input throws CompositionIOError.
+ * - Installing a table redirects symbol lookups until it is removed.
+ * @par What this test does not prove:
+ * - That the complete AME2020 and NUBASE2020 files load; only excerpts are used.
+ */
+TEST_F(compositionTest, speciesTableLoadsNuclearData) {
+    using namespace fourdst::atomic;
+
+    // Excerpts of mass_1.mas20.txt and nubase2020.asc
+    const std::string ame = std::string("1N-Z    N    Z   A  EL    O     MASS EXCESS  ...\n") +
+        "                                   (keV)                  (keV)                    (keV)                        (micro-u)\n" +
+        "   0    2    2    4 He         2424.91587     0.00015    7073.9156     0.0002  B- -22898.2740   212.1320    4 002603.25413     0.00016\n" +
+        "   0   13   13   26 Al       -12210.139       0.066      8149.7653     0.0026  B-  -5069.1361     0.0849   25 986891.876       0.071\n" +
+        "   8   34   26   60 Fe  -nn  -61413.174       3.406      8755.8539     0.0568  B-    237.2633     3.4106   59 934070.249       3.656\n";
+    const std::string nubase = std::string("# NUBASE excerpt\n") +
+        "004 0020   4He      2424.91587    0.00015                             stbl              0+            98          1908 IS=99.9998 2\n" +
+        "026 0131   26Al m -11981.83       0.07      228.306      0.013   MD  6346.0   ms 0.5    0+      T=1   16          1934 B+=100\n" +
+        "026 0130   26Al   -12210.14       0.07                                717     ky 24     5+            16          1934 B+=100\n" +
+        "060 0260   60Fe   -61413          3                                     2.62  My 0.04   0+            13          1957 B-=100\n" +
+        "# A second table in another layout is ignored\n" +
+        "004 0020   4He      2424.9156   0.0001                       stbl              0+            98          1908 IS=99.9998 2\n";
+
+    const SpeciesTable table = SpeciesTable::fromNuclearData(ame, nubase);
+    ASSERT_EQ(table.size(), 3);
+    const Species& he4 = table[*table.find("He-4")];
+    EXPECT_DOUBLE_EQ(he4.mass(), He_4.mass());
+    EXPECT_DOUBLE_EQ(he4.bindingEnergy(), He_4.bindingEnergy());
+    EXPECT_EQ(he4.halfLife(), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(he4.spinParity(), "0+");
+    EXPECT_EQ(he4.decayModes(), "IS=99.9998 2");
+
+    // Ground states only, with half-lives converted from their own units
+    EXPECT_DOUBLE_EQ(table[*table.find(13, 26)].halfLife(), 717.0 * 3.15576e10);
+    EXPECT_EQ(table[*table.find(13, 26)].spinParity(), "5+");
+    EXPECT_DOUBLE_EQ(table[*table.find(26, 60)].halfLife(), 2.62 * 3.15576e13);
+    EXPECT_EQ(table[*table.find(26, 60)].nz(), Fe_60.nz());
+
+    const std::vector<std::byte> cache = table.toCache();
+    const SpeciesTable restored = SpeciesTable::fromCache(cache);
+    ASSERT_EQ(restored.size(), table.size());
+    for (SpeciesId id = 0; id < table.size(); ++id) {
+        EXPECT_EQ(restored[id].name(), table[id].name());
+        EXPECT_EQ(restored[id].mass(), table[id].mass());
+        EXPECT_EQ(restored[id].halfLife(), table[id].halfLife());
+        EXPECT_EQ(restored[id].decayModes(), table[id].decayModes());
+    }
+    EXPECT_THROW((void)SpeciesTable::fromCache(std::span(cache).first(cache.size() - 1)), fourdst::composition::exceptions::CompositionIOError);
+    EXPECT_THROW((void)SpeciesTable::fromNuclearData(ame + "   0    2    2    x He\n", nubase), fourdst::composition::exceptions::CompositionIOError);
+
+    // Installed tables back the symbol lookups until they are removed again
+    SpeciesTable::install(std::make_shared<const SpeciesTable>(restored));
+    EXPECT_DOUBLE_EQ(fourdst::composition::getSpecies("Fe-60")->halfLife(), 2.62 * 3.15576e13);
+    EXPECT_FALSE(fourdst::composition::getSpecies(1, 1).has_value());
+    SpeciesTable::install(nullptr);
+    EXPECT_EQ(fourdst::composition::getSpecies(1, 1), H_1);
+}
+
+/**
+ * @brief Tests the decoding of NUBASE decay-mode strings into the CSR decay channel table.
+ * @par What this test proves:
+ * - Channels are exclusive, intensities become fractions and "?" becomes NaN.
+ * - Daughters are resolved to rows of the table, and fission has no daughter.
+ */
+TEST_F(compositionTest, speciesTableDecayChannels) {
+    using namespace fourdst::atomic;
+
+    // β-delayed branches are subtracted from the β branch; the EC/e+ split of B+ is folded into it
+    const auto na22 = parseDecayModes("B+=100;e+=90.57 8;EC=9.43 6", 11, 22);
+    ASSERT_EQ(na22.size(), 1);
+    EXPECT_EQ(na22[0].mode, DecayMode::BETA_PLUS);
+    EXPECT_DOUBLE_EQ(na22[0].branchingRatio, 1.0);
+    EXPECT_EQ(na22[0].daughterZ, 10);
+
+    const auto u238 = parseDecayModes("A=100;SF=5.44e-5 17;2B- ?;IS=99.2742 10", 92, 238);
+    ASSERT_EQ(u238.size(), 3);
+    EXPECT_EQ(u238[0].daughterA, 234);
+    EXPECT_EQ(u238[1].mode, DecayMode::SPONTANEOUS_FISSION);
+    EXPECT_EQ(u238[1].daughterZ, -1);
+    EXPECT_TRUE(std::isnan(u238[2].branchingRatio));
+    EXPECT_EQ(parseDecayModes("14C=8.9e-8 4", 88, 223)[0].daughterZ, 82);
+
+    const Species he8("He-8", "He", 4, 6, 2, 8, 3924.5210, "B-", 10663.8784, 0.1191, "0+", "B-=100;B-n=16 1;B-t=0.9 1", 8.033934388, 0.00010);
+    const SpeciesTable table({he8, Li_8, Li_7, He_5});
+    const auto channels = table.decayChannels(*table.find("He-8"));
+    ASSERT_EQ(channels.size(), 3);
+    EXPECT_EQ(channels[0].mode, DecayMode::BETA_MINUS);
+    EXPECT_DOUBLE_EQ(channels[0].branchingRatio, 0.831);
+    EXPECT_EQ(channels[0].daughter, *table.find("Li-8"));
+    EXPECT_EQ(channels[1].daughter, *table.find("Li-7"));
+    EXPECT_EQ(channels[2].daughter, *table.find("He-5"));
+    EXPECT_EQ(table.decayOffsets().size(), table.size() + 1);
+    EXPECT_THROW((void)table.decayChannels(static_cast<SpeciesId>(table.size())), std::out_of_range);
+}
+
+/**
+ * @brief Tests the NUBASE fields of the compiled-in species table.
+ * @par What this test proves:
+ * - species.h holds complete decay-mode strings, so builtin β and α emitters have decay channels.
+ * - Builtin half-lives are converted from their own units (ys to s), not read as seconds.
+ * @par What this test does not prove:
+ * - The half-lives, spins and decay modes of species other than the spot-checked ones.
+ */
+TEST_F(compositionTest, builtinNuclearProperties) {
+    using namespace fourdst::atomic;
+    const SpeciesTable& table = SpeciesTable::builtin();
+
+    const auto ni56 = table.decayChannels(*table.find("Ni-56"));
+    ASSERT_EQ(ni56.size(), 1);
+    EXPECT_EQ(ni56[0].mode, DecayMode::BETA_PLUS);
+    EXPECT_DOUBLE_EQ(ni56[0].branchingRatio, 1.0);
+    EXPECT_EQ(ni56[0].daughter, *table.find("Co-56"));
+
+    const auto h3 = table.decayChannels(*table.find("H-3"));
+    ASSERT_EQ(h3.size(), 1);
+    EXPECT_EQ(h3[0].mode, DecayMode::BETA_MINUS);
+    const auto po210 = table.decayChannels(*table.find("Po-210"));
+    ASSERT_EQ(po210.size(), 1);
+    EXPECT_EQ(po210[0].mode, DecayMode::ALPHA);
+    EXPECT_EQ(po210[0].daughter, *table.find("Pb-206"));
+    EXPECT_EQ(H_1.decayModes(), "IS=99.9855 78");
+
+    EXPECT_DOUBLE_EQ(He_8.halfLife(), 119.5e-3);
+    EXPECT_DOUBLE_EQ(Li_11.halfLife(), 8.75e-3);
+    EXPECT_DOUBLE_EQ(Be_8.halfLife(), 81.9e-18);
+    EXPECT_DOUBLE_EQ(Ni_56.halfLife(), 6.075 * 86400.0);
+
+    // Units that lost their first letter were read as seconds before the NUBASE column fix
+    EXPECT_DOUBLE_EQ(N_12.halfLife(), 11.0e-3);
+    EXPECT_DOUBLE_EQ(Po_214.halfLife(), 163.47e-6);
+    EXPECT_DOUBLE_EQ(Po_212.halfLife(), 294.4e-9);
+    EXPECT_DOUBLE_EQ(He_5.halfLife(), 602.0e-24);
+    EXPECT_DOUBLE_EQ(Al_25.halfLife(), 7.1666); // Given in seconds, so unchanged by the fix
+    EXPECT_EQ(O_13.spinParity(), "(3/2-)");
+}
+
+/**
+ * @brief Tests radioactive decay of compositions against the analytic Bateman solution.
+ * @par What this test proves:
+ * - The 56Ni -> 56Co -> 56Fe chain of the builtin species table matches the two-member Bateman solution, and daughters are added to the result.
+ * - A species with a half-life but no decay channels keeps its abundance instead of losing it.
+ * - The batch variant gives the same result for every zone as the single-composition call.
+ * - A replaced table is released by the network cache even when several schemas were decayed against it.
+ */
+TEST_F(compositionTest, radioactiveDecay) {
+    using namespace fourdst::atomic;
+    const double halfLifeNi = 6.075 * 86400.0;
+    const double halfLifeCo = 77.236 * 86400.0;
+    ASSERT_DOUBLE_EQ(Ni_56.halfLife(), halfLifeNi);
+    ASSERT_DOUBLE_EQ(Co_56.halfLife(), halfLifeCo);
+
+    const fourdst::composition::Composition comp(std::vector{Ni_56, He_4}, {1.0e-3, 0.25});
+    const double dt = 100.0 * 86400.0;
+    const auto decayed = fourdst::composition::utils::decay(comp, dt);
+
+    const double l1 = std::numbers::ln2 / halfLifeNi;
+    const double l2 = std::numbers::ln2 / halfLifeCo;
+    const double ni = 1.0e-3 * std::exp(-l1 * dt);
+    const double co = 1.0e-3 * l1 / (l2 - l1) * (std::exp(-l1 * dt) - std::exp(-l2 * dt));
+    ASSERT_EQ(decayed.size(), 4);
+    EXPECT_NEAR(decayed.getMolarAbundance("Ni-56"), ni, 1.0e-16);
+    EXPECT_NEAR(decayed.getMolarAbundance("Co-56"), co, 1.0e-16);
+    EXPECT_NEAR(decayed.getMolarAbundance("Fe-56"), 1.0e-3 - ni - co, 1.0e-16);
+    EXPECT_EQ(decayed.getMolarAbundance("He-4"), 0.25);
+
+    const std::vector zones(300, comp);
+    const auto batch = fourdst::composition::utils::decay(zones, dt, {.threads = 4, .min_zones_per_thread = 16});
+    ASSERT_EQ(batch.size(), zones.size());
+    for (const auto& zone : batch) {
+        EXPECT_EQ(zone.getMolarAbundanceVector(), decayed.getMolarAbundanceVector());
+    }
+    EXPECT_THROW((void)fourdst::composition::utils::decay(comp, -1.0), std::invalid_argument);
+
+    const Species unknownModes("Ni-56", "Ni", 0, 28, 28, 56, Ni_56.bindingEnergy(), "B-", 0.0, halfLifeNi, "0+", "", Ni_56.mass(), 0.0);
+    SpeciesTable::install(std::make_shared<const SpeciesTable>(std::vector{unknownModes, He_4}));
+    const auto kept = fourdst::composition::utils::decay(comp, dt);
+    ASSERT_EQ(kept.size(), 2);
+    EXPECT_EQ(kept.getMolarAbundance("Ni-56"), 1.0e-3);
+
+    // Networks of a replaced table are released once the cache holds the only references to it
+    auto replaced = std::make_shared<const SpeciesTable>(std::vector{Ni_56, Co_56, Fe_56, He_4});
+    const std::weak_ptr<const SpeciesTable> released = replaced;
+    SpeciesTable::install(std::move(replaced));
+    (void)fourdst::composition::utils::decay(comp, dt);
+    (void)fourdst::composition::utils::decay(fourdst::composition::Composition(std::vector{Co_56}, {1.0e-3}), dt);
+    SpeciesTable::install(nullptr);
+    EXPECT_FALSE(released.expired());
+    (void)fourdst::composition::utils::decay(fourdst::composition::Composition(std::vector{Co_56, He_4}, {1.0e-3, 0.25}), dt);
+    EXPECT_TRUE(released.expired());
+}
+
+/**
+ * @brief Tests the vectorised Q-value calculator and its cache.
+ * @par What this test proves:
+ * - Q-values from the mass excess column match those from the atomic masses, with uncertainties added in quadrature.
+ * - Repeated requests for the same network definition share one cached result.
+ * - A table with several cached networks is released once nothing but the cache refers to it.
+ */
+TEST_F(compositionTest, reactionQValues) {
+    using namespace fourdst::atomic;
+    const SpeciesTable& table = SpeciesTable::builtin();
+    const SpeciesId p = *table.find("H-1");
+    const SpeciesId li7 = *table.find("Li-7");
+    const SpeciesId he4 = *table.find("He-4");
+    const SpeciesId c12 = *table.find("C-12");
+
+    // p + 7Li -> 2 4He and the triple alpha 3 4He -> 12C
+    const std::vector<std::uint32_t> offsets{0, 3, 5};
+    const std::vector<ReactionTerm> terms{{p, -1}, {li7, -1}, {he4, 2}, {he4, -3}, {c12, 1}};
+    const auto q = ReactionQValues::cached(offsets, terms);
+    ASSERT_EQ(q->size(), 2);
+    EXPECT_NEAR(q->qValues()[0], (H_1.mass() + Li_7.mass() - 2.0 * He_4.mass()) * kAtomicMassUnitMeV, 1.0e-9);
+    EXPECT_NEAR(q->qValues()[0], 17.346, 1.0e-3);
+    EXPECT_NEAR(q->qValues()[1], 7.275, 1.0e-3);
+    const auto sigma = table.massExcessUnc();
+    EXPECT_DOUBLE_EQ(q->uncertainties()[0], std::sqrt(sigma[p] * sigma[p] + sigma[li7] * sigma[li7] + 4.0 * sigma[he4] * sigma[he4]));
+
+    EXPECT_EQ(ReactionQValues::cached(offsets, terms), q);
+    EXPECT_THROW((void)ReactionQValues::cached(std::vector<std::uint32_t>{0, 4}, terms), std::invalid_argument);
+    const std::vector<ReactionTerm> bad{{static_cast<SpeciesId>(table.size()), 1}};
+    EXPECT_THROW((void)ReactionQValues(table, std::vector<std::uint32_t>{0, 1}, bad), std::out_of_range);
+
+    // A loaded table with two cached networks is released once only the cache refers to it
+    auto loaded = std::make_shared<const SpeciesTable>(std::vector{H_1, He_4, Li_7, C_12});
+    const std::weak_ptr<const SpeciesTable> released = loaded;
+    const std::vector<ReactionTerm> loadedTerms{{0, -1}, {2, -1}, {1, 2}, {1, -3}, {3, 1}};
+    (void)ReactionQValues::cached(loaded, offsets, loadedTerms);
+    (void)ReactionQValues::cached(loaded, std::vector<std::uint32_t>{0, 3}, std::span(loadedTerms).first(3));
+    loaded.reset();
+    EXPECT_FALSE(released.expired());
+    (void)ReactionQValues::cached(std::vector<std::uint32_t>{0, 2}, std::span(terms).subspan(3, 2));
+    EXPECT_TRUE(released.expired());
+}
+
+/**
+ * @brief Tests the std::string_view symbol overloads.
+ * @par What this test proves:
+ * - Symbols viewed inside a larger buffer (not null terminated) resolve to the same species as std::string symbols.
+ * - Composition, MaskedComposition and the mass fraction builder accept views, and unknown symbols still throw.
+ */
+TEST_F(compositionTest, stringViewSymbolLookup) {
+    using namespace fourdst::composition;
+    const std::string_view deck = "He-4 0.25\nH-1 0.75\nXx-9 0.0\n";
+    const std::string_view he4 = deck.substr(0, 4);
+    const std::string_view h1 = deck.substr(10, 3);
+    const std::string_view unknown = deck.substr(19, 4);
+
+    EXPECT_TRUE(fourdst::atomic::species.contains(he4));
+    ASSERT_TRUE(findSpecies(he4));
+    EXPECT_EQ(*findSpecies(he4), fourdst::atomic::He_4);
+    EXPECT_FALSE(findSpecies(unknown));
+    EXPECT_FALSE(getSpecies(unknown).has_value());
+
+    Composition comp;
+    comp.registerSymbol(he4);
+    comp.registerSymbol(h1);
+    comp.setMolarAbundance(he4, 0.25 / fourdst::atomic::He_4.mass());
+    comp.setMolarAbundance(h1, 0.75 / fourdst::atomic::H_1.mass());
+    EXPECT_TRUE(comp.contains(he4));
+    EXPECT_NEAR(comp.getMassFraction(he4), 0.25, 1.0e-12);
+    EXPECT_EQ(comp.getSpeciesIndex(h1), comp.getSpeciesIndex(std::string("H-1")));
+    EXPECT_THROW(comp.setMolarAbundance(unknown, 1.0), exceptions::UnknownSymbolError);
+
+    const MaskedComposition masked(comp, {fourdst::atomic::He_4, fourdst::atomic::C_12});
+    EXPECT_TRUE(masked.contains(he4));
+    EXPECT_FALSE(masked.contains(h1));
+    EXPECT_EQ(masked.getMolarAbundance("C-12"), 0.0);
+    EXPECT_THROW((void)masked.contains(unknown), exceptions::UnknownSymbolError);
+
+    const std::vector<std::string_view> symbols{he4, h1};
+    const std::vector<double> massFractions{0.25, 0.75};
+    const Composition built = buildCompositionFromMassFractions(symbols, massFractions);
+    EXPECT_NEAR(built.getMassFraction(he4), 0.25, 1.0e-12);
+    EXPECT_NEAR(built.getMassFraction("H-1"), 0.75, 1.0e-12);
+}
+
+/**
+ * @brief Tests the tolerant nuclide symbol parser.
+ * @par What this test proves:
+ * - Element-first, mass-first, case-insensitive and particle-name spellings decode to the right (Z, A), at compile time too.
+ * - Malformed symbols are rejected, and the symbol-taking composition APIs accept every supported spelling.
+ */
+TEST_F(compositionTest, tolerantNuclideSymbols) {
+    using namespace fourdst::atomic;
+    static_assert(parse_nuclide("56fe") == NuclideZA{26, 56});
+    static_assert(parse_nuclide("n14") == NuclideZA{7, 14});
+    static_assert(parse_nuclide("n-1") == NuclideZA{0, 1});
+
+    for (const std::string_view spelling : {"Fe-56", "Fe56", "fe56", "FE_56", "56Fe", "56-fe", " Fe 56 "}) {
+        EXPECT_EQ(parse_nuclide(spelling), (NuclideZA{26, 56})) << spelling;
+    }
+    EXPECT_EQ(parse_nuclide("p"), (NuclideZA{1, 1}));
+    EXPECT_EQ(parse_nuclide("n"), (NuclideZA{0, 1}));
+    EXPECT_EQ(parse_nuclide("d"), (NuclideZA{1, 2}));
+    EXPECT_EQ(parse_nuclide("t"), (NuclideZA{1, 3}));
+    EXPECT_EQ(parse_nuclide("Alpha"), (NuclideZA{2, 4}));
+    for (const std::string_view malformed : {"", "Fe", "56", "Fe-56-", "Xx-9", "Fe--56", "Fe1234", "Uuo-294", "C-4"}) {
+        EXPECT_FALSE(parse_nuclide(malformed).has_value()) << malformed;
+    }
+
+    const SpeciesTable& table = SpeciesTable::builtin();
+    EXPECT_EQ(table.findNuclide("56fe"), table.find("Fe-56"));
+    EXPECT_EQ(table.findNuclide("alpha"), table.find("He-4"));
+    EXPECT_FALSE(table.findNuclide("fe500").has_value());
+
+    fourdst::composition::Composition comp;
+    comp.registerSymbol("c12");
+    comp.registerSymbol("alpha");
+    comp.setMolarAbundance("12C", 0.5);
+    EXPECT_EQ(comp.getMolarAbundance("C-12"), 0.5);
+    EXPECT_TRUE(comp.contains("He-4"));
+    EXPECT_THROW(comp.registerSymbol("fe500"), fourdst::composition::exceptions::UnknownSymbolError);
+}
+
+/**
+ * @brief Tests the compile-time `_sp` species literals.
+ * @par What this test proves:
+ * - Literals resolve to the row of the species in the builtin table at compile time, in any notation parse_nuclide() accepts.
+ * - The generated (Z, A) index matches the builtin table row for row, and literals stand in for species in the composition API.
+ */
+TEST_F(compositionTest, speciesLiterals) {
+    using namespace fourdst::atomic;
+    using namespace fourdst::atomic::literals;
+    static_assert(std::ranges::is_sorted(kBuiltinNuclides, {}, [](const NuclideZA& nuclide) { return std::pair(nuclide.z, nuclide.a); }));
+    static_assert("He-4"_sp == "alpha"_sp);
+    static_assert("56fe"_sp.za == NuclideZA{26, 56});
+    constexpr SpeciesRef c12 = "C-12"_sp;
+
+    const SpeciesTable& table = SpeciesTable::builtin();
+    ASSERT_EQ(table.size(), kBuiltinNuclides.size());
+    for (std::size_t row = 0; row < kBuiltinNuclides.size(); ++row) {
+        EXPECT_EQ(table.z()[row], kBuiltinNuclides[row].z);
+        EXPECT_EQ(table.a()[row], kBuiltinNuclides[row].a);
+    }
+    EXPECT_EQ(c12.id, table.find("C-12"));
+    EXPECT_EQ("n-1"_sp.species(), n_1);
+    EXPECT_EQ("Fe-56"_sp.species(), Fe_56);
+
+    fourdst::composition::Composition comp;
+    comp.registerSpecies("He-4"_sp);
+    comp.registerSpecies(c12);
+    comp.setMolarAbundance(c12, 0.25);
+    EXPECT_EQ(comp.getMolarAbundance("C-12"_sp), 0.25);
+    EXPECT_TRUE(comp.contains("He-4"_sp));
+}
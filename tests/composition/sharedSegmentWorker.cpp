@@ -0,0 +1,23 @@
+#include "fourdst/atomic/species.h"
+#include "fourdst/composition/io/shared_composition_segment.h"
+
+#include <exception>
+
+/*
+ * Worker process of compositionTest.sharedSegmentAttachesAcrossProcesses. Attaches to the shared
+ * composition segment named by argv[1] and exits with 0 if it holds the zones the test created.
+ */
+int main(const int argc, char** argv) {
+    if (argc != 2) {
+        return 2;
+    }
+    using namespace fourdst::atomic;
+    try {
+        const auto attached = fourdst::composition::io::SharedCompositionSegment::attach(argv[1]);
+        const bool ok = !attached.owns_name() && attached.zone_count() == 2 &&
+            attached.zone(1).getMolarAbundance(C_12) == 0.05 && attached.zone(1).getMolarAbundance(H_1) == 0.0;
+        return ok ? 0 : 1;
+    } catch (const std::exception&) {
+        return 1;
+    }
+}
@@ -2,18 +2,21 @@ import pandas as pd
 import numpy as np
 import argparse
 import os
+import re
 
 
 # Column specifications for the NUBASE2020 data file.
-# These are character positions for fixed-width fields.
+# These are 0-based, end-exclusive character positions for fixed-width fields, matching the
+# 1-based columns of the file header (half-life unit 79:80, Jpi 89:102, decay modes 120:209)
+# and the runtime loader in species_table_io.cpp.
 nubase_col_specs = [
     (0, 3),    # Mass number (A)
     (4, 8),    # ZZZi identifier for isomer level
     (11, 16),  # A_El, e.g., "56Fe"
     (69, 78),  # Half-life value
-    (79, 81),  # Half-life unit
-    (89, 102), # Spin and parity
-    (120, 209) # Decay modes
+    (78, 80),  # Half-life unit
+    (88, 102), # Spin and parity
+    (119, 209) # Decay modes
 ]
 nubase_column_names = [
     "a",             
@@ -140,6 +143,49 @@ def convert_half_life_to_seconds(row):
     return value * factors.get(unit, 0.0)
 
 
+def decode_spin_parity(jpi):
+    """
+    Decodes a NUBASE2020 spin-parity (Jpi) string into twice the spin, the parity and a
+    tentative flag.
+
+    This mirrors fourdst::atomic::decode_jpi, so the generated header holds the same values
+    that a table loaded at runtime decodes.
+
+    Args:
+        jpi (str): The spin-parity string (e.g., "5/2-", "(3+)", "0+ T=1").
+
+    Returns:
+        tuple[int, str, bool]: 2J (-1 if not assigned), the C++ Parity enumerator name and
+                               whether the assignment is tentative.
+    """
+    text = str(jpi).lstrip(' ').split(' ')[0]
+    for separator in ',:':
+        text = text.split(separator)[0]
+
+    uncertain = any(c in '()#' for c in text)
+    text = ''.join(c for c in text if c not in '()#*')
+    if len(text) > 16:
+        return -1, 'UNKNOWN', uncertain
+
+    parity = 'UNKNOWN'
+    if text.endswith(('+', '-')):
+        parity = 'POSITIVE' if text[-1] == '+' else 'NEGATIVE'
+        text = text[:-1]
+
+    if not text:
+        return (0 if parity != 'UNKNOWN' else -1), parity, uncertain
+
+    match = re.fullmatch(r'(\d*)(?:/(\d+))?', text)
+    if not match or (not match.group(1) and match.group(2) is None):
+        return -1, parity, uncertain
+    numerator = int(match.group(1)) if match.group(1) else 1
+    denominator = int(match.group(2)) if match.group(2) is not None else 1
+    if numerator > 10000 or denominator > 10000 or denominator not in (1, 2):
+        return -1, parity, uncertain
+
+    return (numerator if denominator == 2 else 2 * numerator), parity, uncertain
+
+
 def formatSpecies(row):
     """
     Formats a DataFrame row into a C++ static Species object instantiation string.
@@ -176,11 +222,13 @@ def formatSpecies(row):
     # Escape double quotes in string fields for C++ compatibility.
     spinParity = str(row.get('spinParity', '')).strip().replace('"', '\\"')
     decayModes = str(row.get('decayModes', '')).strip().replace('"', '\\"')
+    twoJ, parity, uncertain = decode_spin_parity(row.get('spinParity', ''))
+    nuclearSpin = f"NuclearSpin{{{twoJ}, Parity::{parity}, {'true' if uncertain else 'false'}}}"
 
     instantiation = (
         f"static const Species {instanceName}(\"{name}\", \"{row['el'].strip()}\", {nz}, {n}, {z}, {a}, "
         f"{bindingEnergy}, \"{row['betaCode']}\", {betaDecayEnergy}, "
-        f"{halfLife_s}, \"{spinParity}\", \"{decayModes}\", "
+        f"{halfLife_s}, \"{spinParity}\", {nuclearSpin}, \"{decayModes}\", "
         f"{atomicMass}, {atomicMassUnc});"
     )
     return instantiation, instanceName
@@ -231,7 +279,7 @@ namespace fourdst::atomic {{
     {'\n    '.join([formatSpecies(row)[0] for index, row in dataFrame.iterrows()])}
     
     // Create a map from species name (e.g., "H-1") to a pointer to the species object.
-    static const std::unordered_map<std::string, const Species&> species = {{
+    static const std::unordered_map<std::string, const Species&, TransparentStringHash, std::equal_to<>> species = {{
         {'\n        '.join([f'{{"{row["el"].strip()}-{row["a"]}", {mkInstanceName(row)}}},' for index, row in dataFrame.iterrows()])}
     }};
     
@@ -258,11 +306,44 @@ namespace fourdst::atomic {{
 """
     return header
 
+def formatNuclideIndex(dataFrame):
+    """
+    Generates the C++ header holding the charge and mass number of every species at compile time.
+
+    The entries are sorted by (Z, A), which is the row order of SpeciesTable::builtin(), so the
+    position of a nuclide in this array is its SpeciesId. The "_sp" species literals resolve
+    symbols against it.
+
+    Args:
+        dataFrame (pd.DataFrame): The final merged DataFrame containing all species data.
+
+    Returns:
+        str: The content of the C++ header file.
+    """
+    za = sorted({(int(row['z']), int(row['a'])) for index, row in dataFrame.iterrows()})
+    entries = [f"{{{z}, {a}}}" for z, a in za]
+    body = '\n'.join('        ' + ', '.join(entries[i:i + 10]) + ',' for i in range(0, len(entries), 10))
+    header = f"""#pragma once
+#include <array>
+
+#include "fourdst/atomic/nuclide_symbol.h"
+
+namespace fourdst::atomic {{
+    // Charge and mass number of every species in species.h, in the (Z, A) order of the rows of SpeciesTable::builtin().
+    inline constexpr std::array<NuclideZA, {len(za)}> kBuiltinNuclides{{{{
+{body}
+    }}}};
+}} // namespace fourdst::atomic
+"""
+    return header
+
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Convert AME2020 and NUBASE2020 data to a C++ header file.")
     parser.add_argument("ame_input", help="Input file path for AME2020 (mass.mas20).")
     parser.add_argument("nubase_input", help="Input file path for NUBASE2020.")
     parser.add_argument("-o", "--output", help="Output file path.", default="species.h")
+    parser.add_argument("--index-output", help="Output file path of the compile-time (Z, A) index.", default="species_index.h")
     args = parser.parse_args()
 
     for path in [args.ame_input, args.nubase_input]:
@@ -311,4 +392,7 @@ if __name__ == "__main__":
     with open(args.output, "w") as f:
         f.write(header)
 
-    print(f"Successfully generated C++ header at {args.output}")
+    with open(args.index_output, "w") as f:
+        f.write(formatNuclideIndex(merged_df))
+
+    print(f"Successfully generated C++ headers at {args.output} and {args.index_output}")